@@ -0,0 +1,269 @@
+// Copyright 1998-2019 Epic Games, Inc. All Rights Reserved.
+
+//=======================================================================================
+// Agog Labs C++ library.
+//
+// ACompress class definition module
+// Notes:          See notes in header.
+//=======================================================================================
+
+
+//=======================================================================================
+// Includes
+//=======================================================================================
+
+#include <AgogCore/AgogCore.hpp> // Always include AgogCore first (as some builds require a designated precompiled header)
+#include <AgogCore/ACompress.hpp>
+#include <string.h>      // Uses:  memcpy, memset
+
+
+//=======================================================================================
+// Local Global Structures
+//=======================================================================================
+
+// Use unnamed namespace so that global namespace is not cluttered up
+namespace
+{
+
+  const uint32_t ACompress_hash_bits      = 12u;
+  const uint32_t ACompress_hash_size      = 1u << ACompress_hash_bits;
+  const uint32_t ACompress_match_min      = 4u;
+  const uint32_t ACompress_offset_max     = 0xffffu;
+  // Matches may not start within this many bytes of the end so the tail is always literals
+  const uint32_t ACompress_end_literals   = 5u;
+
+  //---------------------------------------------------------------------------------------
+  inline uint32_t read32(const uint8_t * byte_p)
+    {
+    uint32_t value;
+    ::memcpy(&value, byte_p, sizeof(value));
+    return value;
+    }
+
+  //---------------------------------------------------------------------------------------
+  inline uint32_t hash32(uint32_t value)
+    {
+    return (value * 2654435761u) >> (32u - ACompress_hash_bits);
+    }
+
+  //---------------------------------------------------------------------------------------
+  // Writes a length that did not fit in its token nibble
+  inline uint8_t * write_length_ext(uint8_t * dst_p, uint32_t length)
+    {
+    while (length >= 255u)
+      {
+      *dst_p++ = 255u;
+      length  -= 255u;
+      }
+    *dst_p++ = uint8_t(length);
+
+    return dst_p;
+    }
+
+  //---------------------------------------------------------------------------------------
+  // Writes a full sequence - literals followed by an optional match.
+  uint8_t * write_sequence(
+    uint8_t *       dst_p,
+    const uint8_t * literal_p,
+    uint32_t        literal_count,
+    uint32_t        match_offset,
+    uint32_t        match_length
+    )
+    {
+    uint8_t * token_p = dst_p++;
+    uint32_t  match_ext = match_length ? match_length - ACompress_match_min : 0u;
+
+    *token_p = uint8_t(((literal_count < 15u) ? literal_count : 15u) << 4u);
+
+    if (literal_count >= 15u)
+      {
+      dst_p = write_length_ext(dst_p, literal_count - 15u);
+      }
+
+    ::memcpy(dst_p, literal_p, literal_count);
+    dst_p += literal_count;
+
+    if (match_length)
+      {
+      *dst_p++ = uint8_t(match_offset);
+      *dst_p++ = uint8_t(match_offset >> 8u);
+
+      *token_p |= uint8_t((match_ext < 15u) ? match_ext : 15u);
+
+      if (match_ext >= 15u)
+        {
+        dst_p = write_length_ext(dst_p, match_ext - 15u);
+        }
+      }
+
+    return dst_p;
+    }
+
+  //---------------------------------------------------------------------------------------
+  // Reads a length that did not fit in its token nibble.
+  // Returns false if the source ran out.
+  inline bool read_length_ext(const uint8_t ** src_pp, const uint8_t * src_end_p, uint32_t * length_p)
+    {
+    const uint8_t * src_p = *src_pp;
+    uint32_t        byte;
+
+    do
+      {
+      if (src_p >= src_end_p)
+        {
+        return false;
+        }
+
+      byte       = *src_p++;
+      *length_p += byte;
+      }
+    while (byte == 255u);
+
+    *src_pp = src_p;
+
+    return true;
+    }
+
+} // End unnamed namespace
+
+
+//=======================================================================================
+// Class Methods
+//=======================================================================================
+
+//---------------------------------------------------------------------------------------
+// Compresses src_length bytes from src_p into dst_p.
+// Returns:    number of bytes written to dst_p
+// Arg         dst_p - must be at least get_bound(src_length) bytes
+// Notes:      Incompressible data grows slightly - see get_bound().
+uint32_t ACompress::compress(const void * src_p, uint32_t src_length, void * dst_p)
+  {
+  const uint8_t * src_start_p  = static_cast<const uint8_t *>(src_p);
+  const uint8_t * src_end_p    = src_start_p + src_length;
+  const uint8_t * literal_p    = src_start_p;
+  uint8_t *       out_p        = static_cast<uint8_t *>(dst_p);
+
+  if (src_length > ACompress_match_min + ACompress_end_literals)
+    {
+    // Positions stored as offsets from the start of the source - 0 is a valid "empty"
+    // entry since the first byte is never a match target of itself.
+    uint32_t        hash_table[ACompress_hash_size];
+    const uint8_t * match_limit_p = src_end_p - ACompress_end_literals;
+    const uint8_t * scan_p        = src_start_p + 1u;
+
+    ::memset(hash_table, 0, sizeof(hash_table));
+
+    while (scan_p + ACompress_match_min <= match_limit_p)
+      {
+      uint32_t        seq       = read32(scan_p);
+      uint32_t        hash      = hash32(seq);
+      const uint8_t * cand_p    = src_start_p + hash_table[hash];
+      uint32_t        offset    = uint32_t(scan_p - cand_p);
+
+      hash_table[hash] = uint32_t(scan_p - src_start_p);
+
+      if ((offset == 0u) || (offset > ACompress_offset_max) || (read32(cand_p) != seq))
+        {
+        scan_p++;
+        continue;
+        }
+
+      // Extend match forward
+      const uint8_t * match_end_p = scan_p + ACompress_match_min;
+
+      cand_p += ACompress_match_min;
+
+      while ((match_end_p < match_limit_p) && (*match_end_p == *cand_p))
+        {
+        match_end_p++;
+        cand_p++;
+        }
+
+      out_p = write_sequence(
+        out_p,
+        literal_p,
+        uint32_t(scan_p - literal_p),
+        offset,
+        uint32_t(match_end_p - scan_p));
+
+      scan_p    = match_end_p;
+      literal_p = match_end_p;
+      }
+    }
+
+  // Trailing literals
+  return uint32_t(write_sequence(out_p, literal_p, uint32_t(src_end_p - literal_p), 0u, 0u)
+    - static_cast<uint8_t *>(dst_p));
+  }
+
+//---------------------------------------------------------------------------------------
+// Decompresses a block written by compress().
+// Returns:    true if the block was well formed and expanded to exactly dst_length bytes
+// Arg         dst_length - uncompressed size (must be transmitted alongside the block)
+// Notes:      Bounds checked - safe to call on data from an untrusted source.
+bool ACompress::decompress(const void * src_p, uint32_t src_length, void * dst_p, uint32_t dst_length)
+  {
+  const uint8_t * in_p      = static_cast<const uint8_t *>(src_p);
+  const uint8_t * in_end_p  = in_p + src_length;
+  uint8_t *       dst_start_p = static_cast<uint8_t *>(dst_p);
+  uint8_t *       out_p     = dst_start_p;
+  uint8_t *       out_end_p = dst_start_p + dst_length;
+
+  while (in_p < in_end_p)
+    {
+    uint32_t token         = *in_p++;
+    uint32_t literal_count = token >> 4u;
+
+    if ((literal_count == 15u) && !read_length_ext(&in_p, in_end_p, &literal_count))
+      {
+      return false;
+      }
+
+    if ((uint32_t(in_end_p - in_p) < literal_count) || (uint32_t(out_end_p - out_p) < literal_count))
+      {
+      return false;
+      }
+
+    ::memcpy(out_p, in_p, literal_count);
+    in_p  += literal_count;
+    out_p += literal_count;
+
+    // Last sequence has no match
+    if (in_p >= in_end_p)
+      {
+      break;
+      }
+
+    if (in_end_p - in_p < 2)
+      {
+      return false;
+      }
+
+    uint32_t offset       = uint32_t(in_p[0]) | (uint32_t(in_p[1]) << 8u);
+    uint32_t match_length = token & 0xfu;
+
+    in_p += 2;
+
+    if ((match_length == 15u) && !read_length_ext(&in_p, in_end_p, &match_length))
+      {
+      return false;
+      }
+
+    match_length += ACompress_match_min;
+
+    if ((offset == 0u) || (offset > uint32_t(out_p - dst_start_p)) || (uint32_t(out_end_p - out_p) < match_length))
+      {
+      return false;
+      }
+
+    // Byte copy since the match may overlap the bytes being written
+    const uint8_t * match_p = out_p - offset;
+
+    while (match_length--)
+      {
+      *out_p++ = *match_p++;
+      }
+    }
+
+  return out_p == out_end_p;
+  }
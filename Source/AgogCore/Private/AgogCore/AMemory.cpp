@@ -402,6 +402,13 @@ void AMemoryStats::track_memory_shared(
   }
 
 
+//=======================================================================================
+// AObjReusePoolObserver Class Data
+//=======================================================================================
+
+AObjReusePoolObserver * AObjReusePoolObserver::ms_observer_p = nullptr;
+
+
 //=======================================================================================
 // AMemory Class Data
 //=======================================================================================
@@ -558,3 +558,84 @@ inline static uint16_t a_as_uint16_t_swap_inc(const void ** source_pp)
 #define A_BYTE_STREAM_OUT8(_dest_stream_pp, _source_p)    ( *((*(uint8_t **)(_dest_stream_pp))++) = *((const uint8_t *)(_source_p)) )
 #define A_BYTE_STREAM_UI8_INC(_source_stream_pp)          ( *((*(const uint8_t **)(_source_stream_pp))++) )
 
+
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Variable length (LEB128) unsigned integers - 7 bits per byte with the lowest bits
+// first and the high bit of each byte set if more bytes follow.  Values below 128 take 1
+// byte and the largest 32-bit values take 5 bytes.  Byte order independent so no swap
+// versions are needed.
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+//---------------------------------------------------------------------------------------
+// Returns number of bytes (1-5) that a_byte_stream_out_var32() writes for `value`
+inline static uint32_t a_byte_stream_var32_length(uint32_t value)
+  {
+  return (value < (1u << 7u))
+    ? 1u
+    : ((value < (1u << 14u))
+      ? 2u
+      : ((value < (1u << 21u))
+        ? 3u
+        : ((value < (1u << 28u)) ? 4u : 5u)));
+  }
+
+//---------------------------------------------------------------------------------------
+// Writes `value` as a variable length integer to *dest_stream_pp and increments it past
+// the bytes written.
+inline static void a_byte_stream_out_var32(void ** dest_stream_pp, uint32_t value)
+  {
+  uint8_t * dest_p = (uint8_t *)*dest_stream_pp;
+
+  while (value >= 0x80u)
+    {
+    *dest_p++ = uint8_t(value | 0x80u);
+    value >>= 7u;
+    }
+
+  *dest_p++ = uint8_t(value);
+  *dest_stream_pp = dest_p;
+  }
+
+//---------------------------------------------------------------------------------------
+// Reads a variable length integer from *source_pp and increments it past the bytes read.
+// At most 5 bytes are read - if they do not end the integer or its 5th byte holds more
+// than the top 4 bits of a 32-bit value, the data is corrupt and 0 is returned.
+inline static uint32_t a_as_uint32_t_var_inc(const void ** source_pp)
+  {
+  const uint8_t * source_p = (const uint8_t *)*source_pp;
+  uint32_t        byte     = *source_p++;
+  uint32_t        value    = byte & 0x7fu;
+  uint32_t        shift    = 7u;
+
+  while (byte & 0x80u)
+    {
+    byte = *source_p++;
+
+    if (shift == 28u)
+      {
+      // 5th byte - must be the last one and only has room for 4 more bits
+      if (byte > 0x0fu)
+        {
+        *source_pp = source_p;
+        A_ERRORX("Variable length integer is longer than 32 bits - binary is corrupt!");
+
+        return 0u;
+        }
+
+      value |= byte << shift;
+      break;
+      }
+
+    value |= (byte & 0x7fu) << shift;
+    shift += 7u;
+    }
+
+  *source_pp = source_p;
+
+  return value;
+  }
+
+#define A_BYTE_STREAM_OUT_VAR32(_dest_stream_pp, _value)  a_byte_stream_out_var32(reinterpret_cast<void **>(_dest_stream_pp), (_value))
+#define A_BYTE_STREAM_UI32_VAR_INC(_source_pp)            a_as_uint32_t_var_inc((const void **)(_source_pp))
+#define A_BYTE_STREAM_VAR32_LENGTH(_value)                a_byte_stream_var32_length(_value)
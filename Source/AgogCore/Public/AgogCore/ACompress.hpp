@@ -0,0 +1,47 @@
+// Copyright 1998-2019 Epic Games, Inc. All Rights Reserved.
+
+//=======================================================================================
+// Agog Labs C++ library.
+//
+// ACompress declaration header
+//   - fast lossless byte compression in the spirit of LZ4 (byte oriented LZ77 with no
+//     entropy coding).  Favours speed over ratio - intended for network packets and
+//     other transient buffers rather than archival storage.
+//
+// Block format - a sequence of sequences, each made up of:
+//
+//   token(1)            high nibble = literal count, low nibble = match length - 4
+//   [literal count+]    extra literal count bytes if high nibble == 15 (255 = continue)
+//   literals(n)
+//   offset(2)           little endian distance back to the match - omitted on last sequence
+//   [match length+]     extra match length bytes if low nibble == 15 (255 = continue)
+//
+// The last sequence always consists of literals only.
+//=======================================================================================
+
+#pragma once
+
+//=======================================================================================
+// Includes
+//=======================================================================================
+
+#include <AgogCore/AgogCore.hpp>
+
+
+//=======================================================================================
+// Global Structures
+//=======================================================================================
+
+//---------------------------------------------------------------------------------------
+class A_API ACompress
+  {
+  public:
+
+  // Class Methods
+
+    static uint32_t get_bound(uint32_t src_length)  { return src_length + (src_length / 255u) + 16u; }
+
+    static uint32_t compress(const void * src_p, uint32_t src_length, void * dst_p);
+    static bool     decompress(const void * src_p, uint32_t src_length, void * dst_p, uint32_t dst_length);
+
+  };
@@ -88,6 +88,29 @@ struct A_API AMemoryStats
   };
 
 
+//---------------------------------------------------------------------------------------
+// Notified of every object that an AObjReusePool hands out or takes back - used by
+// runtime allocation profilers.  Only called when AORPOOL_OBSERVER is defined (see
+// AObjReusePool.hpp) and an observer is installed in ms_observer_p.
+class A_API AObjReusePoolObserver
+  {
+  public:
+
+  // Class Data Members
+
+    // Currently installed observer or nullptr if none
+    static AObjReusePoolObserver * ms_observer_p;
+
+  // Methods
+
+    virtual ~AObjReusePoolObserver() {}
+
+    virtual void on_pool_allocate(const void * pool_p, uint32_t object_size) = 0;
+    virtual void on_pool_recycle(const void * pool_p, uint32_t object_size, uint32_t count) = 0;
+
+  };
+
+
 //---------------------------------------------------------------------------------------
 class A_API AMemory
   {
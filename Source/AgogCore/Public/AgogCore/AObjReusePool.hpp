@@ -27,6 +27,12 @@
   //#define AORPOOL_ALLOCATION_TRACKING
 #endif
 
+#if defined(A_EXTRA_CHECK) && !defined(AORPOOL_NO_OBSERVER) && !defined(AORPOOL_OBSERVER)
+  // If this is defined allocate() and recycle() notify AObjReusePoolObserver::ms_observer_p
+  // when it is set - costs a pointer test per call when no observer is installed.
+  #define AORPOOL_OBSERVER
+#endif
+
 
 //=======================================================================================
 // Global Structures
@@ -95,12 +101,14 @@ class AObjReusePool
     uint32_t get_count_overflow() const;
     uint32_t get_count_available() const  { return m_count_total - m_count_now; }
     uint32_t get_bytes_allocated() const  { return m_count_now * sizeof(_ObjectType); }
+    void     reset_count_max()            { m_count_max = m_count_now; }
   #else
     uint32_t get_count_used() const       { return 0; }
     uint32_t get_count_max() const        { return 0; }
     uint32_t get_count_overflow() const   { return 0; }
     uint32_t get_count_available() const  { return 0; }
     uint32_t get_bytes_allocated() const  { return 0; }
+    void     reset_count_max()            {}
   #endif
 
   // Modifying Methods
@@ -265,6 +273,13 @@ inline _ObjectType * AObjReusePool<_ObjectType>::allocate()
     m_allocated_list.append(obj_p);
   #endif
 
+  #ifdef AORPOOL_OBSERVER
+    if (AObjReusePoolObserver::ms_observer_p)
+      {
+      AObjReusePoolObserver::ms_observer_p->on_pool_allocate(this, uint32_t(sizeof(_ObjectType)));
+      }
+  #endif
+
   return obj_p;
   }
 
@@ -287,6 +302,13 @@ inline void AObjReusePool<_ObjectType>::recycle(_ObjectType * obj_p)
     m_allocated_list.remove(static_cast<AllocObject *>(obj_p));
   #endif
 
+  #ifdef AORPOOL_OBSERVER
+    if (AObjReusePoolObserver::ms_observer_p)
+      {
+      AObjReusePoolObserver::ms_observer_p->on_pool_recycle(this, uint32_t(sizeof(_ObjectType)), 1u);
+      }
+  #endif
+
   *obj_p->get_pool_unused_next() = m_pool_first_p;
   m_pool_first_p = static_cast<AllocObject *>(obj_p);
   }
@@ -310,6 +332,13 @@ void AObjReusePool<_ObjectType>::recycle_all(
     m_count_now -= length;
   #endif
 
+  #ifdef AORPOOL_OBSERVER
+    if (AObjReusePoolObserver::ms_observer_p && length)
+      {
+      AObjReusePoolObserver::ms_observer_p->on_pool_recycle(this, uint32_t(sizeof(_ObjectType)), uint32_t(length));
+      }
+  #endif
+
   AllocObject *  next_obj_p = m_pool_first_p;
   AllocObject ** objs_end_a = (AllocObject **)objs_a + length;
   while ((AllocObject **)objs_a < objs_end_a)
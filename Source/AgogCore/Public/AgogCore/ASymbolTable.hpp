@@ -77,7 +77,7 @@ class A_API ASymbolTable
     bool    translate_known_id(uint32_t sym_id, AString * str_p) const;
     ASymbol translate_str(const AString & str) const;
 
-    uint32_t  get_length() { return m_sym_refs.get_length(); }
+    uint32_t  get_length() const { return m_sym_refs.get_length(); }
     void      track_auto_parse_init();
     void      track_auto_parse_term();
 
@@ -15,9 +15,11 @@
 #include <AgogCore/AObjReusePool.hpp>
 #include <AgogCore/ASymbolTable.hpp>
 #include <SkookumScript/SkMind.hpp>
+#include <SkookumScript/SkAllocProfiler.hpp>
 #include <SkookumScript/SkBrain.hpp>
 #include <SkookumScript/SkActorClass.hpp>
 #include <SkookumScript/SkParser.hpp>
+#include <SkookumScript/SkReplay.hpp>
 #include <SkookumScript/SkBoolean.hpp>
 #include <SkookumScript/SkInvokedCoroutine.hpp>
 #include <SkookumScript/SkInvokedMethod.hpp>
@@ -143,6 +145,8 @@ void SkookumScript::update(
   f32  sim_delta
   )
   {
+  SkReplay::on_update(sim_ticks, sim_time, sim_delta);
+
   ms_sim_ticks = sim_ticks;
   ms_sim_time  = sim_time;
 
@@ -168,6 +172,8 @@ void SkookumScript::update(
 // Author(s):   Conan Reis
 void SkookumScript::update_ticks(uint64_t sim_ticks)
   {
+  SkReplay::on_update_ticks(sim_ticks);
+
   // See Note [1] about script deltas in SkookumScript::update()
   update_time_ticks(sim_ticks);
 
@@ -187,6 +193,8 @@ void SkookumScript::update_ticks(uint64_t sim_ticks)
 // Author(s):   Conan Reis
 void SkookumScript::update_delta(f32 sim_delta)
   {
+  SkReplay::on_update_delta(sim_delta);
+
   // See Note [1] about script deltas in SkookumScript::update()
   ms_sim_delta  = sim_delta;
   ms_sim_time  += sim_delta;
@@ -206,7 +214,8 @@ void SkookumScript::update_delta(f32 sim_delta)
 // Author(s):   Conan Reis
 void SkookumScript::update_time()
   {
-  if (ms_update_time_f)
+  // A replay supplies its own recorded time
+  if (ms_update_time_f && !SkReplay::is_replaying())
     {
     ms_update_time_f();
     }
@@ -232,7 +241,7 @@ void SkookumScript::update_request(
     ms_flags &= ~Flag_need_update;
     }
 
-  if (ms_update_time_f)
+  if (ms_update_time_f && !SkReplay::is_replaying())
     {
     ms_update_time_f();
     }
@@ -293,6 +302,8 @@ void SkookumScript::pools_reserve()
   {
   SkInstance::get_pool().reset(get_app_info()->get_pool_init_instance(), get_app_info()->get_pool_incr_instance());
   SkDataInstance::get_pool().reset(get_app_info()->get_pool_init_data_instance(), get_app_info()->get_pool_incr_data_instance(), false);
+  SkInstance32::get_pool().reset(get_app_info()->get_pool_incr_instance(), get_app_info()->get_pool_incr_instance(), false);
+  SkInstance64::get_pool().reset(get_app_info()->get_pool_incr_instance(), get_app_info()->get_pool_incr_instance(), false);
   SkInvokedExpression::get_pool().reset(get_app_info()->get_pool_init_iexpr(), get_app_info()->get_pool_incr_iexpr());
   SkInvokedCoroutine::get_pool().reset(get_app_info()->get_pool_init_icoroutine(), get_app_info()->get_pool_incr_icoroutine());
   }
@@ -303,6 +314,8 @@ void SkookumScript::pools_empty()
   {
   SkInstance::get_pool().empty();
   SkDataInstance::get_pool().empty();
+  SkInstance32::get_pool().empty();
+  SkInstance64::get_pool().empty();
   SkInvokedExpression::get_pool().empty();
   SkInvokedCoroutine::get_pool().empty();
   }
@@ -371,6 +384,9 @@ void SkookumScript::initialize_sim()
 
   SkDebug::print_agog("\nSkookumScript initializing session...\n", SkLocale_all, SkDPrintType_title);
 
+  // Start recording (if armed) before the class constructors use any randoms
+  SkReplay::on_initialize_sim();
+
   SK_ASSERTX(SkBrain::ms_object_class_p, "Binaries must have been loaded when SkookumScript::initialize_sim() is called!");
   if (SkBrain::ms_object_class_p) // Prevent crash if the above test failed
     {
@@ -410,6 +426,8 @@ void SkookumScript::initialize_gameplay(bool create_master_mind /*= true*/)
   {
   SK_MAD_ASSERTX(ms_initialization_level == InitializationLevel_sim, "Unexpected initialization level.");
 
+  SkReplay::on_initialize_gameplay(create_master_mind);
+
   SK_ASSERTX(SkBrain::ms_object_class_p, "Binaries must have been loaded when SkookumScript::initialize_sim() is called!");
   if (SkBrain::ms_object_class_p) // Prevent crash if the above test failed
     {
@@ -441,6 +459,9 @@ void SkookumScript::deinitialize_gameplay()
   {
   SK_MAD_ASSERTX(ms_initialization_level == InitializationLevel_gameplay, "Unexpected initialization level.");
 
+  // A recording ends with the gameplay (or sim) it was made in
+  SkReplay::on_deinitialize();
+
   // Clean up master mind
   if (ms_master_mind_p)
     {
@@ -464,6 +485,11 @@ void SkookumScript::deinitialize_gameplay()
       }
     }
 
+  #if (SKOOKUM & SK_CODE_IN)
+    // Cached invoke_script() snippets are owned by the update record from here on
+    SkParser::invoke_cache_flush();
+  #endif
+
   // While all coroutines have been terminated, purge and re-create the update record to recycle its memory
   if (ms_program_update_record_p)
     {
@@ -484,9 +510,16 @@ void SkookumScript::deinitialize_sim()
 
   SK_MAD_ASSERTX(!ms_master_mind_p, "Master Mind not deinitialized before calling SkookumScript::deinitialize_sim()! Call SkookumScript::deinitialize_gameplay() beforehand!");
 
+  SkReplay::on_deinitialize();
+
   // Deinitialize SkookumScript classes
   SkBrain::deinitialize_classes();
 
+  #if (SKOOKUM & SK_CODE_IN)
+    // Cached invoke_script() snippets are owned by the update record from here on
+    SkParser::invoke_cache_flush();
+  #endif
+
   // Recycle program update record memory at this point
   if (ms_program_update_record_p)
     {
@@ -512,6 +545,15 @@ void SkookumScript::deinitialize_program()
   {
   SK_MAD_ASSERTX(ms_initialization_level == InitializationLevel_program, "Unexpected initialization level.");
 
+  #if (SKOOKUM & SK_DEBUG)
+    // Counts refer to routines of the program being deleted
+    SkAllocProfiler::reset();
+  #endif
+
+  // Designated replay inputs are bindings of the program being deleted
+  SkReplay::play_stop();
+  SkReplay::undesignate_inputs();
+
   // Clear brain
   SkBrain::deinitialize_program();
 
@@ -536,8 +578,13 @@ void SkookumScript::deinitialize()
   SkClass::deinitialize();
 
   // Clear up debug stuff
+  #if (SKOOKUM & SK_DEBUG)
+    SkAllocProfiler::enable(false);
+  #endif
   SkDebug::deinitialize();
 
+  SkReplay::clear();
+
   // Free up pooled data structures
   SkookumScript::pools_empty();
 
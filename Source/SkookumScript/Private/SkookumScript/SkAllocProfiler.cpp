@@ -0,0 +1,901 @@
+// Copyright 1998-2019 Epic Games, Inc. All Rights Reserved.
+
+//=======================================================================================
+// SkookumScript C++ library.
+//
+// Runtime allocation accounting per script routine and per object pool
+//=======================================================================================
+
+
+//=======================================================================================
+// Includes
+//=======================================================================================
+
+#include <SkookumScript/Sk.hpp> // Always include Sk.hpp first (as some builds require a designated precompiled header)
+#include <SkookumScript/SkAllocProfiler.hpp>
+
+#if (SKOOKUM & SK_DEBUG)
+
+#include <AgogCore/ABinaryParse.hpp>
+#include <AgogCore/AObjReusePool.hpp>
+#include <AgogCore/AStringRef.hpp>
+#include <SkookumScript/SkDataInstance.hpp>
+#include <SkookumScript/SkDebug.hpp>
+#include <SkookumScript/SkInvokableBase.hpp>
+#include <SkookumScript/SkInvokedCoroutine.hpp>
+#include <SkookumScript/SkLiteralClosure.hpp>
+
+
+//=======================================================================================
+// Local Global Structures
+//=======================================================================================
+
+namespace
+{
+
+  // Number of routines that can be told apart - must be a power of 2.  The table is only
+  // filled to 3/4 so that probes stay short.
+  const uint32_t SkAllocProfiler_routine_slots = 1024u;
+  const uint32_t SkAllocProfiler_routine_max   = (SkAllocProfiler_routine_slots * 3u) / 4u;
+
+  // Number of object pools that can be told apart
+  const uint32_t SkAllocProfiler_pool_max = 32u;
+
+  // Most routines that print() and as_binary() will report
+  const uint32_t SkAllocProfiler_top_max = 64u;
+
+  // Routine entry kinds in as_binary()
+  enum eSkAllocEntry
+    {
+    SkAllocEntry_routine,
+    SkAllocEntry_outside,   // Allocations made while no routine was running
+    SkAllocEntry_overflow   // Routines that did not fit in the table
+    };
+
+  //---------------------------------------------------------------------------------------
+  // Allocation counts for a routine or for everything
+  struct SkAllocCounts
+    {
+    uint32_t m_pool_allocs;
+    uint32_t m_pool_recycles;
+    uint32_t m_mallocs;
+    uint32_t m_frees;
+    uint64_t m_malloc_bytes;
+
+    // Allocations (pool allocations + mallocs) per frame - m_frame_allocs is for frame
+    // m_frame_idx and m_last_frame_allocs for the frame before it.
+    uint32_t m_frame_idx;
+    uint32_t m_frame_allocs;
+    uint32_t m_last_frame_allocs;
+    uint32_t m_peak_frame_allocs;
+
+    void clear()
+      {
+      ::memset(this, 0, sizeof(SkAllocCounts));
+      }
+
+    uint32_t get_allocs() const
+      {
+      return m_pool_allocs + m_mallocs;
+      }
+
+    void count_alloc(uint32_t frame_idx)
+      {
+      if (m_frame_idx != frame_idx)
+        {
+        m_last_frame_allocs = ((m_frame_idx + 1u) == frame_idx) ? m_frame_allocs : 0u;
+        m_frame_allocs      = 0u;
+        m_frame_idx         = frame_idx;
+        }
+
+      if (++m_frame_allocs > m_peak_frame_allocs)
+        {
+        m_peak_frame_allocs = m_frame_allocs;
+        }
+      }
+
+    // Allocations in the most recently completed frame
+    uint32_t get_last_frame_allocs(uint32_t frame_idx) const
+      {
+      if (m_frame_idx == frame_idx)
+        {
+        return m_last_frame_allocs;
+        }
+
+      return ((m_frame_idx + 1u) == frame_idx) ? m_frame_allocs : 0u;
+      }
+    };
+
+  //---------------------------------------------------------------------------------------
+  // Routine that allocated - the member identity is copied out when the routine is first
+  // seen so that reporting never follows the invokable pointer.
+  struct SkAllocRoutine
+    {
+    const SkInvokableBase * m_invokable_p;
+    uint32_t                m_class_name_id;
+    uint32_t                m_name_id;
+    uint8_t                 m_member_bits;  // See SkMemberInfo::eByteFlag
+    SkAllocCounts           m_counts;
+    };
+
+  //---------------------------------------------------------------------------------------
+  struct SkAllocPool
+    {
+    const void * m_pool_p;
+    const char * m_name_p;       // nullptr if not one of the known pools
+    uint32_t     m_object_size;
+    uint32_t     m_allocs;
+    uint32_t     m_recycles;
+    int32_t      m_live;         // Relative to when the profiler was enabled or reset
+    int32_t      m_peak_live;
+    };
+
+  //---------------------------------------------------------------------------------------
+  // Receives the pool and AgogCore memory notifications and forwards the AgogCore app
+  // interface to the app's own one.
+  class SkAllocHook : public AAppInfoCore, public AObjReusePoolObserver
+    {
+    public:
+
+    // Methods
+
+      void install();
+      void uninstall();
+
+      void reset();
+      void name_pool(const void * pool_p, const char * name_p, uint32_t object_size);
+
+      SkAllocRoutine * get_routine();
+      SkAllocPool *    get_pool(const void * pool_p, uint32_t object_size);
+
+      void print(uint32_t top_count);
+      uint32_t get_top(const SkAllocRoutine ** top_a, uint32_t top_count) const;
+
+      #if (SKOOKUM & SK_COMPILED_OUT)
+        void     as_binary(void ** binary_pp, uint32_t top_count);
+        uint32_t as_binary_length(uint32_t top_count);
+      #endif
+
+    // AObjReusePoolObserver Methods
+
+      virtual void on_pool_allocate(const void * pool_p, uint32_t object_size) override;
+      virtual void on_pool_recycle(const void * pool_p, uint32_t object_size, uint32_t count) override;
+
+    // AAppInfoCore Methods - forwarded to m_app_info_p
+
+      virtual uint32_t get_pool_init_datum() const override       { return m_app_info_p->get_pool_init_datum(); }
+      virtual uint32_t get_pool_incr_datum() const override       { return m_app_info_p->get_pool_incr_datum(); }
+      virtual uint32_t get_pool_init_string_ref() const override  { return m_app_info_p->get_pool_init_string_ref(); }
+      virtual uint32_t get_pool_incr_string_ref() const override  { return m_app_info_p->get_pool_incr_string_ref(); }
+      virtual uint32_t get_pool_init_symbol_ref() const override  { return m_app_info_p->get_pool_init_symbol_ref(); }
+      virtual uint32_t get_pool_incr_symbol_ref() const override  { return m_app_info_p->get_pool_incr_symbol_ref(); }
+
+      virtual void *   malloc(size_t size, const char * debug_name_p) override;
+      virtual void     free(void * mem_p) override;
+      virtual uint32_t request_byte_size(uint32_t size_requested) override  { return m_app_info_p->request_byte_size(size_requested); }
+      virtual bool     is_using_fixed_size_pools() override                 { return m_app_info_p->is_using_fixed_size_pools(); }
+
+      virtual void               debug_print(const char * cstr_p) override  { m_app_info_p->debug_print(cstr_p); }
+      virtual AErrorOutputBase * on_error_pre(bool nested) override         { return m_app_info_p->on_error_pre(nested); }
+      virtual void               on_error_post(eAErrAction action) override { m_app_info_p->on_error_post(action); }
+      virtual void               on_error_quit() override                   { m_app_info_p->on_error_quit(); }
+
+    // Data Members
+
+      // App interface that was installed before enable() - nullptr while disabled
+      AAppInfoCore * m_app_info_p;
+
+      // Set while the profiler itself is working so that allocations it causes (such as
+      // symbol reference counts or print buffers) are not counted.
+      bool m_busy_b;
+
+      uint32_t m_frame_count;
+
+      SkAllocCounts  m_total;
+      SkAllocRoutine m_outside;
+      SkAllocRoutine m_overflow;
+
+      // Open addressed by invokable address - only the first m_routine_count are in use
+      SkAllocRoutine m_routines[SkAllocProfiler_routine_slots];
+      uint32_t       m_routine_count;
+
+      SkAllocPool m_pools[SkAllocProfiler_pool_max];
+      uint32_t    m_pool_count;
+
+    };
+
+  SkAllocHook g_hook;
+
+  //---------------------------------------------------------------------------------------
+  // Slot for `invokable_p` - Fibonacci hashing of the address
+  inline uint32_t routine_slot(const SkInvokableBase * invokable_p)
+    {
+    return uint32_t((uint64_t(uintptr_t(invokable_p) >> 3u) * UINT64_C(0x9E3779B97F4A7C15)) >> 54u) & (SkAllocProfiler_routine_slots - 1u);
+    }
+
+  //---------------------------------------------------------------------------------------
+  // Returns display name of `routine`
+  AString routine_name(const SkAllocRoutine & routine)
+    {
+    if (routine.m_invokable_p == nullptr)
+      {
+      return (&routine == &g_hook.m_outside) ? "[outside scripts]" : "[overflow]";
+      }
+
+    AString name(ASymbol::create_existing(routine.m_class_name_id).as_str_dbg(), 16u);
+
+    name.append('@');
+    name.append(ASymbol::create_existing(routine.m_name_id).as_str_dbg());
+    name.append("()", 2u);
+
+    if (routine.m_member_bits & SkMemberInfo::ByteFlag_class_member)
+      {
+      name.append('C');
+      }
+
+    if (routine.m_member_bits & SkMemberInfo::ByteFlag_closure)
+      {
+      name.append(" [closure]", 10u);
+      }
+
+    return name;
+    }
+
+} // End unnamed namespace
+
+
+//=======================================================================================
+// SkAllocHook Method Definitions
+//=======================================================================================
+
+//---------------------------------------------------------------------------------------
+// Puts the hook in front of the app's AgogCore interface and starts observing pools
+void SkAllocHook::install()
+  {
+  m_app_info_p = AgogCore::get_app_info();
+  AgogCore::set_app_info(this);
+  AObjReusePoolObserver::ms_observer_p = this;
+
+  // Give the known pools their names
+  name_pool(&SkInstance::get_pool(),          "SkInstance",          uint32_t(sizeof(SkInstance)));
+  name_pool(&SkDataInstance::get_pool(),      "SkDataInstance",      uint32_t(sizeof(SkDataInstance)));
+  name_pool(&SkInvokedExpression::get_pool(), "SkInvokedExpression", uint32_t(sizeof(SkInvokedExpression)));
+  name_pool(&SkInvokedCoroutine::get_pool(),  "SkInvokedCoroutine",  uint32_t(sizeof(SkInvokedCoroutine)));
+  name_pool(&AStringRef::get_pool(),          "AStringRef",          uint32_t(sizeof(AStringRef)));
+  name_pool(&ASymbolRef::get_pool(),          "ASymbolRef",          uint32_t(sizeof(ASymbolRef)));
+  }
+
+//---------------------------------------------------------------------------------------
+// Restores the app's AgogCore interface and stops observing pools
+void SkAllocHook::uninstall()
+  {
+  if (AObjReusePoolObserver::ms_observer_p == this)
+    {
+    AObjReusePoolObserver::ms_observer_p = nullptr;
+    }
+
+  // Leave alone if the app replaced its interface in the meantime
+  if (AgogCore::get_app_info() == this)
+    {
+    AgogCore::set_app_info(m_app_info_p);
+    }
+
+  m_app_info_p = nullptr;
+  }
+
+//---------------------------------------------------------------------------------------
+// Clears all counts - pool names are kept
+void SkAllocHook::reset()
+  {
+  m_frame_count = 0u;
+  m_total.clear();
+
+  m_outside.m_invokable_p = nullptr;
+  m_outside.m_counts.clear();
+  m_overflow.m_invokable_p = nullptr;
+  m_overflow.m_counts.clear();
+
+  ::memset(m_routines, 0, sizeof(m_routines));
+  m_routine_count = 0u;
+
+  SkAllocPool * pool_p     = m_pools;
+  SkAllocPool * pool_end_p = m_pools + m_pool_count;
+
+  for (; pool_p < pool_end_p; pool_p++)
+    {
+    pool_p->m_allocs    = 0u;
+    pool_p->m_recycles  = 0u;
+    pool_p->m_live      = 0;
+    pool_p->m_peak_live = 0;
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+void SkAllocHook::name_pool(const void * pool_p, const char * name_p, uint32_t object_size)
+  {
+  SkAllocPool * pool_info_p = get_pool(pool_p, object_size);
+
+  if (pool_info_p)
+    {
+    pool_info_p->m_name_p = name_p;
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Returns entry of the routine currently running - adding it if it is new
+SkAllocRoutine * SkAllocHook::get_routine()
+  {
+  SkInvokedContextBase * context_p = SkDebug::ms_current_call_p;
+
+  if (context_p == nullptr)
+    {
+    return &m_outside;
+    }
+
+  const SkInvokableBase * invokable_p = context_p->get_invokable();
+
+  if (invokable_p == nullptr)
+    {
+    return &m_outside;
+    }
+
+  uint32_t         slot      = routine_slot(invokable_p);
+  SkAllocRoutine * routine_p = &m_routines[slot];
+
+  while (routine_p->m_invokable_p)
+    {
+    if (routine_p->m_invokable_p == invokable_p)
+      {
+      return routine_p;
+      }
+
+    slot      = (slot + 1u) & (SkAllocProfiler_routine_slots - 1u);
+    routine_p = &m_routines[slot];
+    }
+
+  if (m_routine_count >= SkAllocProfiler_routine_max)
+    {
+    return &m_overflow;
+    }
+
+  // New routine - note its member identity
+  SkMemberInfo              member_info;
+  const SkClosureInfoBase * closure_info_p = invokable_p->get_closure_info();
+
+  if (closure_info_p)
+    {
+    closure_info_p->get_member_info(&member_info);
+    }
+  else
+    {
+    member_info.m_member_id   = *invokable_p;
+    member_info.m_type        = invokable_p->get_member_type();
+    member_info.m_class_scope = invokable_p->is_class_member();
+    }
+
+  routine_p->m_invokable_p   = invokable_p;
+  routine_p->m_class_name_id = member_info.get_class() ? member_info.get_class()->get_name().get_id() : ASymbol_id_null;
+  routine_p->m_name_id       = member_info.m_member_id.get_name().get_id();
+  routine_p->m_member_bits   = uint8_t(member_info.m_type)
+    | (member_info.m_class_scope ? uint8_t(SkMemberInfo::ByteFlag_class_member) : 0u)
+    | (member_info.m_is_closure ? uint8_t(SkMemberInfo::ByteFlag_closure) : 0u);
+  m_routine_count++;
+
+  return routine_p;
+  }
+
+//---------------------------------------------------------------------------------------
+// Returns entry of the pool at `pool_p` - adding it if it is new - or nullptr if the pool
+// table is full
+SkAllocPool * SkAllocHook::get_pool(const void * pool_p, uint32_t object_size)
+  {
+  SkAllocPool * pool_info_p = m_pools;
+  SkAllocPool * pool_end_p  = m_pools + m_pool_count;
+
+  for (; pool_info_p < pool_end_p; pool_info_p++)
+    {
+    if (pool_info_p->m_pool_p == pool_p)
+      {
+      return pool_info_p;
+      }
+    }
+
+  if (m_pool_count >= SkAllocProfiler_pool_max)
+    {
+    return nullptr;
+    }
+
+  ::memset(pool_info_p, 0, sizeof(SkAllocPool));
+  pool_info_p->m_pool_p      = pool_p;
+  pool_info_p->m_object_size = object_size;
+  m_pool_count++;
+
+  return pool_info_p;
+  }
+
+//---------------------------------------------------------------------------------------
+void SkAllocHook::on_pool_allocate(const void * pool_p, uint32_t object_size)
+  {
+  if (m_busy_b)
+    {
+    return;
+    }
+
+  m_busy_b = true;
+
+  SkAllocPool * pool_info_p = get_pool(pool_p, object_size);
+
+  if (pool_info_p)
+    {
+    pool_info_p->m_allocs++;
+
+    if (++pool_info_p->m_live > pool_info_p->m_peak_live)
+      {
+      pool_info_p->m_peak_live = pool_info_p->m_live;
+      }
+    }
+
+  SkAllocCounts & counts = get_routine()->m_counts;
+
+  counts.m_pool_allocs++;
+  counts.count_alloc(m_frame_count);
+  m_total.m_pool_allocs++;
+  m_total.count_alloc(m_frame_count);
+
+  m_busy_b = false;
+  }
+
+//---------------------------------------------------------------------------------------
+void SkAllocHook::on_pool_recycle(const void * pool_p, uint32_t object_size, uint32_t count)
+  {
+  if (m_busy_b)
+    {
+    return;
+    }
+
+  m_busy_b = true;
+
+  SkAllocPool * pool_info_p = get_pool(pool_p, object_size);
+
+  if (pool_info_p)
+    {
+    pool_info_p->m_recycles += count;
+    pool_info_p->m_live     -= int32_t(count);
+    }
+
+  get_routine()->m_counts.m_pool_recycles += count;
+  m_total.m_pool_recycles += count;
+
+  m_busy_b = false;
+  }
+
+//---------------------------------------------------------------------------------------
+void * SkAllocHook::malloc(size_t size, const char * debug_name_p)
+  {
+  void * mem_p = m_app_info_p->malloc(size, debug_name_p);
+
+  if (!m_busy_b)
+    {
+    m_busy_b = true;
+
+    SkAllocCounts & counts = get_routine()->m_counts;
+
+    counts.m_mallocs++;
+    counts.m_malloc_bytes += size;
+    counts.count_alloc(m_frame_count);
+    m_total.m_mallocs++;
+    m_total.m_malloc_bytes += size;
+    m_total.count_alloc(m_frame_count);
+
+    m_busy_b = false;
+    }
+
+  return mem_p;
+  }
+
+//---------------------------------------------------------------------------------------
+void SkAllocHook::free(void * mem_p)
+  {
+  m_app_info_p->free(mem_p);
+
+  if (mem_p && !m_busy_b)
+    {
+    m_busy_b = true;
+
+    get_routine()->m_counts.m_frees++;
+    m_total.m_frees++;
+
+    m_busy_b = false;
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Fills `top_a` with up to `top_count` routines with the most allocations - most first.
+// Returns number of routines stored.
+uint32_t SkAllocHook::get_top(const SkAllocRoutine ** top_a, uint32_t top_count) const
+  {
+  // Nothing to rank - and the full list test below needs at least one entry
+  if (top_count == 0u)
+    {
+    return 0u;
+    }
+
+  uint32_t count = 0u;
+  uint32_t idx;
+  uint32_t allocs;
+
+  const SkAllocRoutine * routine_p     = m_routines;
+  const SkAllocRoutine * routine_end_p = m_routines + SkAllocProfiler_routine_slots;
+
+  for (; routine_p < routine_end_p; routine_p++)
+    {
+    allocs = routine_p->m_counts.get_allocs();
+
+    if ((routine_p->m_invokable_p == nullptr) || (allocs == 0u))
+      {
+      continue;
+      }
+
+    if ((count == top_count) && (allocs <= top_a[count - 1u]->m_counts.get_allocs()))
+      {
+      continue;
+      }
+
+    // Insertion into the sorted list
+    idx = (count < top_count) ? count++ : count - 1u;
+
+    while (idx && (top_a[idx - 1u]->m_counts.get_allocs() < allocs))
+      {
+      top_a[idx] = top_a[idx - 1u];
+      idx--;
+      }
+
+    top_a[idx] = routine_p;
+    }
+
+  return count;
+  }
+
+//---------------------------------------------------------------------------------------
+void SkAllocHook::print(uint32_t top_count)
+  {
+  m_busy_b = true;
+
+  ADebug::print_format(
+    "\n\n"
+    "================================================================================\n"
+    "Skookum Runtime Allocation Profile - %u frame(s)\n"
+    "================================================================================\n\n",
+    m_frame_count);
+
+  if (m_app_info_p == nullptr)
+    {
+    ADebug::print("  [Profiler is disabled - enable with Debug.enable_memory_profile()]\n\n");
+    }
+
+  #if !defined(AORPOOL_OBSERVER)
+    ADebug::print("  [Pool allocations are not observed in this build (AORPOOL_OBSERVER).]\n\n");
+  #endif
+
+  ADebug::print(
+    " Pool                 |   Size |   Allocs | Recycles |     Live | Peak Live\n"
+    "----------------------+--------+----------+----------+----------+-----------\n");
+
+  SkAllocPool * pool_p     = m_pools;
+  SkAllocPool * pool_end_p = m_pools + m_pool_count;
+
+  for (; pool_p < pool_end_p; pool_p++)
+    {
+    ADebug::print_format(
+      " %-20s | %6u | %8u | %8u | %8d | %9d\n",
+      pool_p->m_name_p ? pool_p->m_name_p : "[other]",
+      pool_p->m_object_size,
+      pool_p->m_allocs,
+      pool_p->m_recycles,
+      pool_p->m_live,
+      pool_p->m_peak_live);
+    }
+
+  const SkAllocRoutine * top_a[SkAllocProfiler_top_max + 2u];
+  uint32_t               count = get_top(top_a, a_min(top_count, SkAllocProfiler_top_max));
+
+  top_a[count++] = &m_outside;
+
+  if (m_overflow.m_counts.get_allocs())
+    {
+    top_a[count++] = &m_overflow;
+    }
+
+  ADebug::print(
+    "\n"
+    " Pool Allocs |   Mallocs | Malloc Bytes | Last Frame | Peak Frame | Routine\n"
+    "-------------+-----------+--------------+------------+------------+--------------------\n");
+
+  for (uint32_t idx = 0u; idx < count; idx++)
+    {
+    const SkAllocCounts & counts = top_a[idx]->m_counts;
+
+    ADebug::print_format(
+      " %11u | %9u | %12llu | %10u | %10u | %s\n",
+      counts.m_pool_allocs,
+      counts.m_mallocs,
+      (unsigned long long)counts.m_malloc_bytes,
+      counts.get_last_frame_allocs(m_frame_count),
+      counts.m_peak_frame_allocs,
+      routine_name(*top_a[idx]).as_cstr());
+    }
+
+  ADebug::print_format(
+    "\n  Total: %u pool allocs, %u mallocs (%llu bytes), %u routines\n"
+    "  Per frame: %u allocs last frame, %u allocs peak frame\n",
+    m_total.m_pool_allocs,
+    m_total.m_mallocs,
+    (unsigned long long)m_total.m_malloc_bytes,
+    m_routine_count,
+    m_total.get_last_frame_allocs(m_frame_count),
+    m_total.m_peak_frame_allocs);
+
+  m_busy_b = false;
+  }
+
+#if (SKOOKUM & SK_COMPILED_OUT)
+
+//---------------------------------------------------------------------------------------
+// See SkAllocProfiler::as_binary()
+void SkAllocHook::as_binary(void ** binary_pp, uint32_t top_count)
+  {
+  m_busy_b = true;
+
+  //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  // Totals
+
+  // 1 byte - enabled
+  uint8_t enabled = m_app_info_p != nullptr;
+  A_BYTE_STREAM_OUT8(binary_pp, &enabled);
+
+  // 4 bytes - frame count
+  A_BYTE_STREAM_OUT32(binary_pp, &m_frame_count);
+
+  // 4 bytes - pool allocs
+  // 4 bytes - pool recycles
+  // 4 bytes - mallocs
+  // 4 bytes - frees
+  // 8 bytes - malloc bytes
+  // 4 bytes - last frame allocs
+  // 4 bytes - peak frame allocs
+  uint32_t last_frame_allocs = m_total.get_last_frame_allocs(m_frame_count);
+  A_BYTE_STREAM_OUT32(binary_pp, &m_total.m_pool_allocs);
+  A_BYTE_STREAM_OUT32(binary_pp, &m_total.m_pool_recycles);
+  A_BYTE_STREAM_OUT32(binary_pp, &m_total.m_mallocs);
+  A_BYTE_STREAM_OUT32(binary_pp, &m_total.m_frees);
+  A_BYTE_STREAM_OUT64(binary_pp, &m_total.m_malloc_bytes);
+  A_BYTE_STREAM_OUT32(binary_pp, &last_frame_allocs);
+  A_BYTE_STREAM_OUT32(binary_pp, &m_total.m_peak_frame_allocs);
+
+  //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  // Pools
+
+  // 1 byte - pool count
+  uint8_t pool_count = uint8_t(m_pool_count);
+  A_BYTE_STREAM_OUT8(binary_pp, &pool_count);
+
+  SkAllocPool * pool_p     = m_pools;
+  SkAllocPool * pool_end_p = m_pools + m_pool_count;
+
+  for (; pool_p < pool_end_p; pool_p++)
+    {
+    // 1 byte  - name length (0 if not a known pool)
+    // n bytes - name characters
+    uint8_t name_length = pool_p->m_name_p ? uint8_t(::strlen(pool_p->m_name_p)) : 0u;
+    A_BYTE_STREAM_OUT8(binary_pp, &name_length);
+
+    if (name_length)
+      {
+      ::memcpy(*binary_pp, pool_p->m_name_p, name_length);
+      *binary_pp = static_cast<uint8_t *>(*binary_pp) + name_length;
+      }
+
+    // 4 bytes - object size
+    // 4 bytes - allocs
+    // 4 bytes - recycles
+    // 4 bytes - live
+    // 4 bytes - peak live
+    A_BYTE_STREAM_OUT32(binary_pp, &pool_p->m_object_size);
+    A_BYTE_STREAM_OUT32(binary_pp, &pool_p->m_allocs);
+    A_BYTE_STREAM_OUT32(binary_pp, &pool_p->m_recycles);
+    A_BYTE_STREAM_OUT32(binary_pp, &pool_p->m_live);
+    A_BYTE_STREAM_OUT32(binary_pp, &pool_p->m_peak_live);
+    }
+
+  //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  // Routines - most allocations first then outside scripts and overflow
+
+  const SkAllocRoutine * top_a[SkAllocProfiler_top_max + 2u];
+  uint32_t               count = get_top(top_a, a_min(top_count, SkAllocProfiler_top_max));
+
+  top_a[count++] = &m_outside;
+  top_a[count++] = &m_overflow;
+
+  // 2 bytes - routine count
+  uint16_t routine_count = uint16_t(count);
+  A_BYTE_STREAM_OUT16(binary_pp, &routine_count);
+
+  for (uint32_t idx = 0u; idx < count; idx++)
+    {
+    const SkAllocRoutine * routine_p = top_a[idx];
+    const SkAllocCounts &  counts    = routine_p->m_counts;
+
+    // 1 byte - eSkAllocEntry
+    uint8_t kind = routine_p->m_invokable_p
+      ? uint8_t(SkAllocEntry_routine)
+      : uint8_t((routine_p == &m_outside) ? SkAllocEntry_outside : SkAllocEntry_overflow);
+    A_BYTE_STREAM_OUT8(binary_pp, &kind);
+
+    if (kind == SkAllocEntry_routine)
+      {
+      // 9 bytes - member info - same layout as SkMemberInfo::as_binary()
+      A_BYTE_STREAM_OUT32(binary_pp, &routine_p->m_class_name_id);
+      A_BYTE_STREAM_OUT32(binary_pp, &routine_p->m_name_id);
+      A_BYTE_STREAM_OUT8(binary_pp, &routine_p->m_member_bits);
+      }
+
+    // 4 bytes - pool allocs
+    // 4 bytes - pool recycles
+    // 4 bytes - mallocs
+    // 4 bytes - frees
+    // 8 bytes - malloc bytes
+    // 4 bytes - last frame allocs
+    // 4 bytes - peak frame allocs
+    last_frame_allocs = counts.get_last_frame_allocs(m_frame_count);
+    A_BYTE_STREAM_OUT32(binary_pp, &counts.m_pool_allocs);
+    A_BYTE_STREAM_OUT32(binary_pp, &counts.m_pool_recycles);
+    A_BYTE_STREAM_OUT32(binary_pp, &counts.m_mallocs);
+    A_BYTE_STREAM_OUT32(binary_pp, &counts.m_frees);
+    A_BYTE_STREAM_OUT64(binary_pp, &counts.m_malloc_bytes);
+    A_BYTE_STREAM_OUT32(binary_pp, &last_frame_allocs);
+    A_BYTE_STREAM_OUT32(binary_pp, &counts.m_peak_frame_allocs);
+    }
+
+  m_busy_b = false;
+  }
+
+//---------------------------------------------------------------------------------------
+// See SkAllocProfiler::as_binary_length()
+uint32_t SkAllocHook::as_binary_length(uint32_t top_count)
+  {
+  const uint32_t counts_length = 32u;
+  uint32_t       length        = 1u + 4u + counts_length + 1u + 2u;
+
+  SkAllocPool * pool_p     = m_pools;
+  SkAllocPool * pool_end_p = m_pools + m_pool_count;
+
+  for (; pool_p < pool_end_p; pool_p++)
+    {
+    length += 1u + (pool_p->m_name_p ? uint32_t(::strlen(pool_p->m_name_p)) : 0u) + 20u;
+    }
+
+  // Same ranking as as_binary() - none if top_count is 0
+  const SkAllocRoutine * top_a[SkAllocProfiler_top_max];
+  uint32_t               count = get_top(top_a, a_min(top_count, SkAllocProfiler_top_max));
+
+  // Ranked routines plus outside scripts and overflow
+  return length + (count * (1u + 9u + counts_length)) + (2u * (1u + counts_length));
+  }
+
+#endif  // (SKOOKUM & SK_COMPILED_OUT)
+
+
+//=======================================================================================
+// SkAllocProfiler Class Method Definitions
+//=======================================================================================
+
+//---------------------------------------------------------------------------------------
+// Starts or stops counting allocations.  Counts are kept when stopped so they can still
+// be printed - starting again continues from them, call reset() to start over.
+void SkAllocProfiler::enable(
+  bool enable_b // = true
+  )
+  {
+  if (enable_b == is_enabled())
+    {
+    return;
+    }
+
+  if (enable_b)
+    {
+    g_hook.install();
+    }
+  else
+    {
+    g_hook.uninstall();
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+bool SkAllocProfiler::is_enabled()
+  {
+  return g_hook.m_app_info_p != nullptr;
+  }
+
+//---------------------------------------------------------------------------------------
+// Clears all counts - called when the program is unloaded since the routines that the
+// counts refer to go away with it.
+void SkAllocProfiler::reset()
+  {
+  g_hook.reset();
+  }
+
+//---------------------------------------------------------------------------------------
+// Ends the current frame for the per frame counts - called by SkMind::update_all()
+void SkAllocProfiler::on_frame_end()
+  {
+  if (is_enabled())
+    {
+    g_hook.m_frame_count++;
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Number of frames counted since the profiler was first enabled or reset
+uint32_t SkAllocProfiler::get_frame_count()
+  {
+  return g_hook.m_frame_count;
+  }
+
+//---------------------------------------------------------------------------------------
+// Prints pool counts and the `top_count` routines with the most allocations to the log
+void SkAllocProfiler::print(
+  uint32_t top_count // = 20u
+  )
+  {
+  g_hook.print(top_count);
+  }
+
+#if (SKOOKUM & SK_COMPILED_OUT)
+
+//---------------------------------------------------------------------------------------
+// Fills memory pointed to by binary_pp with the counts and increments binary_pp - used by
+// Command_memory_reply.
+//
+// Binary composition:
+//   1 byte  - enabled
+//   4 bytes - frame count
+//  32 bytes - totals                   - see counts below
+//   1 byte  - pool count
+//   1 byte  - name length          \
+//   n bytes - name characters      |
+//   4 bytes - object size          |
+//   4 bytes - allocs               |_ Repeating
+//   4 bytes - recycles             |
+//   4 bytes - live                 |
+//   4 bytes - peak live            /
+//   2 bytes - routine count
+//   1 byte  - entry kind           \
+//   9 bytes - member info (if kind |_ Repeating - up to top_count routines with the most
+//             is a routine)        |  allocations then outside scripts and overflow
+//  32 bytes - counts               /
+//
+// Counts:
+//   4 bytes - pool allocs
+//   4 bytes - pool recycles
+//   4 bytes - mallocs
+//   4 bytes - frees
+//   8 bytes - malloc bytes
+//   4 bytes - allocs in last frame
+//   4 bytes - allocs in peak frame
+void SkAllocProfiler::as_binary(void ** binary_pp, uint32_t top_count)
+  {
+  A_SCOPED_BINARY_SIZE_SANITY_CHECK(binary_pp, SkAllocProfiler::as_binary_length(top_count));
+
+  g_hook.as_binary(binary_pp, top_count);
+  }
+
+//---------------------------------------------------------------------------------------
+uint32_t SkAllocProfiler::as_binary_length(uint32_t top_count)
+  {
+  return g_hook.as_binary_length(top_count);
+  }
+
+#endif  // (SKOOKUM & SK_COMPILED_OUT)
+
+#endif  // (SKOOKUM & SK_DEBUG)
@@ -18,6 +18,19 @@
 #include <SkookumScript/SkSymbolDefs.hpp>
 
 
+//=======================================================================================
+// Local Global Structures
+//=======================================================================================
+
+namespace
+{
+
+  // Reused instances for false and true - see SkBoolean::new_instance()
+  SkInstanceCache s_cached_booleans[2];
+
+} // End unnamed namespace
+
+
 //=======================================================================================
 // Method Definitions
 //=======================================================================================
@@ -204,3 +217,22 @@ SkClass * SkBoolean::get_class()
   return ms_class_p;
   }
 
+//---------------------------------------------------------------------------------------
+// Returns a Boolean instance set to value - reusing the cached instance for the value if
+// nothing else is using it.
+// See:       SkInstanceCache
+// Modifiers: static
+SkInstance * SkBoolean::new_instance(tSkBoolean value)
+  {
+  return s_cached_booleans[value ? 1 : 0].new_instance<SkBoolean>(value);
+  }
+
+//---------------------------------------------------------------------------------------
+// Lets go of the reused instances - called when the class hierarchy is torn down
+// Modifiers: static
+void SkBoolean::release_cached_instances()
+  {
+  s_cached_booleans[0].release();
+  s_cached_booleans[1].release();
+  }
+
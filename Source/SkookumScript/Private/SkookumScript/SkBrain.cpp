@@ -36,6 +36,7 @@
 #include <SkookumScript/SkMind.hpp>
 #include <SkookumScript/SkNone.hpp>
 #include <SkookumScript/SkObject.hpp>
+#include <SkookumScript/SkOptimizer.hpp>
 #include <SkookumScript/SkRandom.hpp>
 #include <SkookumScript/SkReal.hpp>
 #include <SkookumScript/SkRemoteRuntimeBase.hpp>
@@ -54,7 +55,7 @@ namespace
   // Looks like "CBC0DE" in file - i.e. compiled binary code
   const uint32_t SkBrain_bin_code_id_type = 0x00DEC0CB;
   // Version between 0 and 255 (should be safe to cycle back to 0 once 255 is passed)
-  const uint32_t SkBrain_bin_code_id_version = 61u;
+  const uint32_t SkBrain_bin_code_id_version = 64u;
 
   // Bits to shift for version code id
   const uint32_t SkBrain_bin_code_id_version_shift = 24u;
@@ -200,23 +201,27 @@ bool SkBrain::is_class_present(const ASymbol & class_name)
 //
 //   Binary composition:
 //     4 bytes - SkookumScript compiled binary code id
+//     4 bytes - byte offset of class members (number of classes excluding demand loaded)
 //     4 bytes - folder checksum from source scripts
 //     4 bytes - file checksum from source scripts
 //     4 bytes - bytes needed for linear allocation of hierarchy
 //     4 bytes - optional additional debug bytes needed for linear allocation of hierarchy
-//     4 bytes - number of classes (including demand loaded)
+//   1-5 bytes - number of classes (including demand loaded)
 //     n bytes - class hierarchy placeholders   }- Repeating & Recursive
 //     4 bytes - startup mind class id
-//     4 bytes - number of typed classes
-//     4 bytes - number of invokable classes
+//   1-5 bytes - number of typed classes
+//   1-5 bytes - number of invokable classes
 //     4 bytes - number of class unions
 //     n bytes - class union binary             }- Repeating
 //     n bytes - typed class binary             }- Repeating
 //     n bytes - invokable class binary         }- Repeating
 //     4 bytes - number of classes (excluding demand loaded)
+//     4 bytes - class record end offset        }- Repeating index
 //     n bytes - SkClass or SkActorClass binary }- Repeating
 //
-//   $Note - CReis This could be packed more
+//   Counts that are usually small are variable length (LEB128) - see
+//   A_BYTE_STREAM_OUT_VAR32().  The fixed width index lets a streamed load know where
+//   each class record ends before reading it.
 //   
 // #See Also:  as_binary_length(), assign_binary(binary_pp)
 // #Author(s): Conan Reis
@@ -244,7 +249,14 @@ void SkBrain::as_binary(void ** binary_pp)
 
   //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
   // 4 bytes - SkookumScript compiled binary code id
-  uint32_t value = SkBrain_bin_code_id;
+  uint8_t * binary_start_p = (uint8_t *)*binary_pp;
+  uint32_t  value          = SkBrain_bin_code_id;
+  A_BYTE_STREAM_OUT32(binary_pp, &value);
+
+  // 4 bytes - byte offset of class members - filled in once known so a streamed load
+  // knows how much must be read before everything preceding the class members is ready
+  value = 0u;
+  uint32_t * members_offset_p = (uint32_t *)*binary_pp;
   A_BYTE_STREAM_OUT32(binary_pp, &value);
 
   //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
@@ -284,9 +296,8 @@ void SkBrain::as_binary(void ** binary_pp)
   // Step #1 - The class hierarchy is written first so that calls to get_class() will
   // work during the construction of class unions, methods, coroutines, etc.
 
-  // 4 bytes - number of classes (including demand loaded)
-  length = ms_classes.get_length();
-  A_BYTE_STREAM_OUT32(binary_pp, &length);
+  // 1-5 bytes - number of classes (including demand loaded)
+  A_BYTE_STREAM_OUT_VAR32(binary_pp, ms_classes.get_length());
 
   // n bytes - class hierarchy placeholder }- Repeating & Recursive
   ms_object_class_p->as_binary_placeholder_recurse(binary_pp);
@@ -298,18 +309,16 @@ void SkBrain::as_binary(void ** binary_pp)
   //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
   // Step #2a - The number of common/shared type classes are written next so that array
   // buffer size will be the correct, etc.  Note that typed classes may reference each other.
-  // 4 bytes - number of typed classes
-  length = SkTypedClass::ms_typed_classes.get_length();
-  A_BYTE_STREAM_OUT32(binary_pp, &length);
+  // 1-5 bytes - number of typed classes
+  A_BYTE_STREAM_OUT_VAR32(binary_pp, SkTypedClass::ms_typed_classes.get_length());
 
 
   //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
   // Step #3a - The number of common/shared invokable classes are written next so that
   // references (which are an index into this common list) will be able to resolve.  Note
   // that even invokable classes may reference each other.
-  // 4 bytes - number of invokable classes
-  length = SkInvokableClass::ms_shared_classes.get_length();
-  A_BYTE_STREAM_OUT32(binary_pp, &length);
+  // 1-5 bytes - number of invokable classes
+  A_BYTE_STREAM_OUT_VAR32(binary_pp, SkInvokableClass::ms_shared_classes.get_length());
 
 
   //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
@@ -335,7 +344,10 @@ void SkBrain::as_binary(void ** binary_pp)
 
   //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
   // Step #5 - The class members are written last.
+  *members_offset_p = uint32_t((uint8_t *)*binary_pp - binary_start_p);
+
   // 4 bytes - number of classes (excluding demand loaded)
+  // 4 bytes - class record end offset        }- Repeating index
   // n bytes - SkClass or SkActorClass binary }- Repeating
   ms_object_class_p->as_binary_group(binary_pp, skip_demand_loaded);
 
@@ -355,30 +367,37 @@ void SkBrain::as_binary(void ** binary_pp)
 // Notes:
 //   Binary composition:
 //     4 bytes - SkookumScript compiled binary code id
+//     4 bytes - byte offset of class members (number of classes excluding demand loaded)
 //     4 bytes - folder checksum from source scripts
 //     4 bytes - file checksum from source scripts
 //     4 bytes - bytes needed for linear allocation of hierarchy
 //     4 bytes - optional additional debug bytes needed for linear allocation of hierarchy
-//     4 bytes - number of classes (including demand loaded)
+//   1-5 bytes - number of classes (including demand loaded)
 //     n bytes - class hierarchy placeholders   }- Repeating & Recursive
 //     4 bytes - startup mind class id
-//     4 bytes - number of typed classes
-//     4 bytes - number of invokable classes
+//   1-5 bytes - number of typed classes
+//   1-5 bytes - number of invokable classes
 //     4 bytes - number of class unions
 //     n bytes - class union binary             }- Repeating
 //     n bytes - typed class binary             }- Repeating
 //     n bytes - invokable class binary         }- Repeating
 //     4 bytes - number of classes (excluding demand loaded)
-//     n bytes - SkClass/SkActorClass members   }- Repeating
+//     4 bytes - class record end offset        }- Repeating index
+//     n bytes - SkClass or SkActorClass binary }- Repeating
 //
 //   Little error checking on binary as it is assumed to have been validated when saved.
 // 
 // See: as_binary(), assign_binary()
 uint32_t SkBrain::as_binary_length()
   {
-  // id(4) + checksums(8) + session_guid(8) + revision(4) + linear size(4) + debug linear size(4) + startup mind class id(4)
-  // + number of classes(4) + number of typed classes(4) + number of invokable classes(4)
-  uint32_t binary_length = 48u;
+  // id(4) + members offset(4) + checksums(8) + session_guid(8) + revision(4) + linear size(4) + debug linear size(4)
+  // + startup mind class id(4)
+  uint32_t binary_length = 40u;
+
+  // 1-5 bytes - number of classes, number of typed classes and number of invokable classes
+  binary_length += A_BYTE_STREAM_VAR32_LENGTH(ms_classes.get_length())
+    + A_BYTE_STREAM_VAR32_LENGTH(SkTypedClass::ms_typed_classes.get_length())
+    + A_BYTE_STREAM_VAR32_LENGTH(SkInvokableClass::ms_shared_classes.get_length());
 
   // n bytes - project debug info
   binary_length += ms_project_name.as_binary_length();
@@ -399,6 +418,7 @@ uint32_t SkBrain::as_binary_length()
   binary_length += SkInvokableClass::ms_shared_classes.as_binary_elems_length();
 
   // 4 bytes - number of classes (excluding demand loaded)
+  // 4 bytes - class record end offset        }- Repeating index
   // n bytes - SkClass or SkActorClass binary }- Repeating
   // Skip demand loaded classes indicated by passing "true"
   binary_length += ms_object_class_p->as_binary_group_length(true);
@@ -422,27 +442,58 @@ uint32_t SkBrain::as_binary_length()
 // Notes:
 //   Binary composition:
 //     4 bytes - SkookumScript compiled binary code id
+//     4 bytes - byte offset of class members (number of classes excluding demand loaded)
 //     4 bytes - folder checksum from source scripts
 //     4 bytes - file checksum from source scripts
 //     4 bytes - bytes needed for linear allocation of hierarchy
 //     4 bytes - optional additional debug bytes needed for linear allocation of hierarchy
-//     4 bytes - number of classes (including demand loaded)
+//   1-5 bytes - number of classes (including demand loaded)
 //     n bytes - class hierarchy placeholders   }- Repeating & Recursive
 //     4 bytes - startup mind class id
-//     4 bytes - number of typed classes
-//     4 bytes - number of invokable classes
+//   1-5 bytes - number of typed classes
+//   1-5 bytes - number of invokable classes
 //     4 bytes - number of class unions
 //     n bytes - class union binary             }- Repeating
 //     n bytes - typed class binary             }- Repeating
 //     n bytes - invokable class binary         }- Repeating
 //     4 bytes - number of classes (excluding demand loaded)
-//     n bytes - SkClass/SkActorClass members   }- Repeating
+//     4 bytes - class record end offset        }- Repeating index
+//     n bytes - SkClass or SkActorClass binary }- Repeating
 //
 //   Little error checking on binary as it is assumed to have been validated when saved.
 //   
 // See:       as_binary(), as_binary_length()
 // Modifiers: static
 void SkBrain::assign_binary(const void ** binary_pp)
+  {
+  // n bytes - everything up to the class members
+  assign_binary_hierarchy(binary_pp);
+
+  //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  // Step #5 - Class Members
+
+  // 4 bytes - number of classes (excluding demand loaded)
+  // 4 bytes - class record end offset        }- Repeating index
+  // n bytes - SkClass or SkActorClass binary }- Repeating
+  SkClass::from_binary_group(binary_pp);
+
+  assign_binary_end();
+  }
+
+//---------------------------------------------------------------------------------------
+// Recreate class hierarchy, shared class unions / typed classes / invokable classes and
+// other info preceding the class members in the supplied binary.
+// 
+// Params:
+//   binary_pp:
+//     Pointer to address to read binary serialization info from and to increment - on
+//     return it points to the class members.  Only the first get_binary_members_offset()
+//     bytes of the binary need to be available.
+//
+// Notes:     Binary composition is described in assign_binary().
+// See:       assign_binary(), assign_binary_end(), SkRuntimeBase::load_compiled_hierarchy()
+// Modifiers: static
+void SkBrain::assign_binary_hierarchy(const void ** binary_pp)
   {
   // 4 bytes - SkookumScript compiled binary code id
   uint32_t id = A_BYTE_STREAM_UI32_INC(binary_pp);
@@ -470,6 +521,9 @@ void SkBrain::assign_binary(const void ** binary_pp)
       }
   #endif
 
+  // 4 bytes - byte offset of class members - only needed by a streamed load so just skip
+  A_BYTE_STREAM_UI32_INC(binary_pp);
+
   // 4 bytes - folder checksum from source scripts
   ms_checksum_folders = A_BYTE_STREAM_UI32_INC(binary_pp);
 
@@ -508,8 +562,8 @@ void SkBrain::assign_binary(const void ** binary_pp)
   //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
   // Step #1 - Class Hierarchy
 
-  // 4 bytes - number of classes (including demand loaded)
-  uint32_t class_count = A_BYTE_STREAM_UI32_INC(binary_pp);
+  // 1-5 bytes - number of classes (including demand loaded)
+  uint32_t class_count = A_BYTE_STREAM_UI32_VAR_INC(binary_pp);
 
   ms_classes.ensure_size(class_count);
 
@@ -527,8 +581,8 @@ void SkBrain::assign_binary(const void ** binary_pp)
   //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
   // Step #2a - Typed Classes (count)
 
-  // 4 bytes - number of typed classes
-  uint32_t tclass_count = A_BYTE_STREAM_UI32_INC(binary_pp);
+  // 1-5 bytes - number of typed classes
+  uint32_t tclass_count = A_BYTE_STREAM_UI32_VAR_INC(binary_pp);
 
   SkTypedClass::ms_typed_classes.set_size(tclass_count, tclass_count);
 
@@ -557,8 +611,8 @@ void SkBrain::assign_binary(const void ** binary_pp)
   //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
   // Step #3a - Invokable Classes (count)
 
-  // 4 bytes - number of invokable classes
-  uint32_t iclass_count = A_BYTE_STREAM_UI32_INC(binary_pp);
+  // 1-5 bytes - number of invokable classes
+  uint32_t iclass_count = A_BYTE_STREAM_UI32_VAR_INC(binary_pp);
 
   SkInvokableClass::ms_shared_classes.set_size(iclass_count, iclass_count);
 
@@ -637,16 +691,35 @@ void SkBrain::assign_binary(const void ** binary_pp)
     }
 
 
-  //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-  // Step #5 - Class Members
+  }
 
-  // 4 bytes - number of classes (excluding demand loaded)
-  // n bytes - SkClass or SkActorClass binary }- Repeating
-  SkClass::from_binary_group(binary_pp);
+//---------------------------------------------------------------------------------------
+// Signals that the whole compiled binary has been loaded - i.e. after
+// assign_binary_hierarchy() and the class members.
+// 
+// See:       assign_binary(), SkRuntimeBase::load_compiled_hierarchy()
+// Modifiers: static
+void SkBrain::assign_binary_end()
+  {
+  SkookumScript::notify_script_linear_bytes(0u);
+  }
 
+//---------------------------------------------------------------------------------------
+// Determines where the class members start in the supplied class hierarchy binary - i.e.
+// how much of it assign_binary_hierarchy() needs.
+// 
+// Params:
+//   binary_p: binary with at least its first Binary_header_size bytes available
+//   
+// Returns:   byte offset of the class members from the start of the binary
+// See:       is_binary_valid()
+// Modifiers: static
+uint32_t SkBrain::get_binary_members_offset(const void * binary_p)
+  {
+  // Skip compiled binary code id
+  binary_p = (const uint8_t *)binary_p + 4u;
 
-  //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-  SkookumScript::notify_script_linear_bytes(0u);
+  return A_BYTE_STREAM_UI32(binary_p);
   }
 
 //---------------------------------------------------------------------------------------
@@ -1184,6 +1257,9 @@ void SkBrain::initialize_post_load()
   // Resolve raw data for all classes if a callback function is given
   SkBrain::ms_object_class_p->resolve_raw_data_recurse();
 
+  // Simplify script routines now that the built-in methods that they call are known
+  SkOptimizer::optimize_class_recurse(SkBrain::ms_object_class_p);
+
   SkInstance::initialize_post_load();
 
   //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
@@ -1219,10 +1295,15 @@ void SkBrain::deinitialize_classes()
 // Delete the program = remove all classes, data and routines
 void SkBrain::deinitialize_program()
   {
+  // Reused value instances refer to the classes about to be freed
+  SkBoolean::release_cached_instances();
+  SkInteger::release_cached_instances();
+
   // Empty classes before they are freed so that other class destructors can still refer
   // to them.
   ms_classes.apply_method(&SkClass::clear_members);
 
+  SkClassUnion::shared_flush_merges();  // Must be before any class descriptors are freed
   SkInvokableClass::shared_pre_empty();
   SkParameters::shared_empty();      // Must be after SkInvokableClass::shared_pre_empty()
   SkTypedClass::shared_pre_empty();
@@ -1294,6 +1375,9 @@ void SkBrain::compact(bool purge_deleted_members)
       }
     }
 
+  // Memoized class merges hold references to the classes they merged
+  SkClassUnion::shared_flush_merges();
+
   // Rinse & repeat until all cross references are resolved
   bool anything_changed;
   do
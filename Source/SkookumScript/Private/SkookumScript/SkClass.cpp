@@ -487,11 +487,16 @@ SkClass::SkClass(
   m_bind_name(AString::ms_empty),
   m_raw_member_accessor_f(nullptr),
   m_raw_pointer_f(nullptr),
+  m_raw_pod_size(0u),
+  m_payload_size(0u),
   m_object_id_lookup_f(nullptr),
   m_object_id_lookup_p(nullptr),
+  m_object_id_generation(0u),
+  m_object_id_generation_all(0u),
   m_object_ids_p(nullptr),
   m_total_data_count(0),
   m_destructor_p(nullptr),
+  m_pending_method_funcs_p(nullptr),
   m_total_class_data_count(0),
   m_user_data(0),
   m_user_data_int(0)
@@ -585,6 +590,7 @@ void SkClass::clear_members()
   m_class_methods.free_all();
 
   m_coroutines.free_all();
+  clear_pending_method_funcs();
 
   m_vtable_i.empty();
   m_vtable_c.empty();
@@ -627,6 +633,7 @@ void SkClass::clear_members_compact()
 
   m_coroutines.free_all();
   m_coroutines.empty_compact();
+  clear_pending_method_funcs();
 
   m_flags &= ~(Flag_loaded | Flag_demand_unload);
   m_destructor_p = nullptr;
@@ -1139,13 +1146,13 @@ SkClass::object_id_validate_recurse(
 //               2 bytes - number of class data members 
 //               4 bytes - class data member name id \_ Repeating
 //               5*bytes - class type                /
-//               4 bytes - number of methods
+//             1-5 bytes - number of methods
 //               1 byte  - method type   \_ Repeating
 //               n bytes - method binary /
-//               4 bytes - number of class methods
+//             1-5 bytes - number of class methods
 //               1 byte  - method type         \_ Repeating
 //               n bytes - class method binary /
-//               4 bytes - number of coroutines
+//             1-5 bytes - number of coroutines
 //               1 byte  - coroutine type   \_Repeating
 //               n bytes - coroutine binary /
 //
@@ -1156,8 +1163,6 @@ void SkClass::as_binary(void ** binary_pp, bool include_routines) const
   {
   A_SCOPED_BINARY_SIZE_SANITY_CHECK(binary_pp, SkClass::as_binary_length(include_routines));
 
-  uint32_t ** data_pp = (uint32_t **)binary_pp;
-
   // 4 bytes - name id
   m_name.as_binary(binary_pp);
 
@@ -1220,10 +1225,9 @@ void SkClass::as_binary(void ** binary_pp, bool include_routines) const
   if (include_routines)
     {
     //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-    // 4 bytes - number of methods
+    // 1-5 bytes - number of methods
     length = m_methods.get_length();
-    **data_pp = length;
-    (*data_pp)++;
+    A_BYTE_STREAM_OUT_VAR32(binary_pp, length);
 
 
     // 1 byte  - method type   \_Repeating
@@ -1243,10 +1247,9 @@ void SkClass::as_binary(void ** binary_pp, bool include_routines) const
 
 
     //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-    // 4 bytes - number of class methods
+    // 1-5 bytes - number of class methods
     length = m_class_methods.get_length();
-    **data_pp = length;
-    (*data_pp)++;
+    A_BYTE_STREAM_OUT_VAR32(binary_pp, length);
 
     // 1 byte  - method type         \_Repeating
     // n bytes - class method binary /
@@ -1265,10 +1268,9 @@ void SkClass::as_binary(void ** binary_pp, bool include_routines) const
 
 
     //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-    // 4 bytes - number of coroutines
+    // 1-5 bytes - number of coroutines
     length = m_coroutines.get_length();
-    **data_pp = length;
-    (*data_pp)++;
+    A_BYTE_STREAM_OUT_VAR32(binary_pp, length);
 
     // 1 byte  - coroutine type   \_Repeating
     // n bytes - coroutine binary /
@@ -1305,19 +1307,21 @@ void SkClass::as_binary(void ** binary_pp, bool include_routines) const
 //               2 bytes - number of class data members 
 //               4 bytes - class data member name id \_ Repeating
 //               5*bytes - class type                /
-//               4 bytes - number of methods
+//             1-5 bytes - number of methods
 //               1 byte  - method type   \_ Repeating
 //               n bytes - method binary /
-//               4 bytes - number of class methods
+//             1-5 bytes - number of class methods
 //               1 byte  - method type         \_ Repeating
 //               n bytes - class method binary /
-//               4 bytes - number of coroutines
+//             1-5 bytes - number of coroutines
 //               1 byte  - coroutine type   \_Repeating
 //               n bytes - coroutine binary /
 // Author(s):   Conan Reis
 uint32_t SkClass::as_binary_length(bool include_routines) const
   {
-  uint32_t binary_length = include_routines ? 22u : 10u;
+  // name id(4) + number of data members(2) + number of raw data members(2)
+  // + number of class data members(2)
+  uint32_t binary_length = 10u;
   uint32_t length;
 
   //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
@@ -1362,6 +1366,12 @@ uint32_t SkClass::as_binary_length(bool include_routines) const
 
   if (include_routines)
     {
+    //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+    // 1-5 bytes - number of methods, class methods and coroutines
+    binary_length += A_BYTE_STREAM_VAR32_LENGTH(m_methods.get_length())
+      + A_BYTE_STREAM_VAR32_LENGTH(m_class_methods.get_length())
+      + A_BYTE_STREAM_VAR32_LENGTH(m_coroutines.get_length());
+
     //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
     // 1 byte  - method type   \_Repeating
     // n bytes - method binary /
@@ -1402,39 +1412,31 @@ uint32_t SkClass::as_binary_length(bool include_routines) const
   }
 
 //---------------------------------------------------------------------------------------
-// Fills memory pointed to by binary_pp with the information needed to
-//             recursively recreate a class and its components and increments the memory
-//             address to just past the last byte written.  Only non-demand loaded classes
-//             are written out at this phase.
-// Arg         binary_pp - Pointer to address to fill and increment.  Its size *must* be
-//             large enough to fit all the binary data.  Use the get_binary_length()
-//             method to determine the size needed prior to passing binary_pp to this
-//             method.
-// Examples:   Called by as_binary()
-// See:        as_binary_recurse_length()
-// Author(s):   Conan Reis
-void SkClass::as_binary_recurse(
-  void ** binary_pp,
-  bool    skip_demand_loaded
-  ) const
+// Appends this class and its subclasses to classes_p in breadth first order - i.e. all
+// the classes at one depth of the hierarchy before any of the classes at the next depth.
+// Optionally skips demand loaded classes along with their subclasses.
+// 
+// Notes:  Superclasses always come before their subclasses and the shallow core classes
+//         (Object, Integer, List, Mind, etc.) come before the deep engine hierarchies.
+// See:    as_binary_group()
+void SkClass::get_class_breadth_first(APArray<SkClass> * classes_p, bool skip_demand_loaded) const
   {
-  if (!skip_demand_loaded || !is_demand_loaded())
+  if (skip_demand_loaded && is_demand_loaded())
     {
-    // Write out binary for 'class_p'
-    as_binary(binary_pp);
+    return;
+    }
 
-    uint32_t length = m_subclasses.get_length();
+  uint32_t idx = classes_p->get_length();
 
-    // Write out binary for subclasses of 'class_p' if any
-    if (length)
-      {
-      SkClass ** classes_pp     = m_subclasses.get_array();
-      SkClass ** classes_end_pp = classes_pp + length;
+  classes_p->append(*const_cast<SkClass *>(this));
 
-      // n bytes - SkClass or SkActorClass binary }- Repeating
-      for (; classes_pp < classes_end_pp; classes_pp++)
+  for (; idx < classes_p->get_length(); idx++)
+    {
+    for (SkClass * subclass_p : classes_p->get_at(idx)->m_subclasses)
+      {
+      if (!skip_demand_loaded || !subclass_p->is_demand_loaded())
         {
-        (*classes_pp)->as_binary_recurse(binary_pp, skip_demand_loaded);
+        classes_p->append(*subclass_p);
         }
       }
     }
@@ -1452,8 +1454,8 @@ uint32_t SkClass::as_binary_recurse_length(bool skip_demand_loaded) const
 
   if (!skip_demand_loaded || !is_demand_loaded())
     {
-    // Write out binary for 'class_p'
-    bytes = as_binary_length();
+    // 4 bytes - index entry + binary for 'class_p'
+    bytes = Binary_group_index_entry_size + as_binary_length();
 
     uint32_t sub_count = m_subclasses.get_length();
 
@@ -1475,13 +1477,20 @@ uint32_t SkClass::as_binary_recurse_length(bool skip_demand_loaded) const
   }
 
 //---------------------------------------------------------------------------------------
-// Just like as_binary_recurse() except that it first writes out the number
-//             of classes that are being written out.
+// Writes out this class and its subclasses preceded by the number of classes that are
+// being written out and an index of where each class record is.
 // Arg         binary_pp - Pointer to address to fill and increment.  Its size *must* be
 //             large enough to fit all the binary data.  Use the get_binary_group_length()
 //             method to determine the size needed prior to passing binary_pp to this
 //             method.
 // See:        as_binary_group_length(), from_binary_group()
+// Notes:      Binary composition:
+//               4 bytes - number of classes
+//               4 bytes - offset of record end from records start }- Repeating index
+//               n bytes - SkClass or SkActorClass binary          }- Repeating
+//
+//             The index is fixed width so the extent of a class record is known before
+//             any of it is read - see SkRuntimeBase::load_compiled_hierarchy_stream().
 // Author(s):   Conan Reis
 void SkClass::as_binary_group(
   void ** binary_pp,
@@ -1497,7 +1506,27 @@ void SkClass::as_binary_group(
 
   if (class_count)
     {
-    as_binary_recurse(binary_pp, skip_demand_loaded);
+    // Written breadth first so a streamed load can start on the core classes while the
+    // bytes for the rest are still arriving - see SkRuntimeBase::load_compiled_hierarchy()
+    APArray<SkClass> classes;
+
+    classes.ensure_size(class_count);
+    get_class_breadth_first(&classes, skip_demand_loaded);
+
+    // 4 bytes - offset of record end from records start }- Repeating index
+    uint32_t record_end = 0u;
+
+    for (SkClass * class_p : classes)
+      {
+      record_end += class_p->as_binary_length();
+      A_BYTE_STREAM_OUT32(binary_pp, &record_end);
+      }
+
+    // n bytes - SkClass or SkActorClass binary }- Repeating
+    for (SkClass * class_p : classes)
+      {
+      class_p->as_binary(binary_pp);
+      }
     }
   }
 
@@ -1630,13 +1659,13 @@ void SkClass::as_binary_ref(void ** binary_pp) const
 //               2 bytes - number of class data members 
 //               4 bytes - class data member name id \_ Repeating
 //               5*bytes - class type                /
-//               4 bytes - number of methods
+//             1-5 bytes - number of methods
 //               1 byte  - method type   \_ Repeating
 //               n bytes - method binary /
-//               4 bytes - number of class methods
+//             1-5 bytes - number of class methods
 //               1 byte  - method type         \_ Repeating
 //               n bytes - class method binary /
-//               4 bytes - number of coroutines
+//             1-5 bytes - number of coroutines
 //               1 byte  - coroutine type   \_Repeating
 //               n bytes - coroutine binary /
 //
@@ -1710,8 +1739,8 @@ void SkClass::assign_binary(
     {
     //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
     // Instance methods
-    // 4 bytes - number of methods
-    length = A_BYTE_STREAM_UI32_INC(binary_pp);
+    // 1-5 bytes - number of methods
+    length = A_BYTE_STREAM_UI32_VAR_INC(binary_pp);
     m_methods.ensure_size(length);
     for (; length > 0u; length--)
       {
@@ -1726,8 +1755,8 @@ void SkClass::assign_binary(
 
     //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
     // Class methods
-    // 4 bytes - number of class methods
-    length = A_BYTE_STREAM_UI32_INC(binary_pp);
+    // 1-5 bytes - number of class methods
+    length = A_BYTE_STREAM_UI32_VAR_INC(binary_pp);
     m_class_methods.ensure_size(length);
     for (; length > 0u; length--)
       {
@@ -1737,8 +1766,8 @@ void SkClass::assign_binary(
 
     //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
     // Coroutines
-    // 4 bytes - number of coroutines
-    length = A_BYTE_STREAM_UI32_INC(binary_pp);
+    // 1-5 bytes - number of coroutines
+    length = A_BYTE_STREAM_UI32_VAR_INC(binary_pp);
     m_coroutines.ensure_size(length);
     for (; length > 0u; length--)
       {
@@ -1750,6 +1779,82 @@ void SkClass::assign_binary(
   set_loaded();
   }
 
+//---------------------------------------------------------------------------------------
+// Determines whether the data member portion of a class binary (as read by
+// assign_binary() with include_routines = false) describes exactly the data members this
+// class already has - so a live update can skip reparsing and re-resolving them.
+// 
+// Returns: true if all instance, raw and class data members match in order
+// 
+// Params:
+//   binary_pp:
+//     Pointer to address to read binary serialization info from and to increment -
+//     always advanced past the whole data member section whether it matches or not.
+bool SkClass::is_data_binary_same(const void ** binary_pp) const
+  {
+  bool same_b = true;
+  ASymbol name;
+
+  //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  // 2 bytes - number of data members 
+  // 4 bytes - data member name id \_ Repeating
+  // 5*bytes - class type          /
+  uint32_t length = A_BYTE_STREAM_UI16_INC(binary_pp);
+
+  same_b = same_b && (length == m_data.get_length());
+
+  for (uint32_t idx = 0u; idx < length; idx++)
+    {
+    name = ASymbol::create_from_binary(binary_pp);
+    ARefPtr<SkClassDescBase> type_p = from_binary_ref_typed(binary_pp);
+
+    same_b = same_b
+      && (name == m_data[idx]->get_name())
+      && (type_p->compare(*m_data[idx]->m_type_p) == AEquate_equal);
+    }
+
+  //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  // 2 bytes - number of raw data members 
+  // 4 bytes - data member name id \
+  // 5*bytes - class type          |_ Repeating
+  // n*bytes - bind name           /
+  length = A_BYTE_STREAM_UI16_INC(binary_pp);
+
+  same_b = same_b && (length == m_data_raw.get_length());
+
+  for (uint32_t idx = 0u; idx < length; idx++)
+    {
+    name = ASymbol::create_from_binary(binary_pp);
+    ARefPtr<SkClassDescBase> type_p = from_binary_ref_typed(binary_pp);
+    AString bind_name(SkBindName(binary_pp).as_string());
+
+    same_b = same_b
+      && (name == m_data_raw[idx]->get_name())
+      && (type_p->compare(*m_data_raw[idx]->m_type_p) == AEquate_equal)
+      && (bind_name == m_data_raw[idx]->m_bind_name.as_string());
+    }
+
+  //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  // 2 bytes - number of class data members 
+  // 4 bytes - class data member name id \_ Repeating
+  // 5*bytes - class type                /
+  length = A_BYTE_STREAM_UI16_INC(binary_pp);
+
+  same_b = same_b && (length == m_class_data.get_length());
+
+  for (uint32_t idx = 0u; idx < length; idx++)
+    {
+    name = ASymbol::create_from_binary(binary_pp);
+    ARefPtr<SkClassDescBase> type_p = from_binary_ref_typed(binary_pp);
+
+    same_b = same_b
+      && (name == m_class_data[idx]->get_name())
+      && (type_p->compare(*m_class_data[idx]->m_type_p) == AEquate_equal);
+    }
+
+  return same_b;
+  }
+
 //---------------------------------------------------------------------------------------
 // Returns pointer to class based on the binary reference info or nullptr if not
 //             found
@@ -1771,6 +1876,28 @@ SkClass * SkClass::from_binary_ref(const void ** binary_pp)
   return SkBrain::get_class(ASymbol::create_from_binary(binary_pp));
   }
 
+//---------------------------------------------------------------------------------------
+// Loads the members of a single class record as written by as_binary_group().
+// Returns:    class that was loaded
+// Arg         binary_pp - Pointer to address to read binary serialization info from and
+//             to increment.
+// Notes:      Binary composition:
+//               n bytes - SkClass or SkActorClass binary
+//
+//             The extent of each record is in the index preceding the records - see
+//             get_binary_record_end().
+// See:        from_binary_group(), SkRuntimeBase::load_compiled_hierarchy()
+// Modifiers:   static
+SkClass * SkClass::from_binary_record(const void ** binary_pp)
+  {
+  // n bytes - SkClass or SkActorClass binary
+  SkClass * class_p = SkClass::from_binary_ref(binary_pp);
+
+  class_p->assign_binary(binary_pp);
+
+  return class_p;
+  }
+
 //---------------------------------------------------------------------------------------
 // Loads some number of classes stored as a binary.
 // Arg         binary_pp - Pointer to address to read binary serialization info from and
@@ -1781,20 +1908,31 @@ SkClass * SkClass::from_binary_ref(const void ** binary_pp)
 // Author(s):   Conan Reis
 void SkClass::from_binary_group(const void ** binary_pp)
   {
+  const uint8_t * group_p = (const uint8_t *)*binary_pp;
+
   // 4 bytes - number of classes (excluding demand loaded)
   uint32_t class_count = A_BYTE_STREAM_UI32_INC(binary_pp);
 
+  // 4 bytes - index entry }- Repeating - just skip since the records are read in order
+  const uint8_t * records_p = group_p + get_binary_records_offset(class_count);
+
+  *binary_pp = records_p;
+
   // n bytes - SkClass or SkActorClass binary }- Repeating
   #if (SKOOKUM & SK_DEBUG)
     SkExpressionBase::set_new_expr_debug_info(SkDebugInfo::Flag__default_source);
   #endif
 
-  SkClass * class_p;
-
-  for (; class_count > 0u ; class_count--)
+  for (uint32_t idx = 0u; idx < class_count; idx++)
     {
-    class_p = SkClass::from_binary_ref(binary_pp);
-    class_p->assign_binary(binary_pp);
+    #if (SKOOKUM & SK_DEBUG)
+      SkClass * class_p = from_binary_record(binary_pp);
+      uint32_t  record_end = get_binary_record_end(group_p, idx);
+
+      SK_ASSERTX((const uint8_t *)*binary_pp - records_p == (ptrdiff_t)record_end, a_str_format("Inconsistent binary length of class '%s' (expected end: %u, actual end: %d)!", class_p->get_name_cstr_dbg(), record_end, int((const uint8_t *)*binary_pp - records_p)));
+    #else
+      from_binary_record(binary_pp);
+    #endif
     }
 
   #if (SKOOKUM & SK_DEBUG)
@@ -2909,6 +3047,12 @@ void SkClass::set_raw_data_resolved(bool is_resolved)
   if (is_resolved)
     {
     m_flags |= Flag_raw_resolved;
+
+    // Now that offsets and sizes are known, pick direct copies where possible
+    for (auto typed_p : m_data_raw)
+      {
+      typed_p->resolve_raw_pod();
+      }
     }
   else
     {
@@ -2924,6 +3068,7 @@ bool SkClass::resolve_raw_data(const ASymbol & name, tSkRawDataInfo raw_data_inf
   if (m_data_raw.find(name, AMatch_first_found, &idx))
     {
     m_data_raw[idx]->m_raw_data_info = raw_data_info;
+    m_data_raw[idx]->resolve_raw_pod();
     return true;
     }
   SK_ERRORX(a_str_format("Cound not resolve data member '%s@%s'", get_name_cstr_dbg(), name.as_cstr_dbg()));
@@ -2945,7 +3090,7 @@ void SkClass::resolve_raw_data()
     {
     if ((*ms_raw_resolve_f)(this))
       {
-      m_flags |= Flag_raw_resolved;
+      set_raw_data_resolved(true);
       }
     }
   }
@@ -2960,7 +3105,7 @@ void SkClass::resolve_raw_data_recurse()
       {
       if ((*ms_raw_resolve_f)(this))
         {
-        m_flags |= Flag_raw_resolved;
+        set_raw_data_resolved(true);
         }
       }
 
@@ -3288,6 +3433,9 @@ SkClass * SkClass::next_sibling() const
 
 void SkClass::remove_subclass(SkClass * subclass_p)
   {
+  // Merges of classes below here may no longer be valid
+  SkClassUnion::shared_flush_merges();
+
   // Unlink from hierarchy
   m_subclasses.remove(*subclass_p);
   subclass_p->m_superclass_p = nullptr;
@@ -3720,6 +3868,135 @@ void SkClass::register_method_func_bulk(const MethodInitializerFuncId * bindings
     }
   }
 
+//---------------------------------------------------------------------------------------
+// Remembers a table of method bindings without registering it yet. The whole table gets
+// registered via register_pending_method_funcs() the first time an unbound atomic method
+// of this class is invoked - so classes whose atomic methods are never called by any
+// script never pay for the symbol look-ups and method swaps.
+// 
+// Params:
+//   bindings_p: must stay valid while pending - generally a static table
+//   
+// Notes:  Registering the same table again while still pending is ignored so bindings
+//         can be re-registered safely after a reload of the compiled binaries.
+// See:    register_method_func_bulk()
+void SkClass::register_method_func_bulk_deferred(const MethodInitializerFunc * bindings_p, uint32_t count, eSkBindFlag flags)
+  {
+  for (PendingMethodFuncs * pending_p = m_pending_method_funcs_p; pending_p; pending_p = pending_p->m_next_p)
+    {
+    if (pending_p->m_bindings_p == bindings_p)
+      {
+      return;
+      }
+    }
+
+  m_pending_method_funcs_p = new PendingMethodFuncs{ bindings_p, count, flags, m_pending_method_funcs_p };
+  }
+
+//---------------------------------------------------------------------------------------
+// Registers all method binding tables deferred via register_method_func_bulk_deferred()
+// Returns: true if any bindings were registered
+bool SkClass::register_pending_method_funcs()
+  {
+  if (!m_pending_method_funcs_p)
+    {
+    return false;
+    }
+
+  // Detach list first so registering cannot recurse into it
+  PendingMethodFuncs * pending_p = m_pending_method_funcs_p;
+  m_pending_method_funcs_p = nullptr;
+
+  // Register in the order the tables were deferred
+  PendingMethodFuncs * reversed_p = nullptr;
+  while (pending_p)
+    {
+    PendingMethodFuncs * next_p = pending_p->m_next_p;
+    pending_p->m_next_p = reversed_p;
+    reversed_p = pending_p;
+    pending_p = next_p;
+    }
+
+  while (reversed_p)
+    {
+    PendingMethodFuncs *          next_p         = reversed_p->m_next_p;
+    eSkBindFlag                   flags          = reversed_p->m_flags;
+    const MethodInitializerFunc * bindings_p     = reversed_p->m_bindings_p;
+    const MethodInitializerFunc * bindings_end_p = bindings_p + reversed_p->m_count;
+
+    for (; bindings_p < bindings_end_p; ++bindings_p)
+      {
+      ASymbol        method_name = ASymbol::create_existing(bindings_p->m_method_name_p);
+      SkMethodBase * method_p    = (flags & SkBindFlag__class)
+        ? m_class_methods.get(method_name)
+        : m_methods.get(method_name);
+
+      // Bindings registered directly in the meantime were registered later than this
+      // table would have been had it not been deferred - so they take precedence.
+      if (method_p && !method_p->is_bound())
+        {
+        register_method_func(method_name, bindings_p->m_atomic_f, flags);
+        }
+      }
+
+    delete reversed_p;
+    reversed_p = next_p;
+    }
+
+  return true;
+  }
+
+//---------------------------------------------------------------------------------------
+// Returns: number of method bindings deferred via register_method_func_bulk_deferred()
+//          that have not been needed yet
+uint32_t SkClass::get_pending_method_func_count() const
+  {
+  uint32_t count = 0u;
+
+  for (PendingMethodFuncs * pending_p = m_pending_method_funcs_p; pending_p; pending_p = pending_p->m_next_p)
+    {
+    count += pending_p->m_count;
+    }
+
+  return count;
+  }
+
+//---------------------------------------------------------------------------------------
+// Returns: true if a binding for the given method is deferred and not registered yet
+// Notes:   Linear search - intended for sanity checks rather than at runtime
+bool SkClass::is_method_func_pending(const ASymbol & method_name, bool is_class_member) const
+  {
+  for (PendingMethodFuncs * pending_p = m_pending_method_funcs_p; pending_p; pending_p = pending_p->m_next_p)
+    {
+    if (((pending_p->m_flags & SkBindFlag__class) != 0u) != is_class_member)
+      {
+      continue;
+      }
+
+    for (uint32_t i = 0u; i < pending_p->m_count; ++i)
+      {
+      if (ASymbol::create_existing(pending_p->m_bindings_p[i].m_method_name_p) == method_name)
+        {
+        return true;
+        }
+      }
+    }
+
+  return false;
+  }
+
+//---------------------------------------------------------------------------------------
+// Forgets all deferred method binding tables without registering them
+void SkClass::clear_pending_method_funcs()
+  {
+  while (m_pending_method_funcs_p)
+    {
+    PendingMethodFuncs * next_p = m_pending_method_funcs_p->m_next_p;
+    delete m_pending_method_funcs_p;
+    m_pending_method_funcs_p = next_p;
+    }
+  }
+
 //---------------------------------------------------------------------------------------
 // Associates a number of methods with their C++ binding
 // See:   register_method_mthd
@@ -4129,6 +4406,7 @@ SkTypedNameRaw * SkClass::append_instance_data_raw(const ASymbol & name, SkClass
       if (old_typed_p)
         {
         typed_p->m_raw_data_info = old_typed_p->m_raw_data_info;
+        typed_p->resolve_raw_pod();
         delete old_typed_p;
         }
       }
@@ -4593,7 +4871,8 @@ void SkClass::find_unregistered_atomics(APArray<SkInvokableBase> * atomics_p)
     {
     method_p = *methods_pp;
 
-    if (!method_p->is_bound() && !method_p->is_placeholder() && (method_p->get_invoke_type() != SkInvokable_method) && !(method_p->get_annotation_flags() & SkAnnotation_ue4_blueprint))
+    if (!method_p->is_bound() && !method_p->is_placeholder() && (method_p->get_invoke_type() != SkInvokable_method) && !(method_p->get_annotation_flags() & SkAnnotation_ue4_blueprint)
+      && !is_method_func_pending(method_p->get_name(), false))
       {
       atomics_p->append(*method_p);
       }
@@ -4608,7 +4887,8 @@ void SkClass::find_unregistered_atomics(APArray<SkInvokableBase> * atomics_p)
     {
     method_p = *methods_pp;
 
-    if (!method_p->is_bound() && !method_p->is_placeholder() && (method_p->get_invoke_type() != SkInvokable_method) && !(method_p->get_annotation_flags() & SkAnnotation_ue4_blueprint))
+    if (!method_p->is_bound() && !method_p->is_placeholder() && (method_p->get_invoke_type() != SkInvokable_method) && !(method_p->get_annotation_flags() & SkAnnotation_ue4_blueprint)
+      && !is_method_func_pending(method_p->get_name(), true))
       {
       atomics_p->append(*method_p);
       }
@@ -4673,6 +4953,55 @@ void SkClass::find_inaccessible_raw_members(APArray<SkRawMemberRecord> * raw_mem
 // Class union objects that are shared amongst various data-structures
 APSortedLogicalFree<SkClassUnion> SkClassUnion::ms_shared_unions;
 
+// Hashed look-up in front of ms_shared_unions
+SkInternCache<SkClassUnion> SkClassUnion::ms_intern_cache;
+
+namespace
+{
+
+  //---------------------------------------------------------------------------------------
+  // Memoized result of SkClassUnion::get_merge(class1, class2) - the classes are ordered
+  // by address since merging is commutative.  Entries hold a reference to all three so
+  // none of them can be freed (and their address reused) while memoized.
+  struct SkMergeMemo
+    {
+    const SkClassDescBase * m_class1_p;
+    const SkClassDescBase * m_class2_p;
+    SkClassDescBase *       m_merge_p;
+    };
+
+  // Number of memo slots - must be a power of 2
+  const uint32_t SkMergeMemo_slot_count = 512u;
+
+  SkMergeMemo SkClassUnion_merge_memos[SkMergeMemo_slot_count];
+
+  //---------------------------------------------------------------------------------------
+  // Returns memo slot for the (ordered) class pair
+  inline SkMergeMemo & merge_memo_slot(const SkClassDescBase * class1_p, const SkClassDescBase * class2_p)
+    {
+    // Descriptors are at least pointer aligned so the low bits carry no information
+    uintptr_t hash = (uintptr_t(class1_p) >> 4u) * 31u + (uintptr_t(class2_p) >> 4u);
+
+    return SkClassUnion_merge_memos[uint32_t(hash ^ (hash >> 9u)) & (SkMergeMemo_slot_count - 1u)];
+    }
+
+  //---------------------------------------------------------------------------------------
+  // Releases the references held by a memo and empties it
+  inline void merge_memo_clear(SkMergeMemo * memo_p)
+    {
+    if (memo_p->m_merge_p)
+      {
+      memo_p->m_class1_p->dereference_delay();
+      memo_p->m_class2_p->dereference_delay();
+      memo_p->m_merge_p->dereference_delay();
+      memo_p->m_class1_p = nullptr;
+      memo_p->m_class2_p = nullptr;
+      memo_p->m_merge_p  = nullptr;
+      }
+    }
+
+} // End unnamed namespace
+
 
 //=======================================================================================
 // SkClassUnion Method Definitions
@@ -5251,6 +5580,16 @@ SkClassDescBase * SkClassUnion::get_merge(
   const SkClassDescBase & class2
   )
   {
+  // Type checking merges the same few pairs over and over so try the memo first
+  const SkClassDescBase * class1_p = (&class1 < &class2) ? &class1 : &class2;
+  const SkClassDescBase * class2_p = (&class1 < &class2) ? &class2 : &class1;
+  SkMergeMemo &           memo     = merge_memo_slot(class1_p, class2_p);
+
+  if (memo.m_merge_p && (memo.m_class1_p == class1_p) && (memo.m_class2_p == class2_p))
+    {
+    return memo.m_merge_p;
+    }
+
   SkClassDescBase * type_p;
   SkClassUnion      class_union(class1);
 
@@ -5271,6 +5610,15 @@ SkClassDescBase * SkClassUnion::get_merge(
   class1.dereference_delay();
   class2.dereference_delay();
 
+  // Memoize - replacing whatever merge shared the slot
+  merge_memo_clear(&memo);
+  class1_p->reference();
+  class2_p->reference();
+  type_p->reference();
+  memo.m_class1_p = class1_p;
+  memo.m_class2_p = class2_p;
+  memo.m_merge_p  = type_p;
+
   return type_p;
   }
 
@@ -5375,6 +5723,9 @@ bool SkClassUnion::shared_ensure_references()
   {
   bool anything_changed = false;
 
+  // Memoized merges hold references so they would keep otherwise unused unions alive
+  shared_flush_merges();
+
   SkClassUnion ** union_pp     = ms_shared_unions.get_array();
   SkClassUnion ** union_end_pp = union_pp + ms_shared_unions.get_length();
 
@@ -5394,6 +5745,11 @@ bool SkClassUnion::shared_ensure_references()
       }
     }
 
+  if (anything_changed)
+    {
+    ms_intern_cache.flush();
+    }
+
   // If empty, get rid of memory
   if (ms_shared_unions.is_empty())
     {
@@ -5403,6 +5759,31 @@ bool SkClassUnion::shared_ensure_references()
   return anything_changed;
   }
 
+//---------------------------------------------------------------------------------------
+// Forgets all memoized get_merge() results and releases their references.  Must be called
+// before any class descriptors are freed and whenever the class hierarchy is rearranged.
+// Modifiers:   static
+void SkClassUnion::shared_flush_merges()
+  {
+  SkMergeMemo * memo_p     = SkClassUnion_merge_memos;
+  SkMergeMemo * memo_end_p = memo_p + SkMergeMemo_slot_count;
+
+  for (; memo_p < memo_end_p; memo_p++)
+    {
+    merge_memo_clear(memo_p);
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Frees all the shared class unions
+// Modifiers:   static
+void SkClassUnion::shared_empty()
+  {
+  shared_flush_merges();
+  ms_intern_cache.flush();
+  ms_shared_unions.free_all();
+  }
+
 //---------------------------------------------------------------------------------------
 // Tracks memory used by this class of object
 // See:        SkDebug, AMemoryStats
@@ -5464,3 +5845,59 @@ SkClassUpdateRecord * SkProgramUpdateRecord::get_or_create_class_update_record(c
 
   return class_p;
   }
+
+#if (SKOOKUM & SK_DEBUG)
+
+//---------------------------------------------------------------------------------------
+// Iterates over the expressions of the previous versions of live updated routines that
+// are kept alive by this record - i.e. code that may still be running even though it is
+// no longer reachable through the class hierarchy.
+// 
+// Returns AIterateResult_early_exit if iteration stopped/aborted early or
+// AIterateResult_entire if full iteration performed.
+// 
+// See Also  SkApplyExpressionBase, SkClass::iterate_expressions_recurse()
+eAIterateResult SkProgramUpdateRecord::iterate_expressions(SkApplyExpressionBase * apply_expr_p)
+  {
+  SkClassUpdateRecord ** classes_pp     = m_updated_classes.get_array();
+  SkClassUpdateRecord ** classes_end_pp = classes_pp + m_updated_classes.get_length();
+
+  for (; classes_pp < classes_end_pp; classes_pp++)
+    {
+    SkRoutineUpdateRecord ** routines_pp     = (*classes_pp)->m_updated_routines.get_array();
+    SkRoutineUpdateRecord ** routines_end_pp = routines_pp + (*classes_pp)->m_updated_routines.get_length();
+
+    for (; routines_pp < routines_end_pp; routines_pp++)
+      {
+      SkRoutineUpdateRecord * routine_record_p = *routines_pp;
+
+      if (routine_record_p->m_previous_routine_p)
+        {
+        // Whole routine was replaced or deleted
+        if (routine_record_p->m_previous_routine_p->iterate_expressions(apply_expr_p))
+          {
+          return AIterateResult_early_exit;
+          }
+        }
+      else
+        {
+        // Routine was updated in place - only its old parameters and body are left over
+        if (routine_record_p->m_previous_params_p
+          && routine_record_p->m_previous_params_p->iterate_expressions(apply_expr_p, routine_record_p->m_routine_p))
+          {
+          return AIterateResult_early_exit;
+          }
+
+        if (routine_record_p->m_previous_custom_expr_p
+          && routine_record_p->m_previous_custom_expr_p->iterate_expressions(apply_expr_p, routine_record_p->m_routine_p))
+          {
+          return AIterateResult_early_exit;
+          }
+        }
+      }
+    }
+
+  return AIterateResult_entire;
+  }
+
+#endif  // (SKOOKUM & SK_DEBUG)
@@ -31,6 +31,7 @@
 #include <SkookumScript/SkInvokedBase.hpp>
 #include <SkookumScript/SkInvokedCoroutine.hpp>
 #include <SkookumScript/SkMind.hpp>
+#include <SkookumScript/SkOptimizer.hpp>
 
 
 //=======================================================================================
@@ -697,6 +698,42 @@ bool SkCode::is_immediate(
   return true;
   }
 
+//---------------------------------------------------------------------------------------
+// Optimizes statements - see SkExpressionBase::optimize().
+// Literal statements other than the last are dropped since their value is never used and
+// a code block left wrapping a single statement without temporaries is replaced by that
+// statement.
+// Modifiers:   virtual - overridden from SkExpressionBase
+SkExpressionBase * SkCode::optimize(const SkOptimizer & optimizer)
+  {
+  optimizer.optimize_array(m_statements.get_array(), m_statements.get_length());
+
+  if (!optimizer.is_flag_set(SkOptimizer::Flag_prune_branches))
+    {
+    return this;
+    }
+
+  uint32_t idx = m_statements.get_length();
+
+  // Last statement is the result so it is always kept
+  while (idx > 1u)
+    {
+    idx--;
+
+    if (m_statements.get_array()[idx - 1u]->get_type() == SkExprType_literal)
+      {
+      m_statements.free(idx - 1u);
+      }
+    }
+
+  if ((m_statements.get_length() == 1u) && m_temp_vars.is_empty())
+    {
+    return m_statements.pop_last();
+    }
+
+  return this;
+  }
+
 //---------------------------------------------------------------------------------------
 // Tracks memory used by this object and its sub-objects
 // See:        SkDebug, AMemoryStats
@@ -1094,6 +1131,16 @@ void SkConcurrentSync::invoke_exit(
     }
   }
 
+//---------------------------------------------------------------------------------------
+// Optimizes sub-expressions - see SkExpressionBase::optimize()
+// Modifiers:   virtual - overridden from SkExpressionBase
+SkExpressionBase * SkConcurrentSync::optimize(const SkOptimizer & optimizer)
+  {
+  optimizer.optimize_array(m_exprs.get_array(), m_exprs.get_length());
+
+  return this;
+  }
+
 //---------------------------------------------------------------------------------------
 // Tracks memory used by this object and its sub-objects
 // See:        SkDebug, AMemoryStats
@@ -1515,6 +1562,16 @@ bool SkConcurrentRace::is_immediate(
   return false;
   }
 
+//---------------------------------------------------------------------------------------
+// Optimizes sub-expressions - see SkExpressionBase::optimize()
+// Modifiers:   virtual - overridden from SkExpressionBase
+SkExpressionBase * SkConcurrentRace::optimize(const SkOptimizer & optimizer)
+  {
+  optimizer.optimize_array(m_exprs.get_array(), m_exprs.get_length());
+
+  return this;
+  }
+
 //---------------------------------------------------------------------------------------
 // Tracks memory used by this object and its sub-objects
 // See:        SkDebug, AMemoryStats
@@ -1772,6 +1829,17 @@ bool SkConcurrentBranch::invoke_iterate(
   return true;
   }
 
+//---------------------------------------------------------------------------------------
+// Optimizes the branched code - see SkExpressionBase::optimize()
+// Modifiers:   virtual - overridden from SkExpressionBase
+SkExpressionBase * SkConcurrentBranch::optimize(const SkOptimizer & optimizer)
+  {
+  // `this` in the branch is the captured receiver - not necessarily the current class
+  SkOptimizer::optimize_routine(m_info_p->get_invokable(), nullptr);
+
+  return this;
+  }
+
 //---------------------------------------------------------------------------------------
 // Tracks memory used by this object and its sub-objects
 // See:        SkDebug, AMemoryStats
@@ -2121,6 +2189,17 @@ bool SkChangeMind::is_immediate(
   return m_expr_p->is_immediate(durational_idx_p);
   }
 
+//---------------------------------------------------------------------------------------
+// Optimizes sub-expressions - see SkExpressionBase::optimize()
+// Modifiers:   virtual - overridden from SkExpressionBase
+SkExpressionBase * SkChangeMind::optimize(const SkOptimizer & optimizer)
+  {
+  optimizer.optimize(&m_mind_p);
+  optimizer.optimize(&m_expr_p);
+
+  return this;
+  }
+
 //---------------------------------------------------------------------------------------
 // Tracks memory used by this object and its sub-objects
 // See:        SkDebug, AMemoryStats
@@ -2416,6 +2495,16 @@ bool SkBind::is_immediate(
   return m_expr_p->is_immediate(durational_idx_p);
   }
 
+//---------------------------------------------------------------------------------------
+// Optimizes sub-expressions - see SkExpressionBase::optimize()
+// Modifiers:   virtual - overridden from SkExpressionBase
+SkExpressionBase * SkBind::optimize(const SkOptimizer & optimizer)
+  {
+  optimizer.optimize(&m_expr_p);
+
+  return this;
+  }
+
 //---------------------------------------------------------------------------------------
 // Tracks memory used by this object and its sub-objects
 // See:        SkDebug, AMemoryStats
@@ -82,12 +82,14 @@ class SkCode : public SkExpressionBase
     const AVCompactArray<ASymbol> & get_temp_vars() const { return m_temp_vars; }
     uint32_t                        get_temp_vars_start_idx() const { return m_temp_vars_start_idx.m_data_idx; }
     SkIndexed *                     get_temp_vars_start_idx_ptr() { return &m_temp_vars_start_idx; }
+    const APCompactArrayFree<SkExpressionBase> & get_statements() const { return m_statements; }
 
     // Overridden from SkExpressionBase
 
     virtual eSkExprType     get_type() const override;
     virtual SkInvokedBase * invoke(SkObjectBase * scope_p, SkInvokedBase * caller_p = nullptr, SkInstance ** result_pp = nullptr) const override;
     virtual bool            is_immediate(uint32_t * durational_idx_p = nullptr) const override;
+    virtual SkExpressionBase * optimize(const SkOptimizer & optimizer) override;
     virtual void            track_memory(AMemoryStats * mem_stats_p) const override;
 
     // Called by SkInvokedExpression
@@ -170,6 +172,7 @@ class SkConcurrentSync : public SkExpressionBase
     virtual SkInvokedBase * invoke(SkObjectBase * scope_p, SkInvokedBase * caller_p = nullptr, SkInstance ** result_pp = nullptr) const override;
     virtual void            invoke_exit(SkInvokedExpression * iexpr_p, SkInvokedExpression * sub_exit_p = nullptr) const override;
     virtual bool            is_immediate(uint32_t * durational_idx_p = nullptr) const override;
+    virtual SkExpressionBase * optimize(const SkOptimizer & optimizer) override;
     virtual void            track_memory(AMemoryStats * mem_stats_p) const override;
 
     // Debugging Methods
@@ -243,6 +246,7 @@ class SkConcurrentRace : public SkExpressionBase
     virtual void            invoke_exit(SkInvokedExpression * iexpr_p, SkInvokedExpression * sub_exit_p = nullptr) const override;
     virtual bool            invoke_iterate(SkInvokedExpression * iexpr_p, SkInstance ** result_pp = nullptr) const override;
     virtual bool            is_immediate(uint32_t * durational_idx_p = nullptr) const override;
+    virtual SkExpressionBase * optimize(const SkOptimizer & optimizer) override;
     virtual void            track_memory(AMemoryStats * mem_stats_p) const override;
 
     // Debugging Methods
@@ -315,6 +319,7 @@ class SkConcurrentBranch : public SkExpressionBase
     virtual eSkExprType     get_type() const override;
     virtual SkInvokedBase * invoke(SkObjectBase * scope_p, SkInvokedBase * caller_p = nullptr, SkInstance ** result_pp = nullptr) const override;
     virtual bool            invoke_iterate(SkInvokedExpression * iexpr_p, SkInstance ** result_pp = nullptr) const override;
+    virtual SkExpressionBase * optimize(const SkOptimizer & optimizer) override;
     virtual void            track_memory(AMemoryStats * mem_stats_p) const override;
 
     // Debugging Methods
@@ -386,6 +391,7 @@ class SkChangeMind : public SkExpressionBase
     virtual bool            invoke_iterate(SkInvokedExpression * iexpr_p, SkInstance ** result_pp = nullptr) const override;
     virtual void            on_abort(SkInvokedExpression * iexpr_p) const override;
     virtual bool            is_immediate(uint32_t * durational_idx_p = nullptr) const override;
+    virtual SkExpressionBase * optimize(const SkOptimizer & optimizer) override;
     virtual void            track_memory(AMemoryStats * mem_stats_p) const override;
 
     // Debugging Methods
@@ -456,6 +462,7 @@ class SkBind : public SkExpressionBase
     virtual eSkExprType     get_type() const override;
     virtual SkInvokedBase * invoke(SkObjectBase * scope_p, SkInvokedBase * caller_p = nullptr, SkInstance ** result_pp = nullptr) const override;
     virtual bool            is_immediate(uint32_t * durational_idx_p = nullptr) const override;
+    virtual SkExpressionBase * optimize(const SkOptimizer & optimizer) override;
     virtual void            track_memory(AMemoryStats * mem_stats_p) const override;
 
     // Debugging Methods
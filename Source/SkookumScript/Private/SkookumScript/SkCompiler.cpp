@@ -0,0 +1,987 @@
+// Copyright 1998-2019 Epic Games, Inc. All Rights Reserved.
+
+//=======================================================================================
+// SkookumScript C++ library.
+//
+// Headless compiler - builds a program from script sources without the IDE
+//=======================================================================================
+
+
+//=======================================================================================
+// Includes
+//=======================================================================================
+
+#include <SkookumScript/Sk.hpp> // Always include Sk.hpp first (as some builds require a designated precompiled header)
+#include <SkookumScript/SkCompiler.hpp>
+
+#if (SKOOKUM & SK_CODE_IN) && (SKOOKUM & SK_COMPILED_OUT)
+
+#include <AgogCore/AChecksum.hpp>
+#include <AgogCore/ASymbolTable.hpp>
+#include <SkookumScript/SkBrain.hpp>
+#include <SkookumScript/SkClass.hpp>
+#include <SkookumScript/SkCoroutine.hpp>
+#include <SkookumScript/SkMethod.hpp>
+#include <SkookumScript/SkParameters.hpp>
+#include <SkookumScript/SkQualifier.hpp>
+#include <SkookumScript/SkRuntimeBase.hpp>
+
+
+//=======================================================================================
+// Local Global Structures
+//=======================================================================================
+
+namespace
+{
+
+  // Identifies a cache binary - bump the version whenever the routine binaries or the
+  // cache layout change.  The SKOOKUM build flags are stored alongside since debug info
+  // is only in the routine binaries of some builds.
+  const uint32_t SkCompiler_cache_id_type    = 0x00C0CAC8;
+  const uint32_t SkCompiler_cache_id_version = 2u;
+  const uint32_t SkCompiler_cache_id         = (SkCompiler_cache_id_version << 24u) + SkCompiler_cache_id_type;
+
+  // Byte size of the fixed part of a cache entry:
+  //   4 bytes - class name id
+  //   4 bytes - routine name id
+  //   1 byte  - member type
+  //   1 byte  - class member
+  //   4 bytes - cache key
+  //   4 bytes - routine binary length
+  const uint32_t SkCompiler_cache_entry_header_size = 18u;
+
+  //---------------------------------------------------------------------------------------
+  // Returns true if `str` ends with `suffix_p`
+  inline bool ends_with(const AString & str, const char * suffix_p, uint32_t suffix_length)
+    {
+    uint32_t length = str.get_length();
+
+    return (length >= suffix_length)
+      && (::strncmp(str.as_cstr() + length - suffix_length, suffix_p, suffix_length) == 0);
+    }
+
+} // End unnamed namespace
+
+
+//=======================================================================================
+// SkCompiler::Member Method Definitions
+//=======================================================================================
+
+//---------------------------------------------------------------------------------------
+SkCompiler::Member::Member(
+  eSkMember       type,
+  const ASymbol & class_name,
+  const ASymbol & name,
+  bool            class_member_b,
+  const AString & source,
+  const AString & origin,
+  uint32_t        row_offset
+  ) :
+  m_type(type),
+  m_class_name(class_name),
+  m_name(name),
+  m_class_member_b(class_member_b),
+  m_source(source),
+  m_origin(origin),
+  m_row_offset(row_offset),
+  m_routine_p(nullptr),
+  m_result(SkParser::Result_ok),
+  m_result_pos(0u),
+  m_parsed_b(false),
+  m_cache_key(0u)
+  {
+  }
+
+//---------------------------------------------------------------------------------------
+// Sort order - class, then instance members before class members, then member type (so
+// class meta and data precede routines) and finally routine name.
+bool SkCompiler::Member::operator<(const Member & member) const
+  {
+  if (m_class_name != member.m_class_name)
+    {
+    return m_class_name < member.m_class_name;
+    }
+
+  if (m_class_member_b != member.m_class_member_b)
+    {
+    return member.m_class_member_b;
+    }
+
+  if (m_type != member.m_type)
+    {
+    return m_type < member.m_type;
+    }
+
+  return m_name < member.m_name;
+  }
+
+
+//=======================================================================================
+// SkCompiler Method Definitions
+//=======================================================================================
+
+//---------------------------------------------------------------------------------------
+SkCompiler::SkCompiler() :
+  m_interface_crc(0u),
+  m_cached_count(0u),
+  m_cache_enabled_b(false),
+  m_error_count(0u)
+  {
+  }
+
+//---------------------------------------------------------------------------------------
+SkCompiler::~SkCompiler()
+  {
+  // Routines that were parsed but never merged (due to errors elsewhere) are still owned
+  // by their member slots.
+  Member ** members_pp     = m_members.get_array();
+  Member ** members_end_pp = members_pp + m_members.get_length();
+
+  for (; members_pp < members_end_pp; members_pp++)
+    {
+    delete (*members_pp)->m_routine_p;
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Declares a class - the superclass does not need to be declared yet.
+//
+// Params:
+//   superclass_name: null only for `Object`
+void SkCompiler::declare_class(const ASymbol & class_name, const ASymbol & superclass_name)
+  {
+  ClassDecl decl;
+
+  decl.m_name            = class_name;
+  decl.m_superclass_name = superclass_name;
+  m_class_decls.append(decl);
+  }
+
+//---------------------------------------------------------------------------------------
+// Adds a loose member file of a class.
+//
+// Returns: false if the file name does not identify a member
+// Params:
+//   file_name: file name without path - `name().sk`, `_name().sk`, `name()C.sk`,
+//     `!Data.sk`, `!DataC.sk`, `!Class.sk-meta`, etc.  Other files and files starting
+//     with `-` are ignored.
+//   origin: file path used in error messages
+bool SkCompiler::add_member_file(
+  const ASymbol & class_name,
+  const AString & file_name,
+  const AString & source,
+  const AString & origin
+  )
+  {
+  if (ends_with(file_name, ".sk-meta", 8u))
+    {
+    add_member(SK_NEW(Member)(SkMember_class_meta, class_name, ASymbol::get_null(), false, source, origin, 0u));
+
+    return true;
+    }
+
+  if (!ends_with(file_name, ".sk", 3u))
+    {
+    // Not a member file - object ids, etc.
+    return true;
+    }
+
+  SkParser    title(file_name.as_cstr(), file_name.get_length() - 3u, false);
+  SkQualifier ident;
+  bool        class_member_b = false;
+  eSkMember   type           = title.identify_member_filename(&ident, &class_member_b, false);
+
+  switch (type)
+    {
+    case SkMember__invalid:
+      return true;
+
+    case SkMember__error:
+      append_error(origin, 0u, a_str_format("'%s' is not a valid member file name!", file_name.as_cstr()));
+      return false;
+
+    default:
+      add_member(SK_NEW(Member)(type, class_name, ident.get_name(), class_member_b, source, origin, 0u));
+      return true;
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Adds the members of a class archive - a series of chunks each started by a `$$` line:
+//
+//   ```
+//   $$ Class < Superclass   class declaration followed by its class meta info
+//   $$ @                    instance data members
+//   $$ @@                   class data members
+//   $$ @name                instance method or coroutine (`_name`)
+//   $$ @@name               class method
+//   $$ .                    end of archive
+//   ```
+//
+// Returns: false if the archive is malformed
+// Params:
+//   class_name:
+//     class of a per-class archive (`Class.Super.sk`) that starts with its class meta
+//     info rather than a class declaration or null for an overlay archive (`!Overlay.sk`)
+//   origin: file path used in error messages
+bool SkCompiler::add_class_archive(
+  const AString & source,
+  const AString & origin,
+  const ASymbol & class_name // = ASymbol::get_null()
+  )
+  {
+  const char * cstr_a = source.as_cstr();
+  uint32_t     length = source.get_length();
+
+  ASymbol   chunk_class    = class_name;
+  ASymbol   chunk_name;
+  eSkMember chunk_type     = class_name.is_null() ? SkMember__invalid : SkMember_class_meta;
+  bool      chunk_class_b  = false;
+  uint32_t  chunk_start    = 0u;
+  uint32_t  chunk_row      = 0u;
+  uint32_t  row            = 0u;
+  uint32_t  pos            = 0u;
+  uint32_t  line_end;
+  bool      terminated     = false;
+  bool      success        = true;
+
+  while (!terminated && (pos < length))
+    {
+    if (!source.find('\n', 1u, &line_end, pos))
+      {
+      line_end = length;
+      }
+
+    if ((cstr_a[pos] == '$') && ((pos + 1u) < length) && (cstr_a[pos + 1u] == '$'))
+      {
+      //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+      // Close previous chunk
+      if (chunk_type != SkMember__invalid)
+        {
+        add_member(SK_NEW(Member)(
+          chunk_type, chunk_class, chunk_name, chunk_class_b, source.get(chunk_start, pos - chunk_start), origin, chunk_row));
+        }
+
+      chunk_start = a_min(line_end + 1u, length);
+      chunk_row   = row + 1u;
+      chunk_type  = SkMember__invalid;
+
+      //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+      // Identify next chunk
+      AString header(source.get(pos + 2u, line_end - pos - 2u));
+
+      header.crop();
+
+      if (header == ".")
+        {
+        terminated = true;
+        }
+      else if (header.get_first() == '@')
+        {
+        chunk_class_b = (header.get_length() > 1u) && (header.as_cstr()[1] == '@');
+        header.crop(chunk_class_b ? 2u : 1u);
+
+        if (header.is_empty())
+          {
+          chunk_type = SkMember_data;
+          chunk_name = ASymbol::get_null();
+          }
+        else
+          {
+          chunk_type = (header.get_first() == '_') ? SkMember_coroutine : SkMember_method;
+          chunk_name = ASymbol::create(header);
+
+          if (chunk_class_b && (chunk_type == SkMember_coroutine))
+            {
+            append_error(origin, row, a_str_format("Coroutine '%s' cannot be a class member!", header.as_cstr()));
+            chunk_type = SkMember__invalid;
+            success    = false;
+            }
+          }
+
+        if (chunk_class.is_null())
+          {
+          append_error(origin, row, "Member chunk without a preceding class declaration!");
+          chunk_type = SkMember__invalid;
+          success    = false;
+          }
+        }
+      else
+        {
+        uint32_t super_pos;
+
+        if (header.find('<', 1u, &super_pos))
+          {
+          AString class_str(header.get(0u, super_pos));
+          AString super_str(header.get(super_pos + 1u));
+
+          chunk_class   = ASymbol::create(class_str.crop());
+          chunk_type    = SkMember_class_meta;
+          chunk_name    = ASymbol::get_null();
+          chunk_class_b = false;
+          declare_class(chunk_class, ASymbol::create(super_str.crop()));
+          }
+        else
+          {
+          append_error(origin, row, a_str_format("Unknown archive chunk '$$ %s'!", header.as_cstr()));
+          success = false;
+          }
+        }
+      }
+
+    pos = line_end + 1u;
+    row++;
+    }
+
+  if (!terminated)
+    {
+    // Missing terminator - keep any final chunk anyway
+    if (chunk_type != SkMember__invalid)
+      {
+      add_member(SK_NEW(Member)(
+        chunk_type, chunk_class, chunk_name, chunk_class_b, source.get(chunk_start), origin, chunk_row));
+      }
+
+    append_error(origin, row, "Archive is missing its '$$ .' terminator!");
+    success = false;
+    }
+
+  return success;
+  }
+
+//---------------------------------------------------------------------------------------
+// Builds the program from the previously supplied classes and members.
+//
+// Returns: true if there were no errors - see get_errors()
+// Params:
+//   startup_class_name: class of the startup mind - usually `Master`
+bool SkCompiler::compile(const ASymbol & startup_class_name)
+  {
+  declare_classes();
+
+  if (m_error_count)
+    {
+    return false;
+    }
+
+  SkBrain::initialize_after_classes_known(startup_class_name);
+
+  // Class hierarchy is the first part of the interface - the classes are sorted by name
+  m_interface_crc = 0u;
+  m_cached_count  = 0u;
+
+  for (SkClass * class_p : SkBrain::get_classes())
+    {
+    SkClass * superclass_p = class_p->get_superclass();
+
+    m_interface_crc = AChecksum::generate_crc32_uint32(class_p->get_name_id(), m_interface_crc);
+    m_interface_crc = AChecksum::generate_crc32_uint32(superclass_p ? superclass_p->get_name_id() : 0u, m_interface_crc);
+    }
+
+  parse_class_members();
+  preparse_routines();
+  parse_routines();
+  merge_routines();
+
+  //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  // Checksums of what was compiled - in member order so it is independent of the order
+  // that the app enumerated its files.
+  uint32_t folder_crc = 0u;
+  uint32_t file_crc   = 0u;
+  Member ** members_pp     = m_members.get_array();
+  Member ** members_end_pp = members_pp + m_members.get_length();
+
+  for (; members_pp < members_end_pp; members_pp++)
+    {
+    folder_crc = AChecksum::generate_crc32_uint32((*members_pp)->m_class_name.get_id(), folder_crc);
+    file_crc   = AChecksum::generate_crc32((*members_pp)->m_source, file_crc);
+    }
+
+  SkBrain::ms_checksum_folders = folder_crc;
+  SkBrain::ms_checksum_files   = file_crc;
+
+  return m_error_count == 0u;
+  }
+
+//---------------------------------------------------------------------------------------
+// Loads the routines cached by a previous compile and enables the cache.  A cache from a
+// different build or cache version is ignored.
+//
+// Returns: false if the cache was unusable - the compile then parses every routine
+// Params:
+//   binary_p: binary previously written with as_cache_binary()
+bool SkCompiler::load_cache(const void * binary_p, uint32_t length)
+  {
+  m_cache.free_all();
+  m_cache_enabled_b = true;
+
+  const void *    binary_end_p = static_cast<const uint8_t *>(binary_p) + length;
+  const uint8_t * header_p     = static_cast<const uint8_t *>(binary_p);
+
+  // 4 bytes - cache id
+  // 4 bytes - SKOOKUM build flags
+  // 4 bytes - entry count
+  if ((length < 12u)
+    || (A_BYTE_STREAM_UI32_INC(&header_p) != SkCompiler_cache_id)
+    || (A_BYTE_STREAM_UI32_INC(&header_p) != uint32_t(SKOOKUM)))
+    {
+    return false;
+    }
+
+  binary_p = header_p;
+
+  uint32_t entry_count = A_BYTE_STREAM_UI32_INC(&binary_p);
+
+  #if defined(A_SYMBOL_STR_DB_AGOG)
+    // n bytes - symbol table - so the symbols of restored routines keep their strings
+    ASymbolTable::ms_main_p->merge_binary(&binary_p);
+  #endif
+
+  // n bytes - entries
+  for (; entry_count; entry_count--)
+    {
+    if ((static_cast<const uint8_t *>(binary_end_p) - static_cast<const uint8_t *>(binary_p)) < int(SkCompiler_cache_entry_header_size))
+      {
+      m_cache.free_all();
+      return false;
+      }
+
+    ASymbol   class_name     = ASymbol::create_from_binary(&binary_p);
+    ASymbol   name           = ASymbol::create_from_binary(&binary_p);
+    eSkMember type           = eSkMember(A_BYTE_STREAM_UI8_INC(&binary_p));
+    bool      class_member_b = A_BYTE_STREAM_UI8_INC(&binary_p) != 0u;
+    uint32_t  cache_key      = A_BYTE_STREAM_UI32_INC(&binary_p);
+    uint32_t  binary_length  = A_BYTE_STREAM_UI32_INC(&binary_p);
+
+    if (uint32_t(static_cast<const uint8_t *>(binary_end_p) - static_cast<const uint8_t *>(binary_p)) < binary_length)
+      {
+      m_cache.free_all();
+      return false;
+      }
+
+    Member * entry_p = SK_NEW(Member)(type, class_name, name, class_member_b, AString::ms_empty, AString::ms_empty, 0u);
+
+    entry_p->m_cache_key = cache_key;
+    entry_p->m_binary.set_data(binary_p, binary_length);
+    m_cache.append_replace(*entry_p);
+    binary_p = static_cast<const uint8_t *>(binary_p) + binary_length;
+    }
+
+  return true;
+  }
+
+//---------------------------------------------------------------------------------------
+// Writes the routines of the last compile so that the next compile can restore any that
+// are unchanged - see load_cache().
+//
+// Binary composition:
+//   4 bytes - cache id
+//   4 bytes - SKOOKUM build flags
+//   4 bytes - entry count
+//   n bytes - symbol table         } if A_SYMBOL_STR_DB_AGOG
+//   n bytes - entry                }- repeating
+//     4 bytes - class name id
+//     4 bytes - routine name id
+//     1 byte  - member type
+//     1 byte  - class member
+//     4 bytes - cache key
+//     4 bytes - routine binary length
+//     n bytes - routine binary
+void SkCompiler::as_cache_binary(void ** binary_pp) const
+  {
+  A_SCOPED_BINARY_SIZE_SANITY_CHECK(binary_pp, as_cache_binary_length());
+
+  uint32_t value = SkCompiler_cache_id;
+
+  A_BYTE_STREAM_OUT32(binary_pp, &value);
+  value = uint32_t(SKOOKUM);
+  A_BYTE_STREAM_OUT32(binary_pp, &value);
+
+  Member ** members_pp     = m_members.get_array();
+  Member ** members_end_pp = members_pp + m_members.get_length();
+  uint32_t  entry_count    = 0u;
+
+  for (Member ** entries_pp = members_pp; entries_pp < members_end_pp; entries_pp++)
+    {
+    entry_count += (*entries_pp)->m_binary.is_empty() ? 0u : 1u;
+    }
+
+  A_BYTE_STREAM_OUT32(binary_pp, &entry_count);
+
+  #if defined(A_SYMBOL_STR_DB_AGOG)
+    ASymbolTable::ms_main_p->as_binary(binary_pp);
+  #endif
+
+  for (; members_pp < members_end_pp; members_pp++)
+    {
+    const Member & member = **members_pp;
+
+    if (member.m_binary.is_empty())
+      {
+      continue;
+      }
+
+    uint8_t  type           = uint8_t(member.m_type);
+    uint8_t  class_member_b = uint8_t(member.m_class_member_b);
+    uint32_t binary_length  = member.m_binary.get_data_length();
+
+    member.m_class_name.as_binary(binary_pp);
+    member.m_name.as_binary(binary_pp);
+    A_BYTE_STREAM_OUT8(binary_pp, &type);
+    A_BYTE_STREAM_OUT8(binary_pp, &class_member_b);
+    A_BYTE_STREAM_OUT32(binary_pp, &member.m_cache_key);
+    A_BYTE_STREAM_OUT32(binary_pp, &binary_length);
+    ::memcpy(*binary_pp, member.m_binary.get_data(), binary_length);
+    *binary_pp = static_cast<uint8_t *>(*binary_pp) + binary_length;
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Returns length of the binary written by as_cache_binary()
+uint32_t SkCompiler::as_cache_binary_length() const
+  {
+  uint32_t  length         = 12u;
+  Member ** members_pp     = m_members.get_array();
+  Member ** members_end_pp = members_pp + m_members.get_length();
+
+  #if defined(A_SYMBOL_STR_DB_AGOG)
+    length += ASymbolTable::ms_main_p->as_binary_length();
+  #endif
+
+  for (; members_pp < members_end_pp; members_pp++)
+    {
+    if (!(*members_pp)->m_binary.is_empty())
+      {
+      length += SkCompiler_cache_entry_header_size + (*members_pp)->m_binary.get_data_length();
+      }
+    }
+
+  return length;
+  }
+
+//---------------------------------------------------------------------------------------
+// Adds member - replacing any matching member from an earlier overlay
+void SkCompiler::add_member(Member * member_p)
+  {
+  Member * old_member_p = m_members.append_replace(*member_p);
+
+  if (old_member_p)
+    {
+    delete old_member_p;
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+void SkCompiler::append_error(const Member & member, SkParser::eResult result, uint32_t result_pos)
+  {
+  append_error(
+    member.m_origin,
+    member.m_row_offset + member.m_source.index_to_row(a_min(result_pos, member.m_source.get_length())),
+    SkParser::get_result_string(result));
+  }
+
+//---------------------------------------------------------------------------------------
+// Params:
+//   row: 0-based row in origin - written 1-based in the form most build tools recognize
+void SkCompiler::append_error(const AString & origin, uint32_t row, const AString & message)
+  {
+  m_errors.append(a_str_format("%s(%u): error: %s\n", origin.as_cstr(), row + 1u, message.as_cstr()));
+  m_error_count++;
+  }
+
+//---------------------------------------------------------------------------------------
+// Phase 1 - creates the declared classes so that each superclass exists before its
+// subclasses regardless of the order the classes were declared in.
+void SkCompiler::declare_classes()
+  {
+  uint32_t decl_count = m_class_decls.get_length();
+
+  SkBrain::initialize_core_classes(decl_count);
+
+  APArray<ClassDecl> pending;
+  ClassDecl *        decls_a = m_class_decls.get_array();
+
+  for (uint32_t idx = 0u; idx < decl_count; idx++)
+    {
+    pending.append(decls_a[idx]);
+    }
+
+  bool progress = true;
+
+  while (progress && pending.get_length())
+    {
+    progress = false;
+
+    for (uint32_t idx = 0u; idx < pending.get_length();)
+      {
+      ClassDecl * decl_p  = pending.get_at(idx);
+      SkClass *   class_p = SkBrain::get_class(decl_p->m_name);
+
+      if (class_p)
+        {
+        SkClass * superclass_p = class_p->get_superclass();
+
+        if (!decl_p->m_superclass_name.is_null()
+          && (!superclass_p || (superclass_p->get_name() != decl_p->m_superclass_name)))
+          {
+          append_error(
+            AString::ms_empty,
+            0u,
+            a_str_format(
+              "Class '%s' is declared with superclass '%s' but is derived from '%s'!",
+              decl_p->m_name.as_cstr_dbg(),
+              decl_p->m_superclass_name.as_cstr_dbg(),
+              superclass_p ? superclass_p->get_name().as_cstr_dbg() : "[N/A]"));
+          }
+
+        pending.remove(idx);
+        progress = true;
+        continue;
+        }
+
+      SkClass * superclass_p = SkBrain::get_class(decl_p->m_superclass_name);
+
+      if (superclass_p)
+        {
+        SkBrain::create_class(decl_p->m_name, superclass_p);
+        pending.remove(idx);
+        progress = true;
+        continue;
+        }
+
+      idx++;
+      }
+    }
+
+  // Whatever is left has a superclass that was never declared
+  for (uint32_t idx = 0u; idx < pending.get_length(); idx++)
+    {
+    ClassDecl * decl_p = pending.get_at(idx);
+
+    append_error(
+      AString::ms_empty,
+      0u,
+      a_str_format(
+        "Superclass '%s' of class '%s' does not exist!",
+        decl_p->m_superclass_name.as_cstr_dbg(),
+        decl_p->m_name.as_cstr_dbg()));
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Phase 2 - applies class meta info for all classes and then appends the data members of
+// all classes.
+void SkCompiler::parse_class_members()
+  {
+  SkParser::get_default_flags().enable(SkParser::Flag_preparse);
+
+  Member ** members_a    = m_members.get_array();
+  uint32_t  member_count = m_members.get_length();
+
+  // Meta first so the data members see the final class flags
+  const eSkMember pass_types[] = { SkMember_class_meta, SkMember_data };
+
+  for (eSkMember type : pass_types)
+    {
+    for (uint32_t idx = 0u; idx < member_count; idx++)
+      {
+      Member * member_p = members_a[idx];
+
+      if (member_p->m_type != type)
+        {
+        continue;
+        }
+
+      SkClass * class_p = SkBrain::get_class(member_p->m_class_name);
+
+      if (class_p == nullptr)
+        {
+        append_error(*member_p, SkParser::Result_err_context_non_class, 0u);
+        continue;
+        }
+
+      SkParser       parser(member_p->m_source);
+      SkParser::Args args(0u);
+      bool           success = (type == SkMember_class_meta)
+        ? parser.parse_class_meta_source(class_p, args, true)
+        : parser.parse_data_members_source(
+            member_p->m_class_member_b ? static_cast<SkClassUnaryBase *>(&class_p->get_metaclass()) : class_p,
+            args,
+            true);
+
+      if (!success)
+        {
+        append_error(*member_p, args.m_result, args.m_end_pos);
+        }
+
+      m_interface_crc = AChecksum::generate_crc32(member_p->m_source, generate_member_crc(*member_p, m_interface_crc));
+      }
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Phase 3 - creates placeholder routines with just their parameters so that calls in
+// routine bodies can be type-checked.
+void SkCompiler::preparse_routines()
+  {
+  Member ** members_pp     = m_members.get_array();
+  Member ** members_end_pp = members_pp + m_members.get_length();
+
+  for (; members_pp < members_end_pp; members_pp++)
+    {
+    Member * member_p = *members_pp;
+
+    if ((member_p->m_type != SkMember_method) && (member_p->m_type != SkMember_coroutine))
+      {
+      continue;
+      }
+
+    SkClass * class_p = SkBrain::get_class(member_p->m_class_name);
+
+    if (class_p == nullptr)
+      {
+      member_p->m_result = SkParser::Result_err_context_non_class;
+      append_error(*member_p, member_p->m_result, 0u);
+      continue;
+      }
+
+    SkClassUnaryBase * scope_p = member_p->m_class_member_b
+      ? static_cast<SkClassUnaryBase *>(&class_p->get_metaclass())
+      : class_p;
+    SkParser           parser(member_p->m_source);
+    SkParser::Args     args(0u);
+    SkInvokableBase *  routine_p = (member_p->m_type == SkMember_method)
+      ? static_cast<SkInvokableBase *>(parser.preparse_method_source(member_p->m_name, scope_p, args))
+      : parser.preparse_coroutine_source(member_p->m_name, scope_p, args);
+
+    if (routine_p == nullptr)
+      {
+      member_p->m_result = args.m_result;
+      append_error(*member_p, args.m_result, args.m_end_pos);
+      continue;
+      }
+
+    // Signature is part of the interface
+    const SkParameters & params = routine_p->get_params();
+    ADatum               params_binary(params.as_binary_length());
+    void *               binary_p = params_binary.get_data_writable();
+
+    params.as_binary(&binary_p);
+    m_interface_crc = generate_member_crc(*member_p, m_interface_crc);
+    m_interface_crc = AChecksum::generate_crc32_uint32(routine_p->get_annotation_flags(), m_interface_crc);
+    m_interface_crc = AChecksum::generate_crc32(params_binary.get_data(), params_binary.get_data_length(), m_interface_crc);
+    }
+
+  SkParser::get_default_flags().enable(SkParser::Flag_preparse, false);
+  }
+
+//---------------------------------------------------------------------------------------
+// Phase 4 - parses all routine bodies that preparsed successfully - other than those
+// restored from the cache.
+void SkCompiler::parse_routines()
+  {
+  Member ** members_pp     = m_members.get_array();
+  Member ** members_end_pp = members_pp + m_members.get_length();
+
+  for (; members_pp < members_end_pp; members_pp++)
+    {
+    Member * member_p = *members_pp;
+
+    if (((member_p->m_type != SkMember_method) && (member_p->m_type != SkMember_coroutine))
+      || (member_p->m_result != SkParser::Result_ok))
+      {
+      continue;
+      }
+
+    if (m_cache_enabled_b)
+      {
+      member_p->m_cache_key = AChecksum::generate_crc32(member_p->m_source, m_interface_crc);
+
+      Member * entry_p = m_cache.get(*member_p);
+
+      if (entry_p && (entry_p->m_cache_key == member_p->m_cache_key) && restore_routine(member_p, entry_p->m_binary))
+        {
+        m_cached_count++;
+        continue;
+        }
+      }
+
+    parse_routine(member_p);
+    }
+
+  // Restored routines share their binaries with the cache entries they came from
+  m_cache.free_all();
+  }
+
+//---------------------------------------------------------------------------------------
+// Phase 5 - replaces the preparsed placeholder routines with the fully parsed routines in
+// member order.
+void SkCompiler::merge_routines()
+  {
+  Member ** members_pp     = m_members.get_array();
+  Member ** members_end_pp = members_pp + m_members.get_length();
+
+  for (; members_pp < members_end_pp; members_pp++)
+    {
+    Member *          member_p  = *members_pp;
+    SkInvokableBase * routine_p = member_p->m_routine_p;
+
+    if (!member_p->m_parsed_b)
+      {
+      // Not a routine or its error was already reported during the preparse
+      continue;
+      }
+
+    member_p->m_routine_p = nullptr;
+
+    if ((member_p->m_result != SkParser::Result_ok) || (routine_p == nullptr))
+      {
+      append_error(*member_p, member_p->m_result, member_p->m_result_pos);
+      delete routine_p;
+      continue;
+      }
+
+    if (m_cache_enabled_b && member_p->m_binary.is_empty())
+      {
+      // Freshly parsed - keep its binary for the next compile.  Compound types must be
+      // fully described since their reference indexes change from compile to compile.
+      bool compounds_use_ref_saved = SkClassDescBase::is_compound_refs_enabled();
+      SkClassDescBase::enable_compound_refs(false);
+
+      uint32_t binary_length = 1u + routine_p->as_binary_length(false);
+      uint8_t  invoke_type   = uint8_t(routine_p->get_invoke_type());
+
+      member_p->m_binary = ADatum(binary_length);
+
+      void * binary_p = member_p->m_binary.get_data_writable();
+
+      A_BYTE_STREAM_OUT8(&binary_p, &invoke_type);
+      routine_p->as_binary(&binary_p, false);
+
+      SkClassDescBase::enable_compound_refs(compounds_use_ref_saved);
+      }
+
+    SkClass * class_p = SkBrain::get_class(member_p->m_class_name);
+
+    if (member_p->m_type == SkMember_method)
+      {
+      SkClassUnaryBase * scope_p = member_p->m_class_member_b
+        ? static_cast<SkClassUnaryBase *>(&class_p->get_metaclass())
+        : class_p;
+
+      scope_p->append_method(static_cast<SkMethodBase *>(routine_p));
+      }
+    else
+      {
+      class_p->append_coroutine(static_cast<SkCoroutineBase *>(routine_p));
+      }
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Recreates a routine in its member slot from its cached binary as if it had been parsed.
+//
+// Returns: false if the routine could not be restored and needs to be parsed
+bool SkCompiler::restore_routine(Member * member_p, const ADatum & binary)
+  {
+  #if (SKOOKUM & SK_DEBUG)
+    // Closures read the routine they are defined in from the runtime while loading
+    if (SkRuntimeBase::ms_singleton_p == nullptr)
+      {
+      return false;
+      }
+
+    SkRuntimeBase::ms_singleton_p->m_current_routine = SkMemberInfo(
+      SkQualifier(member_p->m_name, SkBrain::get_class(member_p->m_class_name)),
+      member_p->m_type,
+      member_p->m_class_member_b);
+  #endif
+
+  // Cached binaries fully describe their compound types - see merge_routines()
+  bool compounds_use_ref_saved = SkClassDescBase::is_compound_refs_enabled();
+  SkClassDescBase::enable_compound_refs(false);
+
+  // Routines are scoped to the class even if they are class members - as when loaded
+  SkClass *         class_p   = SkBrain::get_class(member_p->m_class_name);
+  const void *      binary_p  = binary.get_data();
+  eSkInvokable      type      = eSkInvokable(A_BYTE_STREAM_UI8_INC(&binary_p));
+  SkInvokableBase * routine_p = nullptr;
+
+  switch (type)
+    {
+    case SkInvokable_method:
+      routine_p = SK_NEW(SkMethod)(member_p->m_name, class_p, &binary_p);
+      break;
+
+    case SkInvokable_method_func:
+      routine_p = SK_NEW(SkMethodFunc)(member_p->m_name, class_p, &binary_p);
+      break;
+
+    case SkInvokable_method_mthd:
+      routine_p = SK_NEW(SkMethodMthd)(member_p->m_name, class_p, &binary_p);
+      break;
+
+    case SkInvokable_coroutine:
+      routine_p = SK_NEW(SkCoroutine)(member_p->m_name, class_p, &binary_p);
+      break;
+
+    case SkInvokable_coroutine_func:
+      routine_p = SK_NEW(SkCoroutineFunc)(member_p->m_name, class_p, &binary_p);
+      break;
+
+    case SkInvokable_coroutine_mthd:
+      routine_p = SK_NEW(SkCoroutineMthd)(member_p->m_name, class_p, &binary_p);
+      break;
+    }
+
+  SkClassDescBase::enable_compound_refs(compounds_use_ref_saved);
+
+  #if (SKOOKUM & SK_DEBUG)
+    SkRuntimeBase::ms_singleton_p->m_current_routine.invalidate();
+  #endif
+
+  if (routine_p == nullptr)
+    {
+    return false;
+    }
+
+  member_p->m_routine_p = routine_p;
+  member_p->m_binary    = binary;
+  member_p->m_parsed_b  = true;
+
+  return true;
+  }
+
+//---------------------------------------------------------------------------------------
+// Parses the body of a single routine into its member slot without modifying its class.
+void SkCompiler::parse_routine(Member * member_p)
+  {
+  SkClass *          class_p = SkBrain::get_class(member_p->m_class_name);
+  SkClassUnaryBase * scope_p = member_p->m_class_member_b
+    ? static_cast<SkClassUnaryBase *>(&class_p->get_metaclass())
+    : class_p;
+  SkParser           parser(member_p->m_source);
+  SkParser::Args     args(0u);
+
+  member_p->m_routine_p = (member_p->m_type == SkMember_method)
+    ? static_cast<SkInvokableBase *>(parser.parse_method_source(member_p->m_name, scope_p, args, false))
+    : parser.parse_coroutine_source(member_p->m_name, scope_p, args, false);
+
+  member_p->m_result     = args.m_result;
+  member_p->m_result_pos = args.m_end_pos;
+  member_p->m_parsed_b   = true;
+  }
+
+//---------------------------------------------------------------------------------------
+// Returns checksum of the identity of a member - class, scope, type and name
+uint32_t SkCompiler::generate_member_crc(const Member & member, uint32_t prev_crc)
+  {
+  uint32_t crc = AChecksum::generate_crc32_uint32(member.m_class_name.get_id(), prev_crc);
+
+  crc = AChecksum::generate_crc32_uint32(member.m_name.get_id(), crc);
+  crc = AChecksum::generate_crc32_uint8(uint8_t(member.m_type), crc);
+
+  return AChecksum::generate_crc32_uint8(uint8_t(member.m_class_member_b), crc);
+  }
+
+#endif  // (SKOOKUM & SK_CODE_IN) && (SKOOKUM & SK_COMPILED_OUT)
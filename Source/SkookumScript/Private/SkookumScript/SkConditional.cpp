@@ -25,6 +25,8 @@
 #include <SkookumScript/SkBrain.hpp>
 #include <SkookumScript/SkClass.hpp>
 #include <SkookumScript/SkInvokedMethod.hpp>
+#include <SkookumScript/SkLiteral.hpp>
+#include <SkookumScript/SkOptimizer.hpp>
 #include <SkookumScript/SkParameterBase.hpp>
 #include <SkookumScript/SkBoolean.hpp>
 #include <SkookumScript/SkSymbolDefs.hpp>
@@ -35,6 +37,96 @@
 //=======================================================================================
 
 
+//=======================================================================================
+// Local Global Structures
+//=======================================================================================
+
+namespace
+{
+
+  // Outcome of a clause test as far as it can be determined at load time
+  enum eClauseTest
+    {
+    ClauseTest_unknown,
+    ClauseTest_false,
+    ClauseTest_true
+    };
+
+  //---------------------------------------------------------------------------------------
+  // Drops clauses whose test is known to fail and turns the first clause whose test is
+  // known to succeed into the else clause - dropping any clauses that follow it.
+  //
+  // Returns:
+  //   Expression to use in place of the whole conditional if only one path remains or
+  //   nullptr if the conditional should be kept.
+  //
+  // Params:
+  //   clauses_p: clauses of the conditional
+  //   test_f: function taking a clause test expression and returning an eClauseTest
+  template<class _TestFunc>
+  SkExpressionBase * prune_clauses(APCompactArrayFree<SkClause> * clauses_p, _TestFunc test_f)
+    {
+    uint32_t idx = 0u;
+
+    while (idx < clauses_p->get_length())
+      {
+      SkClause * clause_p = clauses_p->get_array()[idx];
+
+      if (clause_p->m_test_p)
+        {
+        eClauseTest test = test_f(clause_p->m_test_p);
+
+        if (test == ClauseTest_false)
+          {
+          clauses_p->free(idx);
+          continue;
+          }
+
+        if (test == ClauseTest_unknown)
+          {
+          idx++;
+          continue;
+          }
+
+        delete clause_p->m_test_p;
+        clause_p->m_test_p = nullptr;
+        }
+
+      // Clauses after an else clause can never be reached
+      clauses_p->free_all_last(clauses_p->get_length() - idx - 1u);
+      break;
+      }
+
+    switch (clauses_p->get_length())
+      {
+      case 0u:
+        // No clause can succeed so the result is always nil
+        return SK_NEW(SkLiteral)(SkLiteral::Type__nil);
+
+      case 1u:
+        {
+        SkClause * clause_p = clauses_p->get_first();
+
+        if (clause_p->m_test_p == nullptr)
+          {
+          // Only the else clause is left - detach it so it survives the conditional
+          SkExpressionBase * expr_p = clause_p->m_clause_p;
+
+          clause_p->m_clause_p = nullptr;
+
+          return expr_p;
+          }
+        }
+        // Fall through
+
+      default:
+        return nullptr;
+      }
+    }
+
+} // End unnamed namespace
+
+
 //=======================================================================================
 // SkClause Method Definitions
 //=======================================================================================
@@ -538,6 +630,41 @@ bool SkConditional::is_immediate(
   return true;
   }
 
+//---------------------------------------------------------------------------------------
+// Optimizes tests and clauses - see SkExpressionBase::optimize().
+// Clauses ruled out by a literal Boolean test are dropped and if only one path remains
+// the conditional is replaced by it.
+// Modifiers:   virtual - overridden from SkExpressionBase
+SkExpressionBase * SkConditional::optimize(const SkOptimizer & optimizer)
+  {
+  SkClause ** clauses_pp     = m_clauses.get_array();
+  SkClause ** clauses_end_pp = clauses_pp + m_clauses.get_length();
+
+  for (; clauses_pp < clauses_end_pp; clauses_pp++)
+    {
+    optimizer.optimize(&(*clauses_pp)->m_test_p);
+    optimizer.optimize(&(*clauses_pp)->m_clause_p);
+    }
+
+  if (!optimizer.is_flag_set(SkOptimizer::Flag_prune_branches))
+    {
+    return this;
+    }
+
+  SkExpressionBase * expr_p = prune_clauses(
+    &m_clauses,
+    [](const SkExpressionBase * test_p)
+      {
+      bool value;
+
+      return SkOptimizer::is_literal_boolean(test_p, &value)
+        ? (value ? ClauseTest_true : ClauseTest_false)
+        : ClauseTest_unknown;
+      });
+
+  return expr_p ? expr_p : this;
+  }
+
 //---------------------------------------------------------------------------------------
 // Tracks memory used by this object and its sub-objects
 // See:        SkDebug, AMemoryStats
@@ -1031,6 +1158,45 @@ bool SkCase::is_immediate(
   return true;
   }
 
+//---------------------------------------------------------------------------------------
+// Optimizes the compare expression, tests and clauses - see SkExpressionBase::optimize().
+// If the compare expression is a literal then clauses with literal tests are resolved
+// and if only one path remains the case is replaced by it.
+// Modifiers:   virtual - overridden from SkExpressionBase
+SkExpressionBase * SkCase::optimize(const SkOptimizer & optimizer)
+  {
+  optimizer.optimize(&m_compare_expr_p);
+
+  SkClause ** clauses_pp     = m_clauses.get_array();
+  SkClause ** clauses_end_pp = clauses_pp + m_clauses.get_length();
+
+  for (; clauses_pp < clauses_end_pp; clauses_pp++)
+    {
+    optimizer.optimize(&(*clauses_pp)->m_test_p);
+    optimizer.optimize(&(*clauses_pp)->m_clause_p);
+    }
+
+  if (!optimizer.is_flag_set(SkOptimizer::Flag_prune_branches)
+    || (m_compare_expr_p->get_type() != SkExprType_literal))
+    {
+    return this;
+    }
+
+  const SkExpressionBase * compare_p = m_compare_expr_p;
+  SkExpressionBase *       expr_p    = prune_clauses(
+    &m_clauses,
+    [compare_p](const SkExpressionBase * test_p)
+      {
+      bool equal;
+
+      return SkOptimizer::is_literal_equal(compare_p, test_p, &equal)
+        ? (equal ? ClauseTest_true : ClauseTest_false)
+        : ClauseTest_unknown;
+      });
+
+  return expr_p ? expr_p : this;
+  }
+
 //---------------------------------------------------------------------------------------
 // Tracks memory used by this object and its sub-objects
 // See:        SkDebug, AMemoryStats
@@ -1360,6 +1526,37 @@ void SkWhen::null_receiver(SkExpressionBase * receiver_p)
     }
   }
 
+//---------------------------------------------------------------------------------------
+// Optimizes test and clause - see SkExpressionBase::optimize().
+// A literal Boolean test is resolved - to the clause if it would run or to nil if not.
+// Modifiers:   virtual - overridden from SkExpressionBase
+// Notes:      Also used by SkUnless
+SkExpressionBase * SkWhen::optimize(const SkOptimizer & optimizer)
+  {
+  optimizer.optimize(&m_test_p);
+  optimizer.optimize(&m_clause_p);
+
+  bool value;
+
+  if (!optimizer.is_flag_set(SkOptimizer::Flag_prune_branches)
+    || !SkOptimizer::is_literal_boolean(m_test_p, &value))
+    {
+    return this;
+    }
+
+  // `unless` runs its clause when the test is false
+  if (value != (get_type() == SkExprType_when))
+    {
+    return SK_NEW(SkLiteral)(SkLiteral::Type__nil);
+    }
+
+  SkExpressionBase * clause_p = m_clause_p;
+
+  m_clause_p = nullptr;
+
+  return clause_p;
+  }
+
 //---------------------------------------------------------------------------------------
 // Tracks memory used by this object and its sub-objects
 // See:        SkDebug, AMemoryStats
@@ -1800,6 +1997,46 @@ void SkNilCoalescing::null_receiver(SkExpressionBase * receiver_p)
     }
   }
 
+//---------------------------------------------------------------------------------------
+// Optimizes trial and alternate - see SkExpressionBase::optimize().
+// A literal trial is resolved - to the alternate if it is nil or to itself if not.
+// Modifiers:   virtual - overridden from SkExpressionBase
+SkExpressionBase * SkNilCoalescing::optimize(const SkOptimizer & optimizer)
+  {
+  optimizer.optimize(&m_trial_p);
+  optimizer.optimize(&m_alternate_p);
+
+  if (!optimizer.is_flag_set(SkOptimizer::Flag_prune_branches)
+    || (m_trial_p->get_type() != SkExprType_literal))
+    {
+    return this;
+    }
+
+  SkExpressionBase * expr_p;
+
+  switch (static_cast<SkLiteral *>(m_trial_p)->get_kind())
+    {
+    case SkLiteral::Type__nil:
+      expr_p        = m_alternate_p;
+      m_alternate_p = nullptr;
+      break;
+
+    case SkLiteral::Type_boolean:
+    case SkLiteral::Type_integer:
+    case SkLiteral::Type_real:
+    case SkLiteral::Type_string:
+    case SkLiteral::Type_symbol:
+      expr_p    = m_trial_p;
+      m_trial_p = nullptr;
+      break;
+
+    default:
+      return this;
+    }
+
+  return expr_p;
+  }
+
 //---------------------------------------------------------------------------------------
 // Tracks memory used by this object and its sub-objects
 //
@@ -141,6 +141,7 @@ class SkConditional : public SkExpressionBase
     virtual eSkExprType     get_type() const override;
     virtual SkInvokedBase * invoke(SkObjectBase * scope_p, SkInvokedBase * caller_p = nullptr, SkInstance ** result_pp = nullptr) const override;
     virtual bool            is_immediate(uint32_t * durational_idx_p = nullptr) const override;
+    virtual SkExpressionBase * optimize(const SkOptimizer & optimizer) override;
     virtual void            track_memory(AMemoryStats * mem_stats_p) const override;
 
     // Debugging Methods
@@ -216,6 +217,7 @@ class SkCase : public SkExpressionBase
     virtual eSkExprType     get_type() const override;
     virtual SkInvokedBase * invoke(SkObjectBase * scope_p, SkInvokedBase * caller_p = nullptr, SkInstance ** result_pp = nullptr) const override;
     virtual bool            is_immediate(uint32_t * durational_idx_p = nullptr) const override;
+    virtual SkExpressionBase * optimize(const SkOptimizer & optimizer) override;
     virtual void            track_memory(AMemoryStats * mem_stats_p) const override;
 
     // Debugging Methods
@@ -311,6 +313,7 @@ class SkWhen : public SkExpressionBase
     virtual SkInvokedBase * invoke(SkObjectBase * scope_p, SkInvokedBase * caller_p = nullptr, SkInstance ** result_pp = nullptr) const override;
     virtual bool            is_immediate(uint32_t * durational_idx_p = nullptr) const override;
     virtual void            null_receiver(SkExpressionBase * receiver_p) override;
+    virtual SkExpressionBase * optimize(const SkOptimizer & optimizer) override;
     virtual void            track_memory(AMemoryStats * mem_stats_p) const override;
 
     // Debugging Methods
@@ -441,6 +444,7 @@ class SkNilCoalescing : public SkExpressionBase
     virtual SkInvokedBase * invoke(SkObjectBase * scope_p, SkInvokedBase * caller_p = nullptr, SkInstance ** result_pp = nullptr) const override;
     virtual bool            is_immediate(uint32_t * durational_idx_p = nullptr) const override;
     virtual void            null_receiver(SkExpressionBase * receiver_p) override;
+    virtual SkExpressionBase * optimize(const SkOptimizer & optimizer) override;
     virtual void            track_memory(AMemoryStats * mem_stats_p) const override;
 
     // Debugging Methods
@@ -14,6 +14,7 @@
 #include <AgogCore/AMath.hpp>
 #include <AgogCore/AObjReusePool.hpp>
 #include <AgogCore/AStringRef.hpp>
+#include <SkookumScript/SkAllocProfiler.hpp>
 #include <SkookumScript/SkBoolean.hpp>
 #include <SkookumScript/SkBrain.hpp>
 #include <SkookumScript/SkCode.hpp>
@@ -28,6 +29,7 @@
 #include <SkookumScript/SkLiteral.hpp>
 #include <SkookumScript/SkMind.hpp>
 #include <SkookumScript/SkParameterBase.hpp>
+#include <SkookumScript/SkParser.hpp>
 #include <SkookumScript/SkRemoteRuntimeBase.hpp>
 #include <SkookumScript/SkString.hpp>
 #include <SkookumScript/SkSymbol.hpp>
@@ -377,7 +379,7 @@ void SkBreakPoint::reaquire_expr(
 
   uint16_t debug_flags = (expr_p->m_debug_info & SkDebugInfo::Flag_origin__mask) | uint16_t(m_table_idx);
 
-  if (m_enabled)
+  if (m_enabled || SkDebug::is_expr_patched())
     {
     debug_flags |= uint16_t(SkDebugInfo::Flag_debug_enabled);
     }
@@ -405,6 +407,12 @@ void SkBreakPoint::release_expr()
 void SkBreakPoint::release_expr(SkExpressionBase * expr_p)
   {
   expr_p->m_debug_info = SkDebugInfo::Flag_debug_idx__none | (expr_p->m_debug_info & SkDebugInfo::Flag_origin__mask);
+
+  // Keep expression trapped while stepping
+  if (SkDebug::is_expr_patched())
+    {
+    expr_p->m_debug_info |= uint16_t(SkDebugInfo::Flag_debug_enabled);
+    }
   }
 
 //---------------------------------------------------------------------------------------
@@ -438,7 +446,7 @@ void SkBreakPoint::enable(
         {
         expr_p->m_debug_info |= uint16_t(SkDebugInfo::Flag_debug_enabled);
         }
-      else
+      else if (!SkDebug::is_expr_patched())
         {
         expr_p->m_debug_info &= ~uint16_t(SkDebugInfo::Flag_debug_enabled);
         }
@@ -857,6 +865,7 @@ AFreePtr<AFunctionBase>    SkDebug::ms_print_mem_ext_p;
   SkExpressionBase *            SkDebug::ms_step_expr_p    = nullptr;
 
   APSortedLogicalFree<SkBreakPoint, SkMemberExpression> SkDebug::ms_breakpoints;
+  bool                          SkDebug::ms_expr_patched   = false;
 #endif
 
 uint32_t  SkDebug::ms_indent_size = AString_indent_spaces_def;
@@ -2045,15 +2054,19 @@ uint32_t SkDebug::print_memory_runtime()
     "================================================================================\n\n");
 
   AObjReusePool<SkInstance> &          instance_pool   = SkInstance::get_pool();
+  AObjReusePool<SkInstance32> &        instance32_pool = SkInstance32::get_pool();
+  AObjReusePool<SkInstance64> &        instance64_pool = SkInstance64::get_pool();
   AObjReusePool<SkInvokedExpression> & iexpr_pool      = SkInvokedExpression::get_pool();
   AObjReusePool<SkInvokedCoroutine> &  icoroutine_pool = SkInvokedCoroutine::get_pool();
   AObjReusePool<AStringRef> &          str_ref_pool    = AStringRef::get_pool();
 
   uint32_t instance_bytes   = instance_pool.get_bytes_allocated();
+  uint32_t instance32_bytes = instance32_pool.get_bytes_allocated();
+  uint32_t instance64_bytes = instance64_pool.get_bytes_allocated();
   uint32_t iexpr_bytes      = iexpr_pool.get_bytes_allocated();
   uint32_t icoroutine_bytes = icoroutine_pool.get_bytes_allocated();
   uint32_t str_ref_bytes    = str_ref_pool.get_bytes_allocated();
-  uint32_t runtime_bytes    = instance_bytes + iexpr_bytes + icoroutine_bytes + str_ref_bytes;
+  uint32_t runtime_bytes    = instance_bytes + instance32_bytes + instance64_bytes + iexpr_bytes + icoroutine_bytes + str_ref_bytes;
 
   // 20    8         8        9          8
   // Pool  Max Used  Current  Available  Initial  Overflow!
@@ -2063,6 +2076,10 @@ uint32_t SkDebug::print_memory_runtime()
 
   ADebug::print_format(
     " SkInstance           | %8u | %8u | %9u | %8u | %9u | %8u\n", instance_pool.get_count_max(), instance_pool.get_count_used(), instance_pool.get_count_available(), instance_pool.get_count_initial(), instance_pool.get_count_overflow(), instance_bytes);
+  ADebug::print_format(
+    " SkInstance32         | %8u | %8u | %9u | %8u | %9u | %8u\n", instance32_pool.get_count_max(), instance32_pool.get_count_used(), instance32_pool.get_count_available(), instance32_pool.get_count_initial(), instance32_pool.get_count_overflow(), instance32_bytes);
+  ADebug::print_format(
+    " SkInstance64         | %8u | %8u | %9u | %8u | %9u | %8u\n", instance64_pool.get_count_max(), instance64_pool.get_count_used(), instance64_pool.get_count_available(), instance64_pool.get_count_initial(), instance64_pool.get_count_overflow(), instance64_bytes);
   ADebug::print_format(
     " SkInvokedExpression  | %8u | %8u | %9u | %8u | %9u | %8u\n", iexpr_pool.get_count_max(), iexpr_pool.get_count_used(), iexpr_pool.get_count_available(), iexpr_pool.get_count_initial(), iexpr_pool.get_count_overflow(), iexpr_bytes);
   ADebug::print_format(
@@ -2605,6 +2622,86 @@ SkBreakPoint * SkDebug::breakpoint_get_by_expr(const SkExpressionBase & expr)
     : nullptr;
   }
 
+//---------------------------------------------------------------------------------------
+// Patches SkDebugInfo::Flag_debug_enabled onto every expression of every class so that
+// SKDEBUG_HOOK_EXPR() calls hook_expression() for all of them, or restores the flag to
+// only be set on expressions with enabled breakpoints.
+// 
+// This keeps the per-expression hook test to a single flag test on the expression itself
+// when not stepping - expressions are only patched for the duration of a step or while an
+// expression hook is set.
+// 
+// Params:
+//   patch: true to trap all expressions, false to trap only enabled breakpoints
+//   
+// Notes:
+//   Called by set_flag() whenever Flag__test_expression_mask flags are turned on/off.
+//   Covers the class hierarchy, cached invoke_script() snippets and the old routines held
+//   by the program update record.  Expressions loaded while patched (e.g. via live update
+//   or a newly parsed snippet) are not trapped until the next step starts.
+//   
+// Modifiers: static
+void SkDebug::patch_expressions(bool patch)
+  {
+  ms_expr_patched = patch;
+
+  // Nothing to patch if no program is loaded
+  if (SkBrain::ms_object_class_p == nullptr)
+    {
+    return;
+    }
+
+  struct NestedPatchExprs : public SkApplyExpressionBase
+    {
+    uint16_t m_debug_enabled;
+
+    virtual eAIterateResult apply_expr(SkExpressionBase * expr_p, const SkInvokableBase * invokable_p) override
+      {
+      expr_p->m_debug_info = (expr_p->m_debug_info & ~uint16_t(SkDebugInfo::Flag_debug_enabled)) | m_debug_enabled;
+
+      return AIterateResult_entire;
+      }
+    };
+
+  NestedPatchExprs patcher;
+
+  patcher.m_debug_enabled = patch ? uint16_t(SkDebugInfo::Flag_debug_enabled) : uint16_t(0u);
+  SkBrain::ms_object_class_p->iterate_expressions_recurse(&patcher);
+
+  // Code that is no longer in the class hierarchy may still be running - e.g. cached
+  // invoke_script() snippets and routines replaced by a live update.
+  #if (SKOOKUM & SK_CODE_IN)
+    SkParser::invoke_cache_iterate_expressions(&patcher);
+  #endif
+
+  SkProgramUpdateRecord * update_record_p = SkookumScript::get_program_update_record();
+
+  if (update_record_p)
+    {
+    update_record_p->iterate_expressions(&patcher);
+    }
+
+  if (!patch)
+    {
+    // Re-trap expressions with enabled breakpoints
+    SkBreakPoint ** bps_pp     = ms_breakpoints.get_array();
+    SkBreakPoint ** bps_end_pp = bps_pp + ms_breakpoints.get_length();
+
+    for (; bps_pp < bps_end_pp; bps_pp++)
+      {
+      if ((*bps_pp)->is_enabled())
+        {
+        SkExpressionBase * expr_p = (*bps_pp)->get_expr();
+
+        if (expr_p)
+          {
+          expr_p->m_debug_info |= uint16_t(SkDebugInfo::Flag_debug_enabled);
+          }
+        }
+      }
+    }
+  }
+
 //---------------------------------------------------------------------------------------
 // Author(s):   Conan Reis
 SkBreakPoint * SkDebug::breakpoint_get_at_idx(uint32_t table_idx)
@@ -2645,8 +2742,30 @@ void SkDebug::hook_expression(
 
     //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
     // Test for breakpoint set on expression - note that a breakpoint trumps stepwise
-    // debugging.
+    // debugging. While expressions are patched for stepping the debug flag alone does
+    // not indicate a breakpoint so also check the breakpoint itself.
+    SkBreakPoint * bp_p = nullptr;
+
     if (expr_p->m_debug_info & SkDebugInfo::Flag_debug_enabled)
+      {
+      bp_p = breakpoint_get_by_expr(*expr_p);
+
+      if (bp_p == nullptr)
+        {
+        if (!ms_expr_patched)
+          {
+          // Oops this should never happen - but when it does, just silently ignore it 
+          // and strip the breakpoint info from the expression
+          SkBreakPoint::release_expr(expr_p);
+          }
+        }
+      else if (!bp_p->is_enabled())
+        {
+        bp_p = nullptr;
+        }
+      }
+
+    if (bp_p)
       {
       break_expression(scope_p, caller_p, expr_p);
 
@@ -2667,19 +2786,8 @@ void SkDebug::hook_expression(
         ? branch_caller_p->get_caller_context() 
         : ((hook_context == HookContext_current ? caller_p : caller_p->get_caller())->get_caller_context());
 
-      // Get breakpoint info
-      SkBreakPoint * bp_p = breakpoint_get_by_expr(*expr_p);
-      if (bp_p)
-        {
-        // Have runtime communicate to IDE that it has hit a breakpoint
-        SkRemoteRuntimeBase::ms_client_p->on_breakpoint_hit(*bp_p, callstack_p, scope_p, caller_p);
-        }
-      else
-        {
-        // Oops this should never happen - but when it does, just silently ignore it 
-        // and strip the breakpoint info from the expression
-        SkBreakPoint::release_expr(expr_p);
-        }
+      // Have runtime communicate to IDE that it has hit a breakpoint
+      SkRemoteRuntimeBase::ms_client_p->on_breakpoint_hit(*bp_p, callstack_p, scope_p, caller_p);
       }
     else
       {
@@ -3584,6 +3692,32 @@ static void SkDebug_mthdc_print_memory_execution(SkInvokedMethod * scope_p, SkIn
     }
   }
 
+//---------------------------------------------------------------------------------------
+// Skoo Params enable_memory_profile(Boolean enable: true)
+// [See script file.]
+// Notes:      This is a class method.
+// C++ Args    See tSkMethodFunc or tSkMethodMthd in SkookumScript/SkMethod.hpp
+static void SkDebug_mthdc_enable_memory_profile(SkInvokedMethod * scope_p, SkInstance ** result_pp)
+  {
+  #if (SKOOKUM & SK_DEBUG)
+    SkAllocProfiler::enable(scope_p->get_arg<SkBoolean>(SkArg_1));
+  #endif
+  }
+
+//---------------------------------------------------------------------------------------
+// Skoo Params print_memory_profile(Integer top_count: 20)
+// [See script file.]
+// Notes:      This is a class method.
+// C++ Args    See tSkMethodFunc or tSkMethodMthd in SkookumScript/SkMethod.hpp
+static void SkDebug_mthdc_print_memory_profile(SkInvokedMethod * scope_p, SkInstance ** result_pp)
+  {
+  #if (SKOOKUM & SK_DEBUG)
+    tSkInteger top_count = scope_p->get_arg<SkInteger>(SkArg_1);
+
+    SkAllocProfiler::print(uint32_t(a_max(top_count, 0)));
+  #endif
+  }
+
 //---------------------------------------------------------------------------------------
 // Skoo Params print({Object} objs_as_strs)
 // [See script file.]
@@ -3655,6 +3789,7 @@ void SkDebug::register_bindings()
   SkBrain::ms_debug_class_p->register_method_func("callstack_str",                 mthdc_callstack_str,                  SkBindFlag_class_no_rebind);
   SkBrain::ms_debug_class_p->register_method_func("copy_hook",                     mthdc_copy_hook,                      SkBindFlag_class_no_rebind);
   SkBrain::ms_debug_class_p->register_method_func("enable_hook",                   mthdc_enable_hook,                    SkBindFlag_class_no_rebind);
+  SkBrain::ms_debug_class_p->register_method_func("enable_memory_profile",         SkDebug_mthdc_enable_memory_profile,  SkBindFlag_class_no_rebind);
   SkBrain::ms_debug_class_p->register_method_func("engine_present?",               mthdc_engine_presentQ,                SkBindFlag_class_no_rebind);
   SkBrain::ms_debug_class_p->register_method_func("hook_names",                    mthdc_hook_names,                     SkBindFlag_class_no_rebind);
   SkBrain::ms_debug_class_p->register_method_func("hook_condition_scope_actor",    mthdc_hook_condition_scope_actor,     SkBindFlag_class_no_rebind);
@@ -3662,6 +3797,7 @@ void SkDebug::register_bindings()
   SkBrain::ms_debug_class_p->register_method_func("hook_condition_updater_class",  mthdc_hook_condition_updater_class,   SkBindFlag_class_no_rebind);
   SkBrain::ms_debug_class_p->register_method_func("hook_enabled?",                 mthdc_hook_enabledQ,                  SkBindFlag_class_no_rebind);
   SkBrain::ms_debug_class_p->register_method_func("print_memory_execution",        SkDebug_mthdc_print_memory_execution, SkBindFlag_class_no_rebind);
+  SkBrain::ms_debug_class_p->register_method_func("print_memory_profile",          SkDebug_mthdc_print_memory_profile,   SkBindFlag_class_no_rebind);
   SkBrain::ms_debug_class_p->register_method_func("print",                         mthdc_print,                          SkBindFlag_class_no_rebind);
   SkBrain::ms_debug_class_p->register_method_func("println",                       mthdc_println,                        SkBindFlag_class_no_rebind);
   SkBrain::ms_debug_class_p->register_method_func("sym_to_str",                    mthdc_sym_to_str,                     SkBindFlag_class_no_rebind);
@@ -35,6 +35,7 @@
 #include <SkookumScript/SkLiteralClosure.hpp>
 #include <SkookumScript/SkMethodCall.hpp>
 #include <SkookumScript/SkObjectId.hpp>
+#include <SkookumScript/SkOptimizer.hpp>
 #include <SkookumScript/SkParameterBase.hpp>
 #include <SkookumScript/SkRawMember.hpp>
 #include <SkookumScript/SkRuntimeBase.hpp>
@@ -145,6 +146,20 @@ void SkExpressionBase::null_receiver(SkExpressionBase * receiver_p)
   // Default behaviour do nothing - not all expressions have sub-receiver expressions.
   }
 
+//---------------------------------------------------------------------------------------
+// Optimizes sub-expressions and then this expression where possible.
+// Returns:    expression to use in place of this one - this if it is kept.  If a different
+//             expression is returned, SkOptimizer::optimize() deletes this expression, so
+//             any sub-expression that is reused must first be detached from it.
+// Arg         optimizer - optimization context and helpers
+// See:        SkOptimizer
+// Modifiers:   virtual
+SkExpressionBase * SkExpressionBase::optimize(const SkOptimizer & optimizer)
+  {
+  // Default behaviour keep as is - leaf expressions or ones without known optimizations.
+  return this;
+  }
+
 
 #if (SKOOKUM & SK_COMPILED_OUT)
 
@@ -979,6 +994,16 @@ bool SkLoop::is_immediate(
   return m_expr_p->is_immediate(durational_idx_p);
   }
 
+//---------------------------------------------------------------------------------------
+// Optimizes sub-expressions - see SkExpressionBase::optimize()
+// Modifiers:   virtual - overridden from SkExpressionBase
+SkExpressionBase * SkLoop::optimize(const SkOptimizer & optimizer)
+  {
+  optimizer.optimize(&m_expr_p);
+
+  return this;
+  }
+
 //---------------------------------------------------------------------------------------
 // Tracks memory used by this object and its sub-objects
 // See:        SkDebug, AMemoryStats
@@ -1498,6 +1523,16 @@ void SkConversion::null_receiver(SkExpressionBase * receiver_p)
     }
   }
 
+//---------------------------------------------------------------------------------------
+// Optimizes sub-expressions - see SkExpressionBase::optimize()
+// Modifiers:   virtual - overridden from SkExpressionBase
+SkExpressionBase * SkConversion::optimize(const SkOptimizer & optimizer)
+  {
+  optimizer.optimize(&m_expr_p);
+
+  return this;
+  }
+
 //---------------------------------------------------------------------------------------
 // Tracks memory used by this object and its sub-objects
 // See:        SkDebug, AMemoryStats
@@ -1817,6 +1852,16 @@ void SkCast::null_receiver(SkExpressionBase * receiver_p)
     }
   }
 
+//---------------------------------------------------------------------------------------
+// Optimizes sub-expressions - see SkExpressionBase::optimize()
+// Modifiers:   virtual - overridden from SkExpressionBase
+SkExpressionBase * SkCast::optimize(const SkOptimizer & optimizer)
+  {
+  optimizer.optimize(&m_expr_p);
+
+  return this;
+  }
+
 //---------------------------------------------------------------------------------------
 // Tracks memory used by this object and its sub-objects
 // See:        SkDebug, AMemoryStats
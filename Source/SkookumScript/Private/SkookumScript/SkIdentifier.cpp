@@ -21,6 +21,7 @@
 #include <SkookumScript/SkBrain.hpp>
 #include <SkookumScript/SkDebug.hpp>
 #include <SkookumScript/SkObjectBase.hpp>
+#include <SkookumScript/SkOptimizer.hpp>
 #include <SkookumScript/SkClass.hpp>
 #include <SkookumScript/SkCode.hpp>
 #include <SkookumScript/SkRawMember.hpp>
@@ -515,6 +516,16 @@ void SkIdentifierMember::bind_data(
 #endif
 
 
+//---------------------------------------------------------------------------------------
+// Optimizes sub-expressions - see SkExpressionBase::optimize()
+// Modifiers:   virtual - overridden from SkExpressionBase
+SkExpressionBase * SkIdentifierMember::optimize(const SkOptimizer & optimizer)
+  {
+  optimizer.optimize(&m_owner_expr_p);
+
+  return this;
+  }
+
 //---------------------------------------------------------------------------------------
 // Tracks memory used by this object and its sub-objects
 // See:        SkDebug, AMemoryStats
@@ -121,6 +121,7 @@ class SkIdentifierMember : public SkIdentifierLocal
     virtual eSkExprType     get_type() const override;
     virtual SkInvokedBase * invoke(SkObjectBase * scope_p, SkInvokedBase * caller_p = nullptr, SkInstance ** result_pp = nullptr) const override;
     virtual void            null_receiver(SkExpressionBase * receiver_p) override;
+    virtual SkExpressionBase * optimize(const SkOptimizer & optimizer) override;
     virtual void            track_memory(AMemoryStats * mem_stats_p) const override;
 
   // Debugging Methods
@@ -225,6 +226,7 @@ class SkIdentifierClassMember : public SkIdentifierLocal
 
   // Methods
 
+    SkClass *    get_owner_class() const { return m_owner_class_p; }
     virtual bool is_local() const override;
 
     virtual void bind_data(SkInstance * obj_p, SkObjectBase * scope_p, SkInvokedBase * caller_p, bool return_result = false) override;
@@ -44,6 +44,8 @@
 //=======================================================================================
 
 AObjReusePool<SkInstance> SkInstance::ms_pool;
+AObjReusePool<SkInstance32> SkInstance32::ms_pool;
+AObjReusePool<SkInstance64> SkInstance64::ms_pool;
 
 //=======================================================================================
 // Method Definitions
@@ -454,6 +456,12 @@ void SkInstance::as_code_append(
 
   bool include_type = (code_flags & SkCodeFlag_include_type) != 0u;
 
+  // Conversion may be an atomic whose binding is still deferred
+  if (as_str_method_p && !as_str_method_p->is_bound())
+    {
+    as_str_method_p->get_scope()->register_pending_method_funcs();
+    }
+
   if (as_str_method_p && as_str_method_p->is_bound())
     {
     // $Revisit - CReis Ensure defaults used
@@ -588,4 +596,69 @@ AObjReusePool<SkInstance> & SkInstance::get_pool()
   return ms_pool;
   }
 
+//---------------------------------------------------------------------------------------
+// Get the global pool of SkInstance32 objects
+AObjReusePool<SkInstance32> & SkInstance32::get_pool()
+  {
+  return ms_pool;
+  }
+
+//---------------------------------------------------------------------------------------
+// Get the global pool of SkInstance64 objects
+AObjReusePool<SkInstance64> & SkInstance64::get_pool()
+  {
+  return ms_pool;
+  }
+
 #endif
+
+
+//=======================================================================================
+// SkInstanceCache Methods
+//=======================================================================================
+
+//---------------------------------------------------------------------------------------
+// Lets go of the cached instance
+// Notes:  Only simple values are cached so just the C++ data is destructed rather than
+//         calling the script destructor - which may already be gone when the class
+//         hierarchy is being torn down.
+void SkInstanceCache::release()
+  {
+  if (m_instance_p)
+    {
+    if (m_instance_p->get_references() == 1u)
+      {
+      (m_destruct_f)(m_instance_p);
+      m_instance_p->delete_this();
+      }
+    else
+      {
+      m_instance_p->dereference();
+      }
+
+    m_instance_p = nullptr;
+    }
+  }
+
+
+//=======================================================================================
+// SkInstance32 / SkInstance64 Method Definitions
+//=======================================================================================
+
+//---------------------------------------------------------------------------------------
+// Frees up an instance and puts it back into its own reuse pool
+// Modifiers:   virtual - overridden from SkInstance
+void SkInstance32::delete_this()
+  {
+  m_ptr_id = AIdPtr_null;
+  get_pool().recycle(this);
+  }
+
+//---------------------------------------------------------------------------------------
+// Frees up an instance and puts it back into its own reuse pool
+// Modifiers:   virtual - overridden from SkInstance
+void SkInstance64::delete_this()
+  {
+  m_ptr_id = AIdPtr_null;
+  get_pool().recycle(this);
+  }
@@ -20,6 +20,19 @@
 #include <SkookumScript/SkSymbolDefs.hpp>
 #include <AgogCore/AMath.hpp>
 
+//=======================================================================================
+// Local Global Structures
+//=======================================================================================
+
+namespace
+{
+
+  // Reused instances for SkInteger::Cached_min to SkInteger::Cached_max
+  SkInstanceCache s_cached_integers[SkInteger::Cached_max - SkInteger::Cached_min + 1];
+
+} // End unnamed namespace
+
+
 //=======================================================================================
 // Method Definitions
 //=======================================================================================
@@ -1345,3 +1358,29 @@ SkClass * SkInteger::get_class()
   {
   return ms_class_p;
   }
+
+//---------------------------------------------------------------------------------------
+// Returns an Integer instance set to value - reusing the cached instance for small values
+// if nothing else is using it.
+// See:       SkInstanceCache
+// Modifiers: static
+SkInstance * SkInteger::new_instance(tSkInteger value)
+  {
+  if ((value >= Cached_min) && (value <= Cached_max))
+    {
+    return s_cached_integers[value - Cached_min].new_instance<SkInteger>(value);
+    }
+
+  return tBindingBase::new_instance(value);
+  }
+
+//---------------------------------------------------------------------------------------
+// Lets go of the reused instances - called when the class hierarchy is torn down
+// Modifiers: static
+void SkInteger::release_cached_instances()
+  {
+  for (SkInstanceCache & cache : s_cached_integers)
+    {
+    cache.release();
+    }
+  }
@@ -32,6 +32,7 @@
 #include <SkookumScript/SkList.hpp>
 #include <SkookumScript/SkMethodCall.hpp>
 #include <SkookumScript/SkObjectBase.hpp>
+#include <SkookumScript/SkOptimizer.hpp>
 #include <SkookumScript/SkCoroutineCall.hpp>
 #include <SkookumScript/SkSymbol.hpp>
 
@@ -812,6 +813,27 @@ void SkInvocation::null_receiver(SkExpressionBase * receiver_p)
     }
   }
 
+//---------------------------------------------------------------------------------------
+// Optimizes receiver and arguments - see SkExpressionBase::optimize().
+// A plain invocation may then be folded (a built-in operation on literals) or inlined
+// (a trivial accessor on `this`) - see SkOptimizer::optimize_call().
+// Modifiers:   virtual - overridden from SkExpressionBase
+// Notes:      Also used by SkInvokeSync and SkInvokeRace which are only optimized within.
+SkExpressionBase * SkInvocation::optimize(const SkOptimizer & optimizer)
+  {
+  optimizer.optimize(&m_receiver_p);
+  optimizer.optimize_call_args(m_call_p);
+
+  if (get_type() != SkExprType_invoke)
+    {
+    return this;
+    }
+
+  SkExpressionBase * expr_p = optimizer.optimize_call(m_receiver_p, m_call_p);
+
+  return expr_p ? expr_p : this;
+  }
+
 //---------------------------------------------------------------------------------------
 // Tracks memory used by this object and its sub-objects
 // See:        SkDebug, AMemoryStats
@@ -1791,6 +1813,24 @@ void SkInvokeCascade::null_receiver(SkExpressionBase * receiver_p)
     }
   }
 
+//---------------------------------------------------------------------------------------
+// Optimizes receiver and arguments - see SkExpressionBase::optimize()
+// Modifiers:   virtual - overridden from SkExpressionBase
+SkExpressionBase * SkInvokeCascade::optimize(const SkOptimizer & optimizer)
+  {
+  optimizer.optimize(&m_receiver_p);
+
+  SkInvokeBase ** calls_pp     = m_invoke_calls.get_array();
+  SkInvokeBase ** calls_end_pp = calls_pp + m_invoke_calls.get_length();
+
+  for (; calls_pp < calls_end_pp; calls_pp++)
+    {
+    optimizer.optimize_call_args(*calls_pp);
+    }
+
+  return this;
+  }
+
 //---------------------------------------------------------------------------------------
 // Tracks memory used by this object and its sub-objects
 // See:        SkDebug, AMemoryStats
@@ -2062,6 +2102,16 @@ void SkInstantiate::null_receiver(SkExpressionBase * receiver_p)
     }
   }
 
+//---------------------------------------------------------------------------------------
+// Optimizes sub-expressions - see SkExpressionBase::optimize()
+// Modifiers:   virtual - overridden from SkExpressionBase
+SkExpressionBase * SkInstantiate::optimize(const SkOptimizer & optimizer)
+  {
+  optimizer.optimize_call_args(m_ctor_p);
+
+  return this;
+  }
+
 //---------------------------------------------------------------------------------------
 // Tracks memory used by this object and its sub-objects
 // See:        SkDebug, AMemoryStats
@@ -2356,6 +2406,17 @@ void SkCopyInvoke::null_receiver(SkExpressionBase * receiver_p)
     }
   }
 
+//---------------------------------------------------------------------------------------
+// Optimizes sub-expressions - see SkExpressionBase::optimize()
+// Modifiers:   virtual - overridden from SkExpressionBase
+SkExpressionBase * SkCopyInvoke::optimize(const SkOptimizer & optimizer)
+  {
+  optimizer.optimize_call_args(m_ctor_p);
+  optimizer.optimize_call_args(m_method_p);
+
+  return this;
+  }
+
 //---------------------------------------------------------------------------------------
 // Tracks memory used by this object and its sub-objects
 // See:        SkDebug, AMemoryStats
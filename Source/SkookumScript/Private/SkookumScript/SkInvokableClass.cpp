@@ -29,6 +29,9 @@
 // Typed class objects that are shared amongst various data-structures
 APSortedLogicalFree<SkInvokableClass> SkInvokableClass::ms_shared_classes;
 
+// Hashed look-up in front of ms_shared_classes
+SkInternCache<SkInvokableClass> SkInvokableClass::ms_intern_cache;
+
 
 //=======================================================================================
 // SkInvokableClass Method Definitions
@@ -403,6 +406,11 @@ bool SkInvokableClass::shared_ensure_references()
       }
     }
 
+  if (anything_changed)
+    {
+    ms_intern_cache.flush();
+    }
+
   // If empty, get rid of memory
   if (ms_shared_classes.is_empty())
     {
@@ -15,6 +15,7 @@
 
 #include <AgogCore/APSorted.hpp>
 #include <SkookumScript/SkContextClassBase.hpp>
+#include <SkookumScript/SkInternCache.hpp>
 #include <SkookumScript/SkParameters.hpp>
 
 
@@ -108,7 +109,7 @@ class SkInvokableClass : public SkContextClassBase
     static SkInvokableClass * get_or_create(SkClass * class_p, SkParameters * params_p, eSkInvokeTime invoke_type);
 
     static void shared_pre_empty();
-    static void shared_empty()                                    { ms_shared_classes.free_all(); }  
+    static void shared_empty()                                    { ms_intern_cache.flush(); ms_shared_classes.free_all(); }  
     static bool shared_ensure_references();
     static void shared_track_memory(AMemoryStats * mem_stats_p);
 
@@ -130,6 +131,9 @@ class SkInvokableClass : public SkContextClassBase
     // Typed Class objects that are shared amongst various data-structures
     static APSortedLogicalFree<SkInvokableClass> ms_shared_classes;
 
+    // Hashed look-up in front of ms_shared_classes - see get_or_create()
+    static SkInternCache<SkInvokableClass> ms_intern_cache;
+
   };  // SkInvokableClass
 
 
@@ -151,6 +151,7 @@ A_INLINE void SkInvokableClass::clear()
 // Author(s):   Conan Reis
 A_INLINE void SkInvokableClass::on_no_references()
   {
+  ms_intern_cache.flush();
   ms_shared_classes.free(*this);
   }
 
@@ -173,13 +174,24 @@ A_INLINE eSkClassType SkInvokableClass::get_class_type() const
 A_INLINE SkInvokableClass * SkInvokableClass::get_or_create(const SkInvokableClass & iclass)
   {
   //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-  // Look for existing matching class
-  uint32_t           find_pos;
-  SkInvokableClass * iclass_p = ms_shared_classes.get(iclass, AMatch_first_found, &find_pos);
+  // Look for existing matching class - hashed first
+  uint32_t           crc      = iclass.generate_crc32();
+  SkInvokableClass * iclass_p = ms_intern_cache.find(iclass, crc);
+
+  if (iclass_p)
+    {
+    return iclass_p;
+    }
+
+  uint32_t find_pos;
+
+  iclass_p = ms_shared_classes.get(iclass, AMatch_first_found, &find_pos);
 
   if (iclass_p)
     {
     // Found it!
+    ms_intern_cache.store(iclass_p, crc);
+
     return iclass_p;
     }
 
@@ -190,6 +202,7 @@ A_INLINE SkInvokableClass * SkInvokableClass::get_or_create(const SkInvokableCla
   // Give it extra reference for being stored in shared list.
   iclass_p->reference();
   ms_shared_classes.insert(*iclass_p, find_pos);
+  ms_intern_cache.store(iclass_p, crc);
 
   return iclass_p;
   }
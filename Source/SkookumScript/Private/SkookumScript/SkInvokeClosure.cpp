@@ -26,6 +26,7 @@
 #include <SkookumScript/SkClosure.hpp>
 #include <SkookumScript/SkIdentifier.hpp>
 #include <SkookumScript/SkInstance.hpp>
+#include <SkookumScript/SkOptimizer.hpp>
 
 
 //=======================================================================================
@@ -241,6 +242,17 @@ void SkInvokeClosureBase::null_receiver(SkExpressionBase * receiver_p)
     }
   }
 
+//---------------------------------------------------------------------------------------
+// Optimizes sub-expressions - see SkExpressionBase::optimize()
+// Modifiers:   virtual - overridden from SkExpressionBase
+SkExpressionBase * SkInvokeClosureBase::optimize(const SkOptimizer & optimizer)
+  {
+  optimizer.optimize(&m_receiver_p);
+  optimizer.optimize_array(m_invoke_info.m_arguments.get_array(), m_invoke_info.m_arguments.get_length());
+
+  return this;
+  }
+
 //---------------------------------------------------------------------------------------
 // Tracks memory used by this object and its sub-objects
 // See:        SkDebug, AMemoryStats
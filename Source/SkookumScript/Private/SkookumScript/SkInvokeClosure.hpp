@@ -57,6 +57,7 @@ class SkInvokeClosureBase : public SkExpressionBase
   // Methods
 
     virtual void null_receiver(SkExpressionBase * receiver_p) override;
+    virtual SkExpressionBase * optimize(const SkOptimizer & optimizer) override;
     virtual void track_memory(AMemoryStats * mem_stats_p) const override;
 
   // Debugging Methods
@@ -28,6 +28,7 @@
 #include <SkookumScript/SkList.hpp>
 #include <SkookumScript/SkMethodCall.hpp>
 #include <SkookumScript/SkMind.hpp>
+#include <SkookumScript/SkOptimizer.hpp>
 #include <SkookumScript/SkString.hpp>
 #include <SkookumScript/SkSymbol.hpp>
 #include <SkookumScript/SkReal.hpp>
@@ -220,6 +221,21 @@ SkLiteral::~SkLiteral()
     }
   }
 
+//---------------------------------------------------------------------------------------
+// Makes a new dynamic copy of the literal - does not need the binary round trip that
+// SkExpressionBase::as_copy() relies on so it is available in all builds.
+// Modifiers:   virtual from SkExpressionBase
+SkExpressionBase * SkLiteral::as_copy() const
+  {
+  SkLiteral * literal_p = (m_kind == Type__class)
+    ? SK_NEW(SkLiteral)(*m_data.as<SkMetaClass>())
+    : SK_NEW(SkLiteral)(m_kind, &m_data);
+
+  SKDEBUG_SET_CHAR_POS(literal_p, m_source_idx);
+
+  return literal_p;
+  }
+
 //---------------------------------------------------------------------------------------
 // This method is used to differentiate between different types of
 //             expressions when it is only known that an instance is of type
@@ -515,23 +531,24 @@ SkInvokedBase * SkLiteral::invoke(
     switch (m_kind)
       {
       case Type_boolean:
-        *result_pp = SkBoolean::new_instance(*m_data.as<tSkBoolean>());
+        *result_pp = m_instance_cache.new_instance<SkBoolean>(*m_data.as<tSkBoolean>());
         break;
 
       case Type_integer:
-        *result_pp = SkInteger::new_instance(*m_data.as<tSkInteger>());
+        *result_pp = m_instance_cache.new_instance<SkInteger>(*m_data.as<tSkInteger>());
         break;
 
       case Type_real:
-        *result_pp = SkReal::new_instance(*m_data.as<tSkReal>());
+        *result_pp = m_instance_cache.new_instance<SkReal>(*m_data.as<tSkReal>());
         break;
 
       case Type_string:
+        // Strings are not cached since their data lives on the heap
         *result_pp = SkString::new_instance(*m_data.as<AString>());
         break;
 
       case Type_symbol:
-        *result_pp = SkSymbol::new_instance(*m_data.as<ASymbol>());
+        *result_pp = m_instance_cache.new_instance<SkSymbol>(*m_data.as<ASymbol>());
         break;
 
 
@@ -1179,6 +1196,21 @@ SkInvokedBase * SkLiteralList::invoke(
   return nullptr;
   }
 
+//---------------------------------------------------------------------------------------
+// Optimizes constructor arguments and item expressions - see SkExpressionBase::optimize()
+// Modifiers:   virtual - overridden from SkExpressionBase
+SkExpressionBase * SkLiteralList::optimize(const SkOptimizer & optimizer)
+  {
+  if (m_ctor_p)
+    {
+    optimizer.optimize_call_args(m_ctor_p);
+    }
+
+  optimizer.optimize_array(m_item_exprs.get_array(), m_item_exprs.get_length());
+
+  return this;
+  }
+
 //---------------------------------------------------------------------------------------
 // Tracks memory used by this object and its sub-objects
 // See:        SkDebug, AMemoryStats
@@ -16,6 +16,7 @@
 //=======================================================================================
 
 #include <SkookumScript/SkExpressionBase.hpp>
+#include <SkookumScript/SkInstance.hpp>
 #include <SkookumScript/SkUserData.hpp>
 
 //=======================================================================================
@@ -94,6 +95,7 @@ class SkLiteral : public SkExpressionBase
 
     const AString * as_literal_string() const               { return m_data.as<AString>(); }
     const ASymbol * as_literal_symbol() const               { return m_data.as<ASymbol>(); }
+    virtual SkExpressionBase * as_copy() const override;
 
     #if (SKOOKUM & SK_COMPILED_IN)
       SkLiteral(const void ** binary_pp);
@@ -125,7 +127,7 @@ class SkLiteral : public SkExpressionBase
     virtual bool            is_nil() const override    { return (m_kind == Type__nil); }
     virtual bool            is_debug_class() const override;
     virtual SkInvokedBase * invoke(SkObjectBase * scope_p, SkInvokedBase * caller_p = nullptr, SkInstance ** result_pp = nullptr) const override;
-    void                    set(eType type, const UserData & data)  { m_kind = type; m_data = data; }
+    void                    set(eType type, const UserData & data)  { m_kind = type; m_data = data; m_instance_cache.release(); }
     virtual void            track_memory(AMemoryStats * mem_stats_p) const override;
 
   // Class Methods
@@ -153,6 +155,11 @@ class SkLiteral : public SkExpressionBase
     // each literal type, but this is simpler to implement.  [Perhaps it will be split up
     // in a future pass.]
 
+    // Instance reused for Boolean, Integer, Real and Symbol literals while it is not in use
+    // elsewhere - so evaluating the same literal repeatedly (in a loop etc.) need not
+    // allocate each time.
+    mutable SkInstanceCache m_instance_cache;
+
   };  // SkLiteral
 
 
@@ -209,6 +216,7 @@ class SkLiteralList : public SkExpressionBase
 
     virtual eSkExprType     get_type() const override;
     virtual SkInvokedBase * invoke(SkObjectBase * scope_p, SkInvokedBase * caller_p = nullptr, SkInstance ** result_pp = nullptr) const override;
+    virtual SkExpressionBase * optimize(const SkOptimizer & optimizer) override;
     virtual void            track_memory(AMemoryStats * mem_stats_p) const override;
 
   protected:
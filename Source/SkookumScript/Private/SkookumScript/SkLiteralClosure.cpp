@@ -17,6 +17,7 @@
 #include <SkookumScript/SkBrain.hpp>
 #include <SkookumScript/SkClosure.hpp>
 #include <SkookumScript/SkInvokedBase.hpp>
+#include <SkookumScript/SkOptimizer.hpp>
 #include <SkookumScript/SkSymbolDefs.hpp>
 #include <SkookumScript/SkRuntimeBase.hpp>
 
@@ -896,6 +897,19 @@ SkInvokedBase * SkLiteralClosure::invoke(
   return nullptr;
   }
 
+//---------------------------------------------------------------------------------------
+// Optimizes the receiver and the closure body - see SkExpressionBase::optimize()
+// Modifiers:   virtual - overridden from SkExpressionBase
+SkExpressionBase * SkLiteralClosure::optimize(const SkOptimizer & optimizer)
+  {
+  optimizer.optimize(&m_receiver_p);
+
+  // `this` in the closure is its captured receiver - not necessarily the current class
+  SkOptimizer::optimize_routine(m_info_p->get_invokable(), nullptr);
+
+  return this;
+  }
+
 //---------------------------------------------------------------------------------------
 // Tracks memory used by this object and its sub-objects
 // See:        SkDebug, AMemoryStats
@@ -511,20 +511,31 @@ void SkMethodFunc::invoke(
   SkInstance **     result_pp // = nullptr
   ) const
   {
-  #if (SKOOKUM & SK_DEBUG)
-    // Check to ensure that the C++ method is registered
-    // $Revisit - CReis This should be done at SkookumScript startup.
-    if (m_atomic_f == nullptr)
+  if (m_atomic_f == nullptr)
+    {
+    // Binding may just be deferred - registering it can change the type of this method
+    // in place so call again through the invoked method rather than continuing here.
+    if (get_scope()->register_pending_method_funcs())
       {
+      static_cast<SkMethodBase *>(scope_p->get_invokable())->invoke(scope_p, caller_p, result_pp);
+      return;
+      }
+
+    #if (SKOOKUM & SK_DEBUG)
       if (!ADebug::is_nested_error())
         {
         SK_ERRORX(a_str_format("Tried to call non-registered C++ method '%s'.", as_string_name().as_cstr()));
         }
+    #endif
 
-      // Probably wanted something more substantial than a nil, but it is better than nothing...
-      return;
+    // Probably wanted something more substantial than a nil, but it is better than nothing...
+    if (result_pp)
+      {
+      // nil does not need to be referenced/dereferenced
+      *result_pp = SkBrain::ms_nil_p;
       }
-  #endif
+    return;
+    }
 
   if (result_pp)
     {
@@ -670,24 +681,31 @@ void SkMethodMthd::invoke(
   SkInstance **     result_pp // = nullptr
   ) const
   {
-  #if (SKOOKUM & SK_DEBUG)
-    // Check to ensure that the C++ method is registered
-    if (m_atomic_m == nullptr)
+  if (m_atomic_m == nullptr)
+    {
+    // Binding may just be deferred - registering it can change the type of this method
+    // in place so call again through the invoked method rather than continuing here.
+    if (get_scope()->register_pending_method_funcs())
       {
+      static_cast<SkMethodBase *>(scope_p->get_invokable())->invoke(scope_p, caller_p, result_pp);
+      return;
+      }
+
+    #if (SKOOKUM & SK_DEBUG)
       if (!ADebug::is_nested_error())
         {
         SK_ERRORX(a_str_format("Tried to call non-registered C++ method '%s'.", as_string_name().as_cstr()));
         }
+    #endif
 
-      // Probably wanted something more substantial than a nil, but it is better than nothing...
-      if (result_pp)
-        {
-        // nil does not need to be referenced/dereferenced
-        *result_pp = SkBrain::ms_nil_p;
-        }
-      return;
+    // Probably wanted something more substantial than a nil, but it is better than nothing...
+    if (result_pp)
+      {
+      // nil does not need to be referenced/dereferenced
+      *result_pp = SkBrain::ms_nil_p;
       }
-  #endif
+    return;
+    }
 
   SKDEBUG_STORE_CALL(scope_p);
 
@@ -17,6 +17,7 @@
   #include <SkookumScript/SkMind.inl>
 #endif
 
+#include <SkookumScript/SkAllocProfiler.hpp>
 #include <SkookumScript/SkBoolean.hpp>
 #include <SkookumScript/SkBrain.hpp>
 #include <SkookumScript/SkDebug.hpp>
@@ -549,6 +550,10 @@ void SkMind::update_all()
 
   SKDEBUG_HOOK_SCRIPT_EXIT();
 
+  #if (SKOOKUM & SK_DEBUG)
+    SkAllocProfiler::on_frame_end();
+  #endif
+
   SkookumScript::enable_flag(SkookumScript::Flag_updating, false);
   }
 
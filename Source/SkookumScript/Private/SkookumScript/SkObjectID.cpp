@@ -195,19 +195,22 @@ SkInvokedBase * SkObjectID::invoke(
       return nullptr;
       }
 
-    // Only do look-up if not already cached
-    SkInstance * obj_p = m_obj_p;
+    // Only do look-up if not already cached and no named objects of the class were
+    // added, removed or renamed since
+    SkInstance * obj_p      = m_obj_p;
+    uint32_t     generation = m_class_p->get_object_id_generation();
 
     // Since we are storing just a weak reference to the SkInstance (i.e. it never gets dereffed)
     // don't count m_obj_p as a reference!
-    if (obj_p)
+    if (obj_p && (m_obj_generation == generation))
       {
       obj_p->reference();
       }
     else
       {
-      obj_p   = m_class_p->object_id_lookup(m_bind_name, caller_p);
-      m_obj_p = obj_p;
+      obj_p            = m_class_p->object_id_lookup(m_bind_name, caller_p);
+      m_obj_p          = obj_p;
+      m_obj_generation = generation;
       }
 
     if (obj_p == nullptr)
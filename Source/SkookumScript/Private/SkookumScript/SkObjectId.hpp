@@ -66,6 +66,10 @@ class SK_API SkObjectID : public SkExpressionBase
     // Cached smart pointer to object
     mutable AIdPtr<SkInstance> m_obj_p;
 
+    // Object ID generation of m_class_p when m_obj_p was looked up - the cache is only
+    // used while it is unchanged. See SkClass::get_object_id_generation()
+    mutable uint32_t m_obj_generation;
+
   // Common Methods
 
     SK_NEW_OPERATORS(SkObjectID);
@@ -29,6 +29,7 @@ A_INLINE SkObjectID::SkObjectID(
   : m_bind_name(name)
   , m_class_p(class_p)
   , m_flags(flags)
+  , m_obj_generation(0u)
   {
   }
 
@@ -54,6 +55,7 @@ A_INLINE SkObjectID::SkObjectID(
 //
 A_INLINE SkObjectID::SkObjectID(const void ** binary_pp)
   : m_bind_name(binary_pp) // n bytes - bind name
+  , m_obj_generation(0u)
   {
   // 4 bytes - class name id
   m_class_p = SkClass::from_binary_ref(binary_pp);
@@ -0,0 +1,685 @@
+// Copyright 1998-2019 Epic Games, Inc. All Rights Reserved.
+
+//=======================================================================================
+// SkookumScript C++ library.
+//
+// Optimization pass over loaded expression trees
+//=======================================================================================
+
+
+//=======================================================================================
+// Includes
+//=======================================================================================
+
+#include <SkookumScript/Sk.hpp> // Always include Sk.hpp first (as some builds require a designated precompiled header)
+#include <SkookumScript/SkOptimizer.hpp>
+
+#include <SkookumScript/SkBrain.hpp>
+#include <SkookumScript/SkClass.hpp>
+#include <SkookumScript/SkCode.hpp>
+#include <SkookumScript/SkCoroutine.hpp>
+#include <SkookumScript/SkIdentifier.hpp>
+#include <SkookumScript/SkInvocation.hpp>
+#include <SkookumScript/SkLiteral.hpp>
+#include <SkookumScript/SkMethod.hpp>
+#include <SkookumScript/SkParameters.hpp>
+#include <SkookumScript/SkSymbolDefs.hpp>
+
+
+//=======================================================================================
+// Local Global Structures
+//=======================================================================================
+
+namespace
+{
+
+  // Built-in operations that can be folded when called on a literal
+  enum eFoldOp
+    {
+    FoldOp__none,
+    FoldOp_add,
+    FoldOp_subtract,
+    FoldOp_multiply,
+    FoldOp_divide,
+    FoldOp_negated,
+    FoldOp_equal,
+    FoldOp_not_equal,
+    FoldOp_greater,
+    FoldOp_greater_or_equal,
+    FoldOp_less,
+    FoldOp_less_or_equal,
+    FoldOp_not,
+    FoldOp_and,
+    FoldOp_or,
+    FoldOp_nand,
+    FoldOp_nor,
+    FoldOp_xor,
+    FoldOp_nxor
+    };
+
+  //---------------------------------------------------------------------------------------
+  eFoldOp get_fold_op(const ASymbol & name)
+    {
+    return (name == ASymbol_add)                ? FoldOp_add
+      : (name == ASymbol_subtract)              ? FoldOp_subtract
+      : (name == ASymbol_multiply)              ? FoldOp_multiply
+      : (name == ASymbol_divide)                ? FoldOp_divide
+      : (name == ASymbol_negated)               ? FoldOp_negated
+      : (name == ASymbolX_equalQ)               ? FoldOp_equal
+      : (name == ASymbolX_not_equalQ)           ? FoldOp_not_equal
+      : (name == ASymbolX_greaterQ)             ? FoldOp_greater
+      : (name == ASymbolX_greater_or_equalQ)    ? FoldOp_greater_or_equal
+      : (name == ASymbolX_lessQ)                ? FoldOp_less
+      : (name == ASymbolX_less_or_equalQ)       ? FoldOp_less_or_equal
+      : (name == ASymbol_not)                   ? FoldOp_not
+      : (name == ASymbol_and)                   ? FoldOp_and
+      : (name == ASymbol_or)                    ? FoldOp_or
+      : (name == ASymbol_nand)                  ? FoldOp_nand
+      : (name == ASymbol_nor)                   ? FoldOp_nor
+      : (name == ASymbol_xor)                   ? FoldOp_xor
+      : (name == ASymbol_nxor)                  ? FoldOp_nxor
+      : FoldOp__none;
+    }
+
+  //---------------------------------------------------------------------------------------
+  // Only fold when the method is the C++ one the fold mimics - not a script override.
+  bool is_method_builtin(SkClass * class_p, const ASymbol & name)
+    {
+    SkMethodBase * method_p = class_p->find_instance_method(name);
+
+    return method_p && (method_p->get_invoke_type() != SkInvokable_method);
+    }
+
+  //---------------------------------------------------------------------------------------
+  // Applies a binary operation to two literal numbers - nullptr if it is not handled here.
+  template<class _NumType, class _LiteralType>
+  SkLiteral * fold_number(eFoldOp op, _NumType lhs, _NumType rhs)
+    {
+    switch (op)
+      {
+      case FoldOp_add:              return SK_NEW(SkLiteral)(_LiteralType(lhs + rhs));
+      case FoldOp_subtract:         return SK_NEW(SkLiteral)(_LiteralType(lhs - rhs));
+      case FoldOp_multiply:         return SK_NEW(SkLiteral)(_LiteralType(lhs * rhs));
+      case FoldOp_equal:            return SK_NEW(SkLiteral)(tSkBoolean(lhs == rhs));
+      case FoldOp_not_equal:        return SK_NEW(SkLiteral)(tSkBoolean(lhs != rhs));
+      case FoldOp_greater:          return SK_NEW(SkLiteral)(tSkBoolean(lhs > rhs));
+      case FoldOp_greater_or_equal: return SK_NEW(SkLiteral)(tSkBoolean(lhs >= rhs));
+      case FoldOp_less:             return SK_NEW(SkLiteral)(tSkBoolean(lhs < rhs));
+      case FoldOp_less_or_equal:    return SK_NEW(SkLiteral)(tSkBoolean(lhs <= rhs));
+      default:                      return nullptr;
+      }
+    }
+
+} // End unnamed namespace
+
+
+//=======================================================================================
+// Class Data
+//=======================================================================================
+
+uint32_t SkOptimizer::ms_flags = SkOptimizer::Flag__default;
+
+
+//=======================================================================================
+// Method Definitions
+//=======================================================================================
+
+//---------------------------------------------------------------------------------------
+// Optimizes the expression (and its sub-expressions) stored at the supplied address -
+// replacing it if it can be simplified.
+//
+// Params:
+//   expr_pp: address of the expression - it may point to nullptr (default arguments,
+//     implied receivers, etc.) in which case nothing is done.
+void SkOptimizer::optimize(SkExpressionBase ** expr_pp) const
+  {
+  SkExpressionBase * expr_p = *expr_pp;
+
+  if (expr_p == nullptr)
+    {
+    return;
+    }
+
+  SkExpressionBase * new_expr_p = expr_p->optimize(*this);
+
+  if (new_expr_p != expr_p)
+    {
+    #if (SKOOKUM & SK_DEBUG)
+      // Newly made expressions stand in for the source of the expression they replace
+      if (new_expr_p->m_source_idx == SkExpr_char_pos_invalid)
+        {
+        new_expr_p->m_source_idx = expr_p->m_source_idx;
+        new_expr_p->m_debug_info = expr_p->m_debug_info;
+        }
+    #endif
+
+    // Any sub-expressions that were kept have been detached from the old expression
+    delete expr_p;
+    *expr_pp = new_expr_p;
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Optimizes each expression in an array - elements may be nullptr.
+void SkOptimizer::optimize_array(SkExpressionBase ** exprs_pp, uint32_t count) const
+  {
+  SkExpressionBase ** exprs_end_pp = exprs_pp + count;
+
+  for (; exprs_pp < exprs_end_pp; exprs_pp++)
+    {
+    optimize(exprs_pp);
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Optimizes the argument expressions of a call.
+void SkOptimizer::optimize_call_args(SkInvokeBase * call_p) const
+  {
+  optimize_array(call_p->m_arguments.get_array(), call_p->m_arguments.get_length());
+  }
+
+//---------------------------------------------------------------------------------------
+// Folds or inlines a call where possible.
+//
+// Returns:
+//   Expression to use in place of the invocation or nullptr if the invocation should
+//   be kept.  A returned expression may be one of the call's arguments in which case it
+//   is detached from the call.
+//
+// Params:
+//   receiver_p: receiver of the call - nullptr if `this` is implied
+//   call_p: call to optimize
+//
+//   Both should already have had their sub-expressions optimized.
+//
+// Notes:  Called by SkInvocation - only for plain `receiver.call()` invocations since
+//         `%` and `%>` apply the call to list items and skip nil receivers.
+SkExpressionBase * SkOptimizer::optimize_call(SkExpressionBase * receiver_p, SkInvokeBase * call_p) const
+  {
+  if (call_p->m_return_args.is_filled())
+    {
+    return nullptr;
+    }
+
+  if (receiver_p == nullptr)
+    {
+    return inline_call(call_p);
+    }
+
+  return (receiver_p->get_type() == SkExprType_literal)
+    ? fold_call(*static_cast<SkLiteral *>(receiver_p), call_p)
+    : nullptr;
+  }
+
+//---------------------------------------------------------------------------------------
+// Evaluates a call to a built-in Boolean, Integer or Real method on a literal receiver
+// with a literal argument (if any).
+//
+// Returns: replacement expression or nullptr if the call cannot be folded
+SkExpressionBase * SkOptimizer::fold_call(const SkLiteral & receiver, SkInvokeBase * call_p) const
+  {
+  if (!is_flag_set(Flag_fold_constants))
+    {
+    return nullptr;
+    }
+
+  eFoldOp op = get_fold_op(call_p->get_name());
+
+  if ((op == FoldOp__none) || (call_p->m_arguments.get_length() > 1u))
+    {
+    return nullptr;
+    }
+
+  eSkInvokeType      invoke_type = call_p->get_invoke_type();
+  SkExpressionBase * arg_expr_p  = call_p->m_arguments.get_first();
+  const SkLiteral *  arg_p       = (arg_expr_p && (arg_expr_p->get_type() == SkExprType_literal))
+    ? static_cast<const SkLiteral *>(arg_expr_p)
+    : nullptr;
+
+  //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  // Boolean
+  bool value;
+
+  if (is_literal_boolean(&receiver, &value))
+    {
+    switch (invoke_type)
+      {
+      case SkInvokeType_method_boolean_and:
+      case SkInvokeType_method_boolean_or:
+      case SkInvokeType_method_boolean_nand:
+      case SkInvokeType_method_boolean_nor:
+        {
+        // Short-circuit - the argument is only evaluated if the receiver does not decide
+        // the result so only the receiver needs to be a literal.
+        bool decides = ((invoke_type == SkInvokeType_method_boolean_and) || (invoke_type == SkInvokeType_method_boolean_nand))
+          ? !value
+          : value;
+
+        if (decides)
+          {
+          // and/or give the receiver, nand/nor give it negated
+          return SK_NEW(SkLiteral)(tSkBoolean(
+            ((invoke_type == SkInvokeType_method_boolean_and) || (invoke_type == SkInvokeType_method_boolean_or))
+              ? value : !value));
+          }
+
+        bool arg_value;
+
+        if ((invoke_type == SkInvokeType_method_boolean_and) || (invoke_type == SkInvokeType_method_boolean_or))
+          {
+          // Result is just the argument
+          call_p->m_arguments.get_array()[0] = nullptr;
+
+          return arg_expr_p;
+          }
+
+        return is_literal_boolean(arg_p, &arg_value)
+          ? SK_NEW(SkLiteral)(tSkBoolean(!arg_value))
+          : nullptr;
+        }
+
+      case SkInvokeType_method_on_instance:
+        {
+        if (!is_method_builtin(SkBrain::ms_boolean_class_p, call_p->get_name()))
+          {
+          return nullptr;
+          }
+
+        if (op == FoldOp_not)
+          {
+          return arg_expr_p ? nullptr : SK_NEW(SkLiteral)(tSkBoolean(!value));
+          }
+
+        bool arg_value;
+
+        if (!is_literal_boolean(arg_p, &arg_value))
+          {
+          return nullptr;
+          }
+
+        switch (op)
+          {
+          case FoldOp_and:        return SK_NEW(SkLiteral)(tSkBoolean(value && arg_value));
+          case FoldOp_or:         return SK_NEW(SkLiteral)(tSkBoolean(value || arg_value));
+          case FoldOp_nand:       return SK_NEW(SkLiteral)(tSkBoolean(!(value && arg_value)));
+          case FoldOp_nor:        return SK_NEW(SkLiteral)(tSkBoolean(!(value || arg_value)));
+          case FoldOp_xor:
+          case FoldOp_not_equal:  return SK_NEW(SkLiteral)(tSkBoolean(value != arg_value));
+          case FoldOp_nxor:
+          case FoldOp_equal:      return SK_NEW(SkLiteral)(tSkBoolean(value == arg_value));
+          default:                return nullptr;
+          }
+        }
+
+      default:
+        return nullptr;
+      }
+    }
+
+  //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  // Integer & Real
+  SkLiteral::eType kind = receiver.get_kind();
+
+  if ((invoke_type != SkInvokeType_method_on_instance)
+    || ((kind != SkLiteral::Type_integer) && (kind != SkLiteral::Type_real))
+    || !is_method_builtin((kind == SkLiteral::Type_integer) ? SkBrain::ms_integer_class_p : SkBrain::ms_real_class_p, call_p->get_name()))
+    {
+    return nullptr;
+    }
+
+  if (op == FoldOp_negated)
+    {
+    if (arg_expr_p)
+      {
+      return nullptr;
+      }
+
+    return (kind == SkLiteral::Type_integer)
+      ? SK_NEW(SkLiteral)(tSkInteger(0u - uint32_t(*receiver.get_data().as<tSkInteger>())))
+      : SK_NEW(SkLiteral)(tSkReal(-*receiver.get_data().as<tSkReal>()));
+    }
+
+  // Mixed Integer/Real arguments are left to the runtime
+  if ((arg_p == nullptr) || (arg_p->get_kind() != kind))
+    {
+    return nullptr;
+    }
+
+  if (kind == SkLiteral::Type_integer)
+    {
+    tSkInteger lhs = *receiver.get_data().as<tSkInteger>();
+    tSkInteger rhs = *arg_p->get_data().as<tSkInteger>();
+
+    if (op == FoldOp_divide)
+      {
+      // Leave errors to happen at runtime where they can be reported
+      return ((rhs == 0) || ((rhs == -1) && (lhs == INT32_MIN)))
+        ? nullptr
+        : SK_NEW(SkLiteral)(tSkInteger(lhs / rhs));
+      }
+
+    // Arithmetic done unsigned so that overflow wraps rather than being undefined -
+    // comparisons need to be signed.
+    return (op <= FoldOp_multiply)
+      ? fold_number<uint32_t, tSkInteger>(op, uint32_t(lhs), uint32_t(rhs))
+      : fold_number<tSkInteger, tSkInteger>(op, lhs, rhs);
+    }
+
+  tSkReal lhs = *receiver.get_data().as<tSkReal>();
+  tSkReal rhs = *arg_p->get_data().as<tSkReal>();
+
+  if (op == FoldOp_divide)
+    {
+    return (rhs == 0.0f) ? nullptr : SK_NEW(SkLiteral)(tSkReal(lhs / rhs));
+    }
+
+  return fold_number<tSkReal, tSkReal>(op, lhs, rhs);
+  }
+
+//---------------------------------------------------------------------------------------
+// Replaces a call on `this` to a trivial accessor - an instance method without
+// parameters whose body is just a literal or a data member of `this` - with a copy of the
+// accessor body.
+//
+// Returns: replacement expression or nullptr if the call cannot be inlined
+//
+// Notes:
+//   The call is only inlined if it could not dispatch to some other method at runtime -
+//   i.e. no subclass of the class `this` is known to be overrides the accessor.
+SkExpressionBase * SkOptimizer::inline_call(SkInvokeBase * call_p) const
+  {
+  if (!is_flag_set(Flag_inline_accessors)
+    || (m_this_class_p == nullptr)
+    || (call_p->get_invoke_type() != SkInvokeType_method_on_instance)
+    || call_p->m_arguments.is_filled())
+    {
+    return nullptr;
+    }
+
+  const ASymbol & name     = call_p->get_name();
+  SkClass *       scope_p  = call_p->get_scope();
+  SkMethodBase *  method_p = scope_p
+    ? scope_p->find_instance_method_inherited(name)
+    : m_this_class_p->find_instance_method_inherited(name);
+
+  if ((method_p == nullptr)
+    || (method_p->get_invoke_type() != SkInvokable_method)
+    || (method_p->get_params().get_arg_count_total() != 0u)
+    || ((scope_p == nullptr) && is_overridden(*m_this_class_p, name)))
+    {
+    return nullptr;
+    }
+
+  const SkExpressionBase * body_p = static_cast<SkMethod *>(method_p)->m_expr_p;
+
+  if (body_p == nullptr)
+    {
+    return nullptr;
+    }
+
+  // The accessor may not have been optimized yet so look inside a code block that just
+  // wraps a single statement.
+  if (body_p->get_type() == SkExprType_code)
+    {
+    const SkCode * code_p = static_cast<const SkCode *>(body_p);
+
+    if (!code_p->get_temp_vars().is_empty() || (code_p->get_statements().get_length() != 1u))
+      {
+      return nullptr;
+      }
+
+    body_p = code_p->get_statements().get_first();
+    }
+
+  switch (body_p->get_type())
+    {
+    case SkExprType_literal:
+      {
+      const SkLiteral * literal_p = static_cast<const SkLiteral *>(body_p);
+
+      // `this_code` and `this_mind` refer to the accessor call itself
+      if ((literal_p->get_kind() == SkLiteral::Type__this_code) || (literal_p->get_kind() == SkLiteral::Type__this_mind))
+        {
+        return nullptr;
+        }
+
+      // The copy stands in for the call rather than the accessor body - see optimize()
+      SkExpressionBase * copy_p = literal_p->as_copy();
+
+      SKDEBUG_SET_CHAR_POS(copy_p, SkExpr_char_pos_invalid);
+
+      return copy_p;
+      }
+
+    case SkExprType_identifier_member:
+      {
+      const SkIdentifierMember * ident_p = static_cast<const SkIdentifierMember *>(body_p);
+
+      return ident_p->get_owner_expr()
+        ? nullptr
+        : SK_NEW(SkIdentifierMember)(ident_p->get_name(), ident_p->get_data_idx(), nullptr);
+      }
+
+    case SkExprType_identifier_raw_member:
+      {
+      const SkIdentifierRawMember * ident_p = static_cast<const SkIdentifierRawMember *>(body_p);
+
+      return ident_p->get_owner_expr()
+        ? nullptr
+        : SK_NEW(SkIdentifierRawMember)(ident_p->get_name(), ident_p->get_data_idx(), nullptr, ident_p->get_owner_class());
+      }
+
+    case SkExprType_identifier_class_member:
+      {
+      const SkIdentifierClassMember * ident_p = static_cast<const SkIdentifierClassMember *>(body_p);
+
+      return SK_NEW(SkIdentifierClassMember)(ident_p->get_name(), ident_p->get_data_idx(), ident_p->get_owner_class());
+      }
+
+    default:
+      return nullptr;
+    }
+  }
+
+
+//=======================================================================================
+// Class Methods
+//=======================================================================================
+
+//---------------------------------------------------------------------------------------
+// Determines if the expression is a Boolean literal and if so gets its value.
+//
+// Params:
+//   expr_p: expression to test - may be nullptr
+//   value_p: address to store the literal value
+//
+// Modifiers: static
+bool SkOptimizer::is_literal_boolean(const SkExpressionBase * expr_p, bool * value_p)
+  {
+  if (expr_p
+    && (expr_p->get_type() == SkExprType_literal)
+    && (static_cast<const SkLiteral *>(expr_p)->get_kind() == SkLiteral::Type_boolean))
+    {
+    *value_p = *static_cast<const SkLiteral *>(expr_p)->get_data().as<tSkBoolean>();
+
+    return true;
+    }
+
+  return false;
+  }
+
+//---------------------------------------------------------------------------------------
+// Determines if two expressions are Boolean, Integer or Symbol literals of the same kind
+// and if so whether the built-in equals `=` would consider them equal.
+//
+// Params:
+//   lhs_p: receiver of `=` - may be nullptr
+//   rhs_p: argument of `=` - may be nullptr
+//   equal_p: address to store the result of the comparison
+//
+// Notes:  Used to resolve `case` clauses at load time.
+// Modifiers: static
+bool SkOptimizer::is_literal_equal(const SkExpressionBase * lhs_p, const SkExpressionBase * rhs_p, bool * equal_p)
+  {
+  if ((lhs_p == nullptr) || (rhs_p == nullptr)
+    || (lhs_p->get_type() != SkExprType_literal) || (rhs_p->get_type() != SkExprType_literal))
+    {
+    return false;
+    }
+
+  const SkLiteral & lhs = *static_cast<const SkLiteral *>(lhs_p);
+  const SkLiteral & rhs = *static_cast<const SkLiteral *>(rhs_p);
+
+  if (lhs.get_kind() != rhs.get_kind())
+    {
+    return false;
+    }
+
+  switch (lhs.get_kind())
+    {
+    case SkLiteral::Type_boolean:
+      if (!is_method_builtin(SkBrain::ms_boolean_class_p, ASymbolX_equalQ))
+        {
+        return false;
+        }
+
+      *equal_p = (*lhs.get_data().as<tSkBoolean>() == *rhs.get_data().as<tSkBoolean>());
+      return true;
+
+    case SkLiteral::Type_integer:
+      if (!is_method_builtin(SkBrain::ms_integer_class_p, ASymbolX_equalQ))
+        {
+        return false;
+        }
+
+      *equal_p = (*lhs.get_data().as<tSkInteger>() == *rhs.get_data().as<tSkInteger>());
+      return true;
+
+    case SkLiteral::Type_symbol:
+      if (!is_method_builtin(SkBrain::ms_symbol_class_p, ASymbolX_equalQ))
+        {
+        return false;
+        }
+
+      *equal_p = (*lhs.as_literal_symbol() == *rhs.as_literal_symbol());
+      return true;
+
+    default:
+      return false;
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Optimizes the body of a script method or coroutine - other routines are ignored.
+//
+// Params:
+//   routine_p: routine to optimize
+//   this_class_p: class `this` is known to be an instance of in the routine or nullptr
+//     if it is not known.
+//
+// Modifiers: static
+void SkOptimizer::optimize_routine(SkInvokableBase * routine_p, SkClass * this_class_p)
+  {
+  SkOptimizer optimizer(this_class_p);
+
+  switch (routine_p->get_invoke_type())
+    {
+    case SkInvokable_method:
+      optimizer.optimize(&static_cast<SkMethod *>(routine_p)->m_expr_p);
+      break;
+
+    case SkInvokable_coroutine:
+      optimizer.optimize(&static_cast<SkCoroutine *>(routine_p)->m_expr_p);
+      break;
+
+    default:
+      break;
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Optimizes all the script routines of the class - not including its subclasses.
+//
+// Modifiers: static
+void SkOptimizer::optimize_class(SkClass * class_p)
+  {
+  if (ms_flags == Flag__none)
+    {
+    return;
+    }
+
+  const tSkMethodTable & methods = class_p->get_instance_methods();
+  SkMethodBase **        methods_pp = methods.get_array();
+  SkMethodBase **        methods_end_pp = methods_pp + methods.get_length();
+
+  for (; methods_pp < methods_end_pp; methods_pp++)
+    {
+    optimize_routine(*methods_pp, class_p);
+    }
+
+  // `this` is a class rather than an instance in class methods
+  const tSkMethodTable & class_methods = class_p->get_class_methods();
+
+  methods_pp     = class_methods.get_array();
+  methods_end_pp = methods_pp + class_methods.get_length();
+
+  for (; methods_pp < methods_end_pp; methods_pp++)
+    {
+    optimize_routine(*methods_pp, nullptr);
+    }
+
+  const tSkCoroutines & coroutines = class_p->get_coroutines();
+  SkCoroutineBase **    coroutines_pp = coroutines.get_array();
+  SkCoroutineBase **    coroutines_end_pp = coroutines_pp + coroutines.get_length();
+
+  for (; coroutines_pp < coroutines_end_pp; coroutines_pp++)
+    {
+    optimize_routine(*coroutines_pp, class_p);
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Optimizes all the script routines of the class and its subclasses.
+//
+// Modifiers: static
+void SkOptimizer::optimize_class_recurse(SkClass * class_p)
+  {
+  optimize_class(class_p);
+
+  const tSkClasses & subclasses = class_p->get_subclasses();
+  SkClass **         classes_pp = subclasses.get_array();
+  SkClass **         classes_end_pp = classes_pp + subclasses.get_length();
+
+  for (; classes_pp < classes_end_pp; classes_pp++)
+    {
+    optimize_class_recurse(*classes_pp);
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Determines if any subclass of the class overrides (or might override) the named
+// instance method.
+//
+// Notes:  Demand loaded subclasses may gain or lose methods at any time so they always
+//         count as overriding.
+// Modifiers: static
+bool SkOptimizer::is_overridden(const SkClass & cls, const ASymbol & method_name)
+  {
+  const tSkClasses & subclasses = cls.get_subclasses();
+  SkClass **         classes_pp = subclasses.get_array();
+  SkClass **         classes_end_pp = classes_pp + subclasses.get_length();
+
+  for (; classes_pp < classes_end_pp; classes_pp++)
+    {
+    SkClass * class_p = *classes_pp;
+
+    if (class_p->is_demand_loaded()
+      || class_p->find_instance_method(method_name)
+      || is_overridden(*class_p, method_name))
+      {
+      return true;
+      }
+    }
+
+  return false;
+  }
@@ -24,6 +24,7 @@
 #if (SKOOKUM & SK_CODE_IN)
 
 #include <math.h>    // Uses pow()
+#include <AgogCore/AChecksum.hpp>
 #include <AgogCore/AMath.hpp>
 #include <SkookumScript/SkBrain.hpp>
 #include <SkookumScript/SkCode.hpp>
@@ -47,6 +48,7 @@
 #include <SkookumScript/SkParameters.hpp>
 #include <SkookumScript/SkRawMember.hpp>
 #include <SkookumScript/SkRuntimeBase.hpp>
+#include <SkookumScript/SkScanner.hpp>
 #include <SkookumScript/SkSymbolDefs.hpp>
 #include <SkookumScript/SkTypedClass.hpp>
 #include <SkookumScript/SkUnaryParam.hpp>
@@ -72,6 +74,52 @@ enum
   SkParser_error_str_reserve_chars = 1024
   };
 
+// Most parsed snippets kept by invoke_script() - see SkParser::invoke_script()
+const uint32_t SkParser_invoke_cache_length = 64u;
+
+//---------------------------------------------------------------------------------------
+// Parsed invoke_script() snippet.  The cache owns m_method_p until it is handed to the
+// program update record by SkParser::invoke_cache_flush().
+struct SkInvokeCacheEntry
+  {
+  SK_NEW_OPERATORS(SkInvokeCacheEntry);
+
+  uint32_t   m_hash;
+  ASymbol    m_class_name;  // Name rather than pointer since the class could be removed by a live update
+  AString    m_code;
+  SkMethod * m_method_p;
+
+  SkInvokeCacheEntry(uint32_t hash, const ASymbol & class_name, const AString & code, SkMethod * method_p)
+    : m_hash(hash), m_class_name(class_name), m_code(code), m_method_p(method_p) {}
+  };
+
+// Least recently used first
+APArray<SkInvokeCacheEntry> SkParser_invoke_cache;
+
+// Program the cached snippets were parsed against
+tSkSessionGUID SkParser_invoke_cache_session  = 0u;
+tSkRevision    SkParser_invoke_cache_revision = 0u;
+
+//---------------------------------------------------------------------------------------
+// Hands a parsed snippet over to the program update record which keeps it alive while any
+// `branch` started by it may still be running.
+void invoke_cache_retire(const ASymbol & class_name, SkMethod * method_p)
+  {
+  SkProgramUpdateRecord * update_record_p = SkookumScript::get_program_update_record();
+
+  if (update_record_p == nullptr)
+    {
+    delete method_p;
+    return;
+    }
+
+  SkClassUpdateRecord *   class_update_record_p   = update_record_p->get_or_create_class_update_record(class_name);
+  SkRoutineUpdateRecord * routine_update_record_p = new SkRoutineUpdateRecord;
+
+  routine_update_record_p->m_previous_routine_p = method_p;
+  class_update_record_p->m_updated_routines.append(*routine_update_record_p);
+  }
+
 
 } // End unnamed namespace
 
@@ -228,6 +276,9 @@ void SkParser::deinitialize()
       }
   #endif
 
+  invoke_cache_flush();
+  SkParser_invoke_cache.empty_compact();
+
   ms_error_str = AString::ms_empty;
   }
 
@@ -951,11 +1002,7 @@ SkParser::eResult SkParser::parse_annotations(uint32_t start_pos, uint32_t * end
 
     // Find last A-Z, a-z, _, 0-9, or European character + optional '?'
     // [First char was already checked so skip]
-    uint32_t end_pos = pos;
-    if (!find(ACharMatch_not_identifier, 1u, &end_pos, pos))
-      {
-      end_pos = m_str_ref_p->m_length;
-      }
+    uint32_t end_pos = find_identifier_end(pos);
 
     // Create symbol from the name of the annotation
     uint32_t name_length = end_pos - pos;
@@ -1193,6 +1240,25 @@ SkParser::eResult SkParser::parse_annotations(uint32_t start_pos, uint32_t * end
         annotation_flags |= SkAnnotation_ue4_blueprint;
         break;
 
+      case ASymbolId_batched:
+        // This annotation is only allowed on invokables
+        if (target != SkAnnotationTarget_invokable
+         && target != SkAnnotationTarget__any)
+          {
+          result = Result_err_context_annotation_invalid;
+          goto done;
+          }
+
+        // Must not be used twice
+        if (annotation_flags & SkAnnotation_ue4_batched)
+          {
+          result = Result_err_context_annotation_duplicate;
+          goto done;
+          }
+
+        annotation_flags |= SkAnnotation_ue4_batched;
+        break;
+
       default:
         result = Result_err_context_annotation_unknown;
         goto done;
@@ -1490,10 +1556,8 @@ SkParser::eResult SkParser::parse_class_desc(
     if (cstr_a[pos] == '<')
       {
       // Could be a metaclass or a class union.
-      uint32_t end_pos = pos + 1u;
-
       // Set pos past the last A-Z, a-z, _, 0-9, or European character
-      find(ACharMatch_not_identifier, 1u, &end_pos, pos + 1u);
+      uint32_t end_pos = find_identifier_end(pos + 1u);
 
       // If it is a metaclass the end of identifier character must be '>' 
       result = (cstr_a[end_pos] == '>')
@@ -3346,9 +3410,9 @@ SkParser::eResult SkParser::parse_comment_line(
       {
       char * cstr_end_p = cstr_start_p + length - 1u;
 
-      while ((cstr_a < cstr_end_p) && (*cstr_a != '\n'))
+      if (cstr_a < cstr_end_p)
         {
-        cstr_a++;
+        cstr_a = const_cast<char *>(SkScanner::find_either(cstr_a, cstr_end_p, '\n', '\n'));
         }
 
       if (end_pos_p)
@@ -3449,7 +3513,32 @@ SkParser::eResult SkParser::parse_comment_multiline(
             break;
 
           default:
-            pos += 2u;
+            {
+            // Step by 2 as before - just without visiting the positions in between that
+            // are not `*` or `/`
+            uint32_t next_pos = pos + 2u;
+
+            while (next_pos < length)
+              {
+              uint32_t delim_pos = uint32_t(SkScanner::find_either(cstr_a + next_pos, cstr_a + length, '*', '/') - cstr_a);
+
+              if (delim_pos >= length)
+                {
+                next_pos += (length - next_pos + 1u) & ~1u;
+                break;
+                }
+
+              if (((delim_pos - next_pos) & 1u) == 0u)
+                {
+                next_pos = delim_pos;
+                break;
+                }
+
+              next_pos = delim_pos + 1u;
+              }
+
+            pos = next_pos;
+            }
           }
         }
 
@@ -4747,7 +4836,7 @@ SkExpressionBase * SkParser::parse_expression_alpha(Args & args) const
   // Find end of identifier name
   // Using find() rather than parse_name_instance(), parse_name_predicate() or
   // parse_name_symbol() since the full context is not yet known.
-  find(ACharMatch_not_identifier, 1u, &end_pos, end_pos);
+  end_pos = find_identifier_end(end_pos);
 
   SkExpressionBase * expr_p = nullptr;
   char *             cstr_a = m_str_ref_p->m_cstr_p;
@@ -5904,7 +5993,7 @@ SkParser::parse_named_specifier(
   pos++;
 
   // Set pos past the last A-Z, a-z, _, 0-9, or European character
-  find(ACharMatch_not_identifier, 1u, &end_pos, pos);
+  end_pos = find_identifier_end(pos);
 
   // Look for optional ? in predicate names (and not nil coalescing op)
   if ((cstr_a[end_pos] == '?') && (cstr_a[end_pos + 1u] != '?'))
@@ -10736,21 +10825,15 @@ SkParser::eResult SkParser::parse_literal_simple_string(
 
       while (pos < length)
         {
-        ch = cstr_a[pos];
+        pos = uint32_t(SkScanner::find_either(cstr_a + pos, cstr_a + length, '"', '\\') - cstr_a);
 
-        if (ch == '"')
+        if ((pos >= length) || (cstr_a[pos] == '"'))
           {
           break;
           }
-        else
-          {
-          if (ch == '\\')
-            {
-            pos++;
-            }
 
-          pos++;
-          }
+        // Skip escape and the character it escapes
+        pos += 2u;
         }
 
       end_pos = pos;
@@ -10775,17 +10858,23 @@ SkParser::eResult SkParser::parse_literal_simple_string(
 
       while ((pos < end_pos) && (result == Result_ok))
         {
-        ch = cstr_a[pos];
+        // Copy any run of characters up to the next escape sequence as is
+        uint32_t run_end = uint32_t(SkScanner::find_either(cstr_a + pos, cstr_a + end_pos, '\\', '\\') - cstr_a);
 
-        if (ch == '\\')
-          {
-          result = parse_literal_char_esc_seq(pos, &pos, &ch);
-          }
-        else
+        if (run_end > pos)
           {
-          pos++;
+          if (str_p)
+            {
+            ::memcpy(str_a + prev_length + length, cstr_a + pos, run_end - pos);
+            }
+
+          length += run_end - pos;
+          pos     = run_end;
+          continue;
           }
 
+        result = parse_literal_char_esc_seq(pos, &pos, &ch);
+
         if (str_p)
           {
           str_a[prev_length + length] = ch;
@@ -13569,9 +13658,8 @@ SkParser::eResult SkParser::parse_ws_any(
         break;
         }
 
-      end_pos = length;
-      find(treat_lf_as_ws ? ACharMatch_not_white_space : ACharMatch_not_white_space_except_lf, 1u, &end_pos, pos);
-      pos = end_pos;
+      end_pos = find_ws_end(pos, treat_lf_as_ws);
+      pos     = end_pos;
 
       if (pos >= length)
         {
@@ -13649,9 +13737,8 @@ SkParser::eResult SkParser::parse_ws_required(
   {
   eResult result; 
   uint32_t    end_pos;
-  uint32_t    pos = m_str_ref_p->m_length;
+  uint32_t    pos = find_ws_end(start_pos);
 
-  find(ACharMatch_not_white_space, 1u, &pos, start_pos);
   end_pos = pos;
   result  = parse_comment(pos, &end_pos);
 
@@ -13659,10 +13746,8 @@ SkParser::eResult SkParser::parse_ws_required(
     {
     do
       {
-      pos     = end_pos;
-      end_pos = m_str_ref_p->m_length;
-      find(ACharMatch_not_white_space, 1u, &end_pos, pos);
-      pos = end_pos;
+      pos     = find_ws_end(end_pos);
+      end_pos = pos;
       }
     while (parse_comment(pos, &end_pos) == Result_ok);
     }
@@ -15638,43 +15723,83 @@ SkParser::invoke_script(
     }
 
   SkClass * class_p = instance_p->get_class();
-  SkParser  parser(AString(nullptr, length + 6u, 0u));
 
-  parser.reset_scope(class_p, ASymbol_invoke_script_);
+  //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  // Reuse a previous parse of the same code on the same class if the program is unchanged
+  if ((SkParser_invoke_cache_session != SkBrain::ms_session_guid)
+    || (SkParser_invoke_cache_revision != SkBrain::ms_revision))
+    {
+    invoke_cache_flush();
+    SkParser_invoke_cache_session  = SkBrain::ms_session_guid;
+    SkParser_invoke_cache_revision = SkBrain::ms_revision;
+    }
 
-  // $Revisit - CReis Should probably make a mechanism to parse without adding fake parameters and block characters
-  parser.append("()[", 3u);
-  parser.append(code);
-  parser.append("\n]", 2u);  // Must be on the next line to ensure that it is not commented out with single line comment
+  uint32_t             hash          = AChecksum::generate_crc32(code);
+  uint32_t             cache_length  = SkParser_invoke_cache.get_length();
+  SkInvokeCacheEntry * cache_entry_p = nullptr;
+  SkMethod *           method_p      = nullptr;
 
-  //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-  // Parse code
-  SkParser::Args args;
-  SkMethod *     method_p = static_cast<SkMethod *>(parser.parse_method(args));
+  for (uint32_t idx = 0u; idx < cache_length; idx++)
+    {
+    cache_entry_p = SkParser_invoke_cache.get_at(idx);
+
+    if ((cache_entry_p->m_hash == hash) && (cache_entry_p->m_class_name == class_p->get_name()) && (cache_entry_p->m_code == code))
+      {
+      // Most recently used goes last
+      SkParser_invoke_cache.remove(idx);
+      SkParser_invoke_cache.append(*cache_entry_p);
+      method_p = cache_entry_p->m_method_p;
+      break;
+      }
+    }
 
-  if (!method_p)
+  if (method_p == nullptr)
     {
+    SkParser parser(AString(nullptr, length + 6u, 0u));
+
+    parser.reset_scope(class_p, ASymbol_invoke_script_);
+
+    // $Revisit - CReis Should probably make a mechanism to parse without adding fake parameters and block characters
+    parser.append("()[", 3u);
+    parser.append(code);
+    parser.append("\n]", 2u);  // Must be on the next line to ensure that it is not commented out with single line comment
+
     //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-    // Display Parse Error
+    // Parse code
+    SkParser::Args args;
 
-    if (print_info)
+    method_p = static_cast<SkMethod *>(parser.parse_method(args));
+
+    if (!method_p)
       {
-      // 3 chars are subtracted to account for "()[" which was added
-      SkDebug::print_parse_error(args.m_result, ms_empty, &code, args.m_end_pos - 3u, args.m_start_pos - 3u);
+      //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+      // Display Parse Error
+
+      if (print_info)
+        {
+        // 3 chars are subtracted to account for "()[" which was added
+        SkDebug::print_parse_error(args.m_result, ms_empty, &code, args.m_end_pos - 3u, args.m_start_pos - 3u);
+        }
+
+      return args.m_result;
       }
 
-    return args.m_result;
-    }
+    method_p->set_name(ASymbol_invoke_script_);
+    method_p->set_scope(class_p);
 
-  method_p->set_name(ASymbol_invoke_script_);
-  method_p->set_scope(class_p);
+    //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+    // Keep method around - when it is pushed out of the cache it is handed to the update
+    // record since it may contain `branch` statements that require the method to stay
+    // valid while the branched code is running.
+    if (cache_length >= SkParser_invoke_cache_length)
+      {
+      cache_entry_p = SkParser_invoke_cache.pop(0u);
+      invoke_cache_retire(cache_entry_p->m_class_name, cache_entry_p->m_method_p);
+      delete cache_entry_p;
+      }
 
-  //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-  // Keep method around and delete later, as it may contain `branch` statements that require the method to stay valid while the branched code is running
-  SkClassUpdateRecord * class_update_record_p = SkookumScript::get_program_update_record()->get_or_create_class_update_record(class_p->get_name());
-  SkRoutineUpdateRecord * routine_update_record_p = new SkRoutineUpdateRecord;
-  routine_update_record_p->m_previous_routine_p = method_p;
-  class_update_record_p->m_updated_routines.append(*routine_update_record_p);
+    SkParser_invoke_cache.append(*new SkInvokeCacheEntry(hash, class_p->get_name(), code, method_p));
+    }
 
   //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
   // It is a valid method so invoke it
@@ -15794,6 +15919,56 @@ SkParser::invoke_script(
   return Result_ok;
   }
 
+//---------------------------------------------------------------------------------------
+// Drops all snippets parsed and kept by invoke_script().  Their methods are handed to the
+// program update record (or deleted if there is none) so any code they started that is
+// still running stays valid until the record is purged.
+// 
+// Called automatically when the program session or revision changes and should be called
+// before the program update record is purged.
+//
+// #Modifiers static
+void SkParser::invoke_cache_flush()
+  {
+  SkInvokeCacheEntry ** entries_pp     = SkParser_invoke_cache.get_array();
+  SkInvokeCacheEntry ** entries_end_pp = entries_pp + SkParser_invoke_cache.get_length();
+
+  for (; entries_pp < entries_end_pp; entries_pp++)
+    {
+    invoke_cache_retire((*entries_pp)->m_class_name, (*entries_pp)->m_method_p);
+    }
+
+  SkParser_invoke_cache.free_all();
+  }
+
+#if (SKOOKUM & SK_DEBUG)
+
+//---------------------------------------------------------------------------------------
+// Iterates over the expressions of all snippets kept by invoke_script().  They are not
+// part of the class hierarchy so SkClass::iterate_expressions_recurse() does not see them.
+// 
+// Returns AIterateResult_early_exit if iteration stopped/aborted early or
+// AIterateResult_entire if full iteration performed.
+//
+// #Modifiers static
+eAIterateResult SkParser::invoke_cache_iterate_expressions(SkApplyExpressionBase * apply_expr_p)
+  {
+  SkInvokeCacheEntry ** entries_pp     = SkParser_invoke_cache.get_array();
+  SkInvokeCacheEntry ** entries_end_pp = entries_pp + SkParser_invoke_cache.get_length();
+
+  for (; entries_pp < entries_end_pp; entries_pp++)
+    {
+    if ((*entries_pp)->m_method_p->iterate_expressions(apply_expr_p))
+      {
+      return AIterateResult_early_exit;
+      }
+    }
+
+  return AIterateResult_entire;
+  }
+
+#endif  // (SKOOKUM & SK_DEBUG)
+
 //---------------------------------------------------------------------------------------
 // Determines if symbol id represents an operator word:
 //   and, or, xor, nand, nor, nxor, not
@@ -15912,10 +16087,8 @@ void SkParser::parse_name_symbol(
   {
   uint32_t pos = *end_pos_p;  // Set pos to current position
   
-  *end_pos_p = m_str_ref_p->m_length;
-      
   // Set pos past the last A-Z, a-z, _, 0-9, or European character
-  find(ACharMatch_not_identifier, 1u, end_pos_p, pos);
+  *end_pos_p = find_identifier_end(pos);
 
   // $Revisit - CReis [Lexical Check] Give warning if name too long.
   //result = ((pos - start_pos) <= SkParser_ident_length_max) ? Result_ok : Result_warn_ident_too_long;
@@ -15991,10 +16164,7 @@ SkParser::parse_name_data_member(
   //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
   // Find last A-Z, a-z, _, 0-9, or European character + optional '?'
   // [First char was already checked so skip]
-  if (!find(ACharMatch_not_identifier, 1u, &pos, pos))
-    {
-    pos = m_str_ref_p->m_length;
-    }
+  pos = find_identifier_end(pos);
 
   //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
   // Determine if it is a predicate/query name (and not nil coalescing op ??)
@@ -16082,10 +16252,7 @@ SkParser::parse_name_predicate(
 
   // Find last A-Z, a-z, _, 0-9, or European character + optional '?'
   // [First char was already checked so skip]
-  if (!find(ACharMatch_not_identifier, 1u, &pos, pos))
-    {
-    pos = m_str_ref_p->m_length;
-    }
+  pos = find_identifier_end(pos);
 
   // Determine if it is a predicate/query name (and not a nil coalescing op ??)
   bool predicate = false;
@@ -16,6 +16,7 @@
 #include <SkookumScript/SkBoolean.hpp>
 #include <SkookumScript/SkInteger.hpp>
 #include <SkookumScript/SkReal.hpp>
+#include <SkookumScript/SkReplay.hpp>
 #include <SkookumScript/SkSymbolDefs.hpp>
 
 
@@ -30,6 +31,20 @@
 namespace SkRandom_Impl
   {
 
+  //---------------------------------------------------------------------------------------
+  // Skoo Params Random@!() Random
+  // [See script file.]
+  // C++ Args    See tSkMethodFunc or tSkMethodMthd in SkookumScript/SkMethod.hpp
+  // Notes:      The time based seed is passed through SkReplay so that a recorded session
+  //             can be replayed with the same random sequences.
+  static void mthd_ctor(SkInvokedMethod * scope_p, SkInstance ** result_pp)
+    {
+    // Results are ignored for constructors
+    ARandom & random = scope_p->get_this()->construct<SkRandom>();
+
+    random.set_seed(SkReplay::on_seed(random.get_seed()));
+    }
+
   //---------------------------------------------------------------------------------------
   // Skoo Params Random@!seed(Integer seed) Random
   // [See script file.]
@@ -326,6 +341,7 @@ namespace SkRandom_Impl
   // Array listing all the above methods
   static const SkClass::MethodInitializerFunc methods_i[] =
     {
+      { "!",              mthd_ctor },
       { "!seed",          mthd_ctor_seed },
       { "seed",           mthd_seed },
       { "seed_set",       mthd_seed_set },
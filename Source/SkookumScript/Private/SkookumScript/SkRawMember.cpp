@@ -21,6 +21,7 @@
 #include <SkookumScript/SkDebug.hpp>
 #include <SkookumScript/SkClass.hpp>
 #include <SkookumScript/SkInvocation.hpp>
+#include <SkookumScript/SkOptimizer.hpp>
 
 
 //=======================================================================================
@@ -440,6 +441,18 @@ SkInvokedBase * SkRawMemberAssignment::invoke(SkObjectBase * scope_p, SkInvokedB
   return nullptr;
   }
 
+//---------------------------------------------------------------------------------------
+// Optimizes the value expression - see SkExpressionBase::optimize()
+// Modifiers:   virtual - overridden from SkExpressionBase
+// Notes:      The owner is left as is since it determines which raw data is written to -
+//             inlining an accessor there would write to the member rather than to a copy.
+SkExpressionBase * SkRawMemberAssignment::optimize(const SkOptimizer & optimizer)
+  {
+  optimizer.optimize(&m_value_expr_p);
+
+  return this;
+  }
+
 //---------------------------------------------------------------------------------------
 // Tracks memory used by this object and its sub-objects
 // See:        SkDebug, AMemoryStats
@@ -709,6 +722,17 @@ bool SkRawMemberModifyingInvocation::is_immediate(uint32_t * durational_idx_p /*
 
   }
 
+//---------------------------------------------------------------------------------------
+// Optimizes the call arguments - see SkExpressionBase::optimize()
+// Modifiers:   virtual - overridden from SkExpressionBase
+// Notes:      The owner is left as is - see SkRawMemberAssignment::optimize()
+SkExpressionBase * SkRawMemberModifyingInvocation::optimize(const SkOptimizer & optimizer)
+  {
+  optimizer.optimize_call_args(m_call_p);
+
+  return this;
+  }
+
 //---------------------------------------------------------------------------------------
 // Tracks memory used by this object and its sub-objects
 // See:        SkDebug, AMemoryStats
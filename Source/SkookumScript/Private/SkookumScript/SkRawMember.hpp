@@ -177,6 +177,7 @@ class SkRawMemberAssignment : public SkRawMemberBase
 
     virtual eSkExprType     get_type() const override;
     virtual SkInvokedBase * invoke(SkObjectBase * scope_p, SkInvokedBase * caller_p = nullptr, SkInstance ** result_pp = nullptr) const override;
+    virtual SkExpressionBase * optimize(const SkOptimizer & optimizer) override;
     virtual void            track_memory(AMemoryStats * mem_stats_p) const override;
 
   // Debugging Methods
@@ -228,6 +229,7 @@ class SkRawMemberModifyingInvocation : public SkRawMemberBase
     virtual eSkExprType     get_type() const override;
     virtual SkInvokedBase * invoke(SkObjectBase * scope_p, SkInvokedBase * caller_p = nullptr, SkInstance ** result_pp = nullptr) const override;
     virtual bool            is_immediate(uint32_t * durational_idx_p = nullptr) const override;
+    virtual SkExpressionBase * optimize(const SkOptimizer & optimizer) override;
     virtual void            track_memory(AMemoryStats * mem_stats_p) const override;
 
   // Debugging Methods
@@ -58,6 +58,13 @@ A_INLINE SkInstance * SkRawMemberHandle::new_instance() const
   {
   if (m_obj_p)
     {
+    // Plain old data at fixed offset - copy straight into a new (or reused) instance
+    if (m_typed_name_p->m_raw_pod_class_p)
+      {
+      return m_typed_name_p->new_raw_pod_instance(
+        static_cast<uint8_t *>(m_obj_p) + m_typed_name_p->m_raw_data_info.InternalOffset);
+      }
+
     SkClassDescBase * data_type_p = m_typed_name_p->m_type_p; // Type of the data member itself
     return data_type_p->get_key_class()->new_instance_from_raw_data(m_obj_p, m_typed_name_p->m_raw_data_info, data_type_p);
     }
@@ -71,6 +78,18 @@ A_INLINE void SkRawMemberHandle::assign(SkInstance * value_p) const
   {
   if (m_obj_p)
     {
+    // Plain old data at fixed offset - copy straight out of the value instance
+    if (m_typed_name_p->m_raw_pod_class_p)
+      {
+      uint32_t byte_size = uint32_t(m_typed_name_p->m_raw_data_info.Size);
+
+      ::memcpy(
+        static_cast<uint8_t *>(m_obj_p) + m_typed_name_p->m_raw_data_info.InternalOffset,
+        value_p->get_raw_pointer(byte_size),
+        byte_size);
+      return;
+      }
+
     SkClassDescBase * data_type_p = m_typed_name_p->m_type_p; // Type of the data member itself
     data_type_p->get_key_class()->assign_raw_data(m_obj_p, m_typed_name_p->m_raw_data_info, data_type_p, value_p);
     }
@@ -245,8 +245,8 @@ namespace SkReal_Impl
     // Do nothing if result not desired
     if (result_pp)
       {
-      *result_pp = SkReal::new_instance(
-        scope_p->this_as<SkReal>() + scope_p->get_arg<SkReal>(SkArg_1));
+      *result_pp = SkReal::new_instance_reuse(
+        scope_p->get_arg(SkArg_1), scope_p->this_as<SkReal>() + scope_p->get_arg<SkReal>(SkArg_1));
       }
     }
 
@@ -302,8 +302,8 @@ namespace SkReal_Impl
     // Do nothing if result not desired
     if (result_pp)
       {
-      *result_pp = SkReal::new_instance(
-        scope_p->this_as<SkReal>() - scope_p->get_arg<SkReal>(SkArg_1));
+      *result_pp = SkReal::new_instance_reuse(
+        scope_p->get_arg(SkArg_1), scope_p->this_as<SkReal>() - scope_p->get_arg<SkReal>(SkArg_1));
       }
     }
 
@@ -359,8 +359,8 @@ namespace SkReal_Impl
     // Do nothing if result not desired
     if (result_pp)
       {
-      *result_pp = SkReal::new_instance(
-        scope_p->this_as<SkReal>() * scope_p->get_arg<SkReal>(SkArg_1));
+      *result_pp = SkReal::new_instance_reuse(
+        scope_p->get_arg(SkArg_1), scope_p->this_as<SkReal>() * scope_p->get_arg<SkReal>(SkArg_1));
       }
     }
 
@@ -407,8 +407,8 @@ namespace SkReal_Impl
     // Do nothing if result not desired
     if (result_pp)
       {
-      *result_pp = SkReal::new_instance(
-        scope_p->this_as<SkReal>() / scope_p->get_arg<SkReal>(SkArg_1));
+      *result_pp = SkReal::new_instance_reuse(
+        scope_p->get_arg(SkArg_1), scope_p->this_as<SkReal>() / scope_p->get_arg<SkReal>(SkArg_1));
       }
     }
 
@@ -15,11 +15,14 @@
 
 #include <SkookumScript/Sk.hpp> // Always include Sk.hpp first (as some builds require a designated precompiled header)
 #include <SkookumScript/SkRemoteBase.hpp>
+#include <SkookumScript/SkBrain.hpp>
 #include <SkookumScript/SkClass.hpp>
 #include <SkookumScript/SkDebug.hpp>
 #include <AgogCore/ABinaryParse.hpp>
+#include <AgogCore/ACompress.hpp>
 #include <AgogCore/ADatum.hpp>
 #include <AgogCore/AFunctionArg.hpp>
+#include <AgogCore/APArray.hpp>
 #include <AgogCore/ASymbolTable.hpp>
 
 
@@ -54,7 +57,9 @@ const uint8_t SkRemoteBase::ms_version = 8u;
 SkRemoteBase::SkRemoteBase() :
   m_mode(SkLocale_embedded),
   m_connect_state(ConnectState_disconnected),
-  m_remote_flags(SkRemoteFlag_none)
+  m_remote_flags(SkRemoteFlag_none),
+  m_chunk_in_received(0u),
+  m_symbols_sent_session(0u)
   {
   if (ms_default_p == nullptr)
     {
@@ -112,6 +117,70 @@ bool SkRemoteBase::should_class_ctors_be_called() const
 
 #ifdef SKOOKUM_REMOTE
 
+//---------------------------------------------------------------------------------------
+// Sends a fully composed command to the remote side.  All commands should go through
+// here rather than calling on_cmd_send() directly.
+// 
+// If the remote side accepts compression and the command is large enough it is split
+// into Command_compressed_chunk pieces of at most SkRemote_chunk_length uncompressed
+// bytes that are each compressed independently.  This keeps individual socket sends
+// small and lets the receiver spread a large command over several updates.
+// 
+// Binary composition of each chunk:
+//   4 bytes - Command_compressed_chunk
+//   4 bytes - total uncompressed length of the wrapped command (including its id)
+//   4 bytes - uncompressed offset of this chunk
+//   4 bytes - uncompressed length of this chunk
+//   n bytes - ACompress block or, if it would not have been smaller, the raw bytes
+//             (compressed length == uncompressed length indicates raw)
+SkRemoteBase::eSendResponse SkRemoteBase::cmd_send(const ADatum & datum)
+  {
+  uint32_t data_length = datum.get_data_length();
+
+  if (!is_compression_remote() || (data_length < SkRemote_compress_length_min))
+    {
+    return on_cmd_send(datum);
+    }
+
+  const uint8_t * data_p   = datum.get_data();
+  uint32_t        cmd      = Command_compressed_chunk;
+  eSendResponse   response = SendResponse_OK;
+  uint32_t        chunk_length;
+  uint32_t        packed_length;
+  ADatum          chunk(SkRemote_chunk_header_byte_size + ACompress::get_bound(SkRemote_chunk_length));
+
+  for (uint32_t offset = 0u; offset < data_length; offset += chunk_length)
+    {
+    chunk_length = a_min(SkRemote_chunk_length, data_length - offset);
+
+    uint8_t *  chunk_p  = chunk.get_data_writable(false);
+    uint8_t ** chunk_pp = &chunk_p;
+
+    A_BYTE_STREAM_OUT32(chunk_pp, &cmd);
+    A_BYTE_STREAM_OUT32(chunk_pp, &data_length);
+    A_BYTE_STREAM_OUT32(chunk_pp, &offset);
+    A_BYTE_STREAM_OUT32(chunk_pp, &chunk_length);
+
+    packed_length = ACompress::compress(data_p + offset, chunk_length, chunk_p);
+
+    if (packed_length >= chunk_length)
+      {
+      ::memcpy(chunk_p, data_p + offset, chunk_length);
+      packed_length = chunk_length;
+      }
+
+    chunk.set_data_length(SkRemote_chunk_header_byte_size + packed_length);
+    response = on_cmd_send(chunk);
+
+    if (response != SendResponse_OK)
+      {
+      break;
+      }
+    }
+
+  return response;
+  }
+
 //---------------------------------------------------------------------------------------
 // Notifies the remote side of a simple command that has no associated data.
 //             Use this rather than making a bunch of commands that are otherwise identical.
@@ -135,7 +204,7 @@ void SkRemoteBase::cmd_simple(eCommand cmd)
   // 4 bytes - command id
   A_BYTE_STREAM_OUT32(data_pp, &cmd);
 
-  on_cmd_send(datum);
+  cmd_send(datum);
   }
 
 //---------------------------------------------------------------------------------------
@@ -167,7 +236,7 @@ void SkRemoteBase::cmd_simple_uint32(eCommand cmd, uint32_t value)
   // 4 bytes - value
   A_BYTE_STREAM_OUT32(data_pp, &value);
 
-  on_cmd_send(datum);
+  cmd_send(datum);
   }
 
 //---------------------------------------------------------------------------------------
@@ -185,7 +254,7 @@ SkRemoteBase::eSendResponse SkRemoteBase::cmd_ping_test()
   
   A_BYTE_STREAM_OUT32(data_pp, &cmd);
 
-  return on_cmd_send(datum);
+  return cmd_send(datum);
   }
 
 //---------------------------------------------------------------------------------------
@@ -211,7 +280,7 @@ void SkRemoteBase::cmd_print(const AString & str, uint32_t type)
 
   ::memcpy(data_p, str.as_cstr(), str_len);
 
-  on_cmd_send(datum);
+  cmd_send(datum);
   }
 
 //---------------------------------------------------------------------------------------
@@ -231,7 +300,83 @@ void SkRemoteBase::cmd_invoke(const AString & code)
 
   ::memcpy(data_p, code.as_cstr(), str_len);
 
-  on_cmd_send(datum);
+  cmd_send(datum);
+  }
+
+//---------------------------------------------------------------------------------------
+// Invoke several code snippets on remote side with a single command.  The remote side
+// runs them in order within a per-update time budget and sends each result back with
+// its own Command_invoke_result as soon as it is available.
+// 
+// Params:
+//   codes_p:    array of script code to invoke
+//   code_count: number of elements in codes_p
+void SkRemoteBase::cmd_invoke_batch(const AString * codes_p, uint32_t code_count)
+  {
+  //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  // Binary composition:
+  //   4 bytes - command id
+  //   4 bytes - number of snippets
+  //   n bytes - snippet string }- Repeating
+  uint32_t data_length = 8u;
+
+  for (uint32_t idx = 0u; idx < code_count; idx++)
+    {
+    data_length += codes_p[idx].as_binary_length();
+    }
+
+  ADatum  datum(data_length);
+  void *  data_p  = datum.get_data_writable();
+  void ** data_pp = &data_p;
+
+  uint32_t cmd = Command_invoke_batch;
+
+  A_BYTE_STREAM_OUT32(data_pp, &cmd);
+  A_BYTE_STREAM_OUT32(data_pp, &code_count);
+
+  for (uint32_t idx = 0u; idx < code_count; idx++)
+    {
+    codes_p[idx].as_binary(data_pp);
+    }
+
+  cmd_send(datum);
+  }
+
+//---------------------------------------------------------------------------------------
+// Asks the remote runtime for its SkAllocProfiler counts - answered with one or more
+// Command_memory_reply.
+// 
+// Params:
+//   action:         see eMemoryAction
+//   frame_interval: frames between replies for MemoryAction_stream
+//   top_count:      number of routines with the most allocations to include
+void SkRemoteBase::cmd_memory(
+  eMemoryAction action,
+  uint32_t      frame_interval, // = 1u
+  uint32_t      top_count       // = 20u
+  )
+  {
+  //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  // Binary composition:
+  //   4 bytes - command id
+  //   1 byte  - eMemoryAction
+  //   2 bytes - frame interval
+  //   2 bytes - top count
+  ADatum  datum(9u);
+  void *  data_p  = datum.get_data_writable();
+  void ** data_pp = &data_p;
+
+  uint32_t cmd      = Command_memory;
+  uint8_t  action8  = uint8_t(action);
+  uint16_t interval = uint16_t(a_min(frame_interval, uint32_t(UINT16_MAX)));
+  uint16_t top16    = uint16_t(a_min(top_count, uint32_t(UINT16_MAX)));
+
+  A_BYTE_STREAM_OUT32(data_pp, &cmd);
+  A_BYTE_STREAM_OUT8(data_pp, &action8);
+  A_BYTE_STREAM_OUT16(data_pp, &interval);
+  A_BYTE_STREAM_OUT16(data_pp, &top16);
+
+  cmd_send(datum);
   }
 
 //---------------------------------------------------------------------------------------
@@ -254,16 +399,58 @@ void SkRemoteBase::cmd_invoke_result(const AString & str)
 
   ::memcpy(data_p, str.as_cstr(), str_len);
 
-  on_cmd_send(datum);
+  cmd_send(datum);
   }
 
 //---------------------------------------------------------------------------------------
 // Send local symbols to remote side to merge with existing remote symbols
 // Arg         syms - symbols to merge into remote side
+// Notes:      Only symbols not already sent during this connection and program session
+//             are transmitted - the remote side merges rather than replaces symbols so
+//             it already has the rest.  Nothing is sent if there are no new symbols.
 // Author(s):   Conan Reis
 void SkRemoteBase::cmd_symbols_update(const ASymbolTable & syms)
   {
-  uint32_t  syms_len = syms.as_binary_length();
+  if (m_symbols_sent_session != SkBrain::ms_session_guid)
+    {
+    m_symbols_sent.empty();
+    m_symbols_sent_session = SkBrain::ms_session_guid;
+    }
+
+  //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  // Determine new symbols - both are sorted by id so walk them together
+  uint32_t            sym_count  = syms.get_length();
+  const uint32_t *    sent_p     = m_symbols_sent.get_array();
+  const uint32_t *    sent_end_p = sent_p + m_symbols_sent.get_length();
+  uint32_t            syms_len   = 4u;  // symbol_count(4)
+  ASymbolRef *        sym_ref_p;
+  APArray<ASymbolRef> new_syms;
+
+  for (uint32_t idx = 0u; idx < sym_count; idx++)
+    {
+    sym_ref_p = syms.get_symbol_by_index(idx);
+
+    while ((sent_p < sent_end_p) && (*sent_p < sym_ref_p->m_uid))
+      {
+      sent_p++;
+      }
+
+    if ((sent_p == sent_end_p) || (*sent_p != sym_ref_p->m_uid))
+      {
+      new_syms.append(*sym_ref_p);
+      syms_len += 5u + sym_ref_p->m_str_ref_p->m_length;  // sym_id(4) + string_length(1) + string
+      }
+    }
+
+  uint32_t new_count = new_syms.get_length();
+
+  if (new_count == 0u)
+    {
+    return;
+    }
+
+  //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  // Same layout as ASymbolTable::as_binary() so the remote side merges it as before
   ADatum    datum(static_cast<uint32_t>(sizeof(uint32_t)) + syms_len);
   uint8_t * data_p  = datum.get_data_writable();
   void ** data_pp = (void **)&data_p;
@@ -271,10 +458,33 @@ void SkRemoteBase::cmd_symbols_update(const ASymbolTable & syms)
   uint32_t cmd = Command_symbol_update;
 
   A_BYTE_STREAM_OUT32(data_pp, &cmd);
+  A_BYTE_STREAM_OUT32(data_pp, &new_count);
+
+  uint8_t       str_len;
+  ASymbolRef ** syms_pp     = new_syms.get_array();
+  ASymbolRef ** syms_end_pp = syms_pp + new_count;
+
+  for (; syms_pp < syms_end_pp; syms_pp++)
+    {
+    sym_ref_p = *syms_pp;
+    str_len   = uint8_t(sym_ref_p->m_str_ref_p->m_length);
 
-  syms.as_binary(data_pp);
+    // 4 bytes - symbol id
+    A_BYTE_STREAM_OUT32(data_pp, &sym_ref_p->m_uid);
+
+    // 1 byte  - length of string
+    A_BYTE_STREAM_OUT8(data_pp, &str_len);
+
+    // n bytes - string
+    ::memcpy(*data_pp, sym_ref_p->m_str_ref_p->m_cstr_p, str_len);
+    (*(uint8_t **)data_pp) += str_len;
+
+    m_symbols_sent.append(sym_ref_p->m_uid);
+    }
 
-  on_cmd_send(datum);
+  m_symbols_sent.sort();
+
+  cmd_send(datum);
   }
 
 //---------------------------------------------------------------------------------------
@@ -378,6 +588,14 @@ bool SkRemoteBase::on_cmd_recv(eCommand cmd, const uint8_t * data_p, uint32_t da
       ASymbol::table_from_binary(data_pp);
       break;
 
+    //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+    case Command_compressed_chunk:
+      if (!on_cmd_compressed_chunk(data_p, data_length))
+        {
+        ADebug::print("SkookumScript: Remote side sent malformed compressed command - ignored!\n");
+        }
+      break;
+
     //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
     default:
       return false;
@@ -386,6 +604,82 @@ bool SkRemoteBase::on_cmd_recv(eCommand cmd, const uint8_t * data_p, uint32_t da
   return true;
   }
 
+//---------------------------------------------------------------------------------------
+// Receives one piece of a command sent with cmd_send() and once all of its pieces have
+// arrived dispatches the reassembled command through on_cmd_recv().
+// 
+// Returns:    false if the chunk was malformed (any partially received command is dropped)
+// Params:
+//   data_p:      chunk data following the Command_compressed_chunk id
+//   data_length: length of chunk data in bytes
+//   
+// See:        cmd_send()
+bool SkRemoteBase::on_cmd_compressed_chunk(const uint8_t * data_p, uint32_t data_length)
+  {
+  if (data_length < SkRemote_chunk_header_byte_size - sizeof(uint32_t))
+    {
+    m_chunk_in_received = 0u;
+    return false;
+    }
+
+  const uint8_t ** data_pp = &data_p;
+
+  uint32_t total_length  = A_BYTE_STREAM_UI32_INC(data_pp);
+  uint32_t offset        = A_BYTE_STREAM_UI32_INC(data_pp);
+  uint32_t chunk_length  = A_BYTE_STREAM_UI32_INC(data_pp);
+  uint32_t packed_length = data_length - (SkRemote_chunk_header_byte_size - sizeof(uint32_t));
+
+  // Chunks arrive in order over the stream socket so a new command starts at offset 0
+  if (offset == 0u)
+    {
+    m_chunk_in.ensure_size(total_length, false);
+    m_chunk_in.set_data_length(total_length);
+    m_chunk_in_received = 0u;
+    }
+
+  if ((offset != m_chunk_in_received)
+    || (total_length < sizeof(uint32_t))
+    || (total_length != m_chunk_in.get_data_length())
+    || (chunk_length > total_length - offset))
+    {
+    m_chunk_in_received = 0u;
+    return false;
+    }
+
+  uint8_t * buffer_p = m_chunk_in.get_data_writable();
+
+  if (packed_length == chunk_length)
+    {
+    ::memcpy(buffer_p + offset, data_p, chunk_length);
+    }
+  else
+    {
+    if (!ACompress::decompress(data_p, packed_length, buffer_p + offset, chunk_length))
+      {
+      m_chunk_in_received = 0u;
+      return false;
+      }
+    }
+
+  m_chunk_in_received += chunk_length;
+
+  if (m_chunk_in_received == total_length)
+    {
+    m_chunk_in_received = 0u;
+
+    const uint8_t * cmd_data_p = buffer_p;
+    uint32_t        cmd        = A_BYTE_STREAM_UI32_INC(&cmd_data_p);
+
+    // Nested chunks are never sent
+    if (cmd != Command_compressed_chunk)
+      {
+      on_cmd_recv(eCommand(cmd), cmd_data_p, total_length - sizeof(uint32_t));
+      }
+    }
+
+  return true;
+  }
+
 #endif  // SKOOKUM_REMOTE
 
 
@@ -444,6 +738,14 @@ void SkRemoteBase::set_connect_state(eConnectState state)
   if (old_state != state)
     {
     m_connect_state = state;
+
+    // Transport state only applies to a single connection
+    if (state == ConnectState_connecting)
+      {
+      m_chunk_in_received = 0u;
+      m_symbols_sent.empty();
+      }
+
     on_connect_change(old_state);
     }
   }
@@ -480,6 +782,13 @@ void SkRemoteBase::on_class_updated(SkClass * class_p)
   class_p->iterate_recurse(&class_func);
   }
 
+//---------------------------------------------------------------------------------------
+// Called once after all classes of a live update have been passed to on_class_updated()
+// so that work spanning all classes only needs to be done once per update.
+void SkRemoteBase::on_class_updates_end(uint32_t updated_class_count)
+  {
+  }
+
 //#pragma optimize("g", on)
 
 //---------------------------------------------------------------------------------------
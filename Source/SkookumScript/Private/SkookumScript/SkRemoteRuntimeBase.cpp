@@ -22,8 +22,10 @@
 #include <AgogCore/ADatum.hpp>
 #include <AgogCore/ARandom.hpp>
 #include <SkookumScript/SkRuntimeBase.hpp>
+#include <SkookumScript/SkAllocProfiler.hpp>
 #include <SkookumScript/SkClass.hpp>
 #include <SkookumScript/SkBrain.hpp>
+#include <SkookumScript/SkParser.hpp>
 #include <SkookumScript/SkSymbolDefs.hpp>
 
 #ifdef A_PLAT_PC
@@ -71,7 +73,10 @@ SkRemoteRuntimeBase::SkRemoteRuntimeBase() :
   m_suspend_count(0u),
   m_pending_count(0u),
   m_part_count(0u),
-  m_error_count(0u)
+  m_error_count(0u),
+  m_memory_interval(0u),
+  m_memory_next_frame(0u),
+  m_memory_top_count(0u)
   {
   ms_client_p = this;
   }
@@ -370,7 +375,7 @@ void SkRemoteRuntimeBase::cmd_version_reply(uint8_t server_version, uint32_t aut
 
   A_BYTE_STREAM_OUT32(data_pp, &auth_id);
 
-  uint32_t client_flags = SkRemoteFlag_none;
+  uint32_t client_flags = SkRemoteFlag_compression;
 
   #ifdef A_SYMBOL_STR_DB
     //#pragma A_LOG("Symbols converted to strings by client.")
@@ -386,7 +391,7 @@ void SkRemoteRuntimeBase::cmd_version_reply(uint8_t server_version, uint32_t aut
 
   SkDebug::print("Skookum RT: Sending authentication back.\n", SkLocale_local);
 
-  on_cmd_send(datum);
+  cmd_send(datum);
   }
 
 //---------------------------------------------------------------------------------------
@@ -428,7 +433,7 @@ void SkRemoteRuntimeBase::cmd_compiled_state(bool freshen)
   // n bytes - project info
   project_info.as_binary(data_pp);
 
-  on_cmd_send(datum);
+  cmd_send(datum);
   }
 
 //---------------------------------------------------------------------------------------
@@ -493,7 +498,7 @@ void SkRemoteRuntimeBase::cmd_show(
   uint8_t focus_member_class_scope8 = (uint8_t)focus_member_class_scope;
   A_BYTE_STREAM_OUT8(data_pp, &focus_member_class_scope8);
 
-  on_cmd_send(datum);
+  cmd_send(datum);
 
   if (reconnected)
     {
@@ -519,7 +524,7 @@ void SkRemoteRuntimeBase::cmd_make_editable_reply(const AString & error_msg, con
   error_msg.as_binary(data_pp);
   project_info.as_binary(data_pp);
 
-  on_cmd_send(datum);
+  cmd_send(datum);
   }
 
 //---------------------------------------------------------------------------------------
@@ -539,7 +544,7 @@ void SkRemoteRuntimeBase::cmd_incremental_update_reply(bool is_success, tSkSessi
   A_BYTE_STREAM_OUT64(data_pp, &session_guid);
   A_BYTE_STREAM_OUT32(data_pp, &revision);
 
-  on_cmd_send(datum);
+  cmd_send(datum);
   }
 
 //---------------------------------------------------------------------------------------
@@ -608,7 +613,7 @@ bool SkRemoteRuntimeBase::cmd_recompile_classes(
   // 1 byte - recurse subclasses (true) or not (false)
   A_BYTE_STREAM_OUT8(data_pp, &recurse);
 
-  on_cmd_send(datum);
+  cmd_send(datum);
 
 
   //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
@@ -721,7 +726,7 @@ void SkRemoteRuntimeBase::cmd_breakpoint_hit(const SkBreakPoint & bp, const SkCa
   // n bytes - callstack
   callstack_p->as_binary(data_pp);
 
-  on_cmd_send(datum);
+  cmd_send(datum);
   }
 
 //---------------------------------------------------------------------------------------
@@ -749,7 +754,7 @@ void SkRemoteRuntimeBase::cmd_break_expression(const SkMemberExpression & expr_i
   // n bytes - callstack
   callstack_p->as_binary(data_pp);
 
-  on_cmd_send(datum);
+  cmd_send(datum);
   }
 
 void SkRemoteRuntimeBase::cmd_project()
@@ -774,7 +779,7 @@ void SkRemoteRuntimeBase::cmd_project()
 
   SkDebug::print("Skookum RT: Sending project info to IDE.\n", SkLocale_local);
 
-  on_cmd_send(datum);
+  cmd_send(datum);
   }
 
 //---------------------------------------------------------------------------------------
@@ -883,13 +888,22 @@ void SkRemoteRuntimeBase::on_cmd_incremental_update(const void ** binary_pp, uin
       SK_ERRORX(a_str_format("Class '%s' was reparented in the IDE, but the incremental update algorithm currently does not support this. Therefore, the runtime will not reflect the change until the next time the compiled binaries are reloaded.", name.as_cstr()));
       }
 
-    // Assign binary in reparse mode
-    class_p->reparse_begin(false);
-    class_p->assign_binary(binary_pp, false);
-    class_p->reparse_end();
+    // The IDE sends a class whenever anything in it changed - including just its routines
+    // which arrive separately below - so only reparse data members that actually differ.
+    const void * class_binary_p = *binary_pp;
 
-    // Re-resolve raw data
-    class_p->resolve_raw_data();
+    if (!class_p->is_loaded() || !class_p->is_data_binary_same(binary_pp))
+      {
+      *binary_pp = class_binary_p;
+
+      // Assign binary in reparse mode
+      class_p->reparse_begin(false);
+      class_p->assign_binary(binary_pp, false);
+      class_p->reparse_end();
+
+      // Re-resolve raw data
+      class_p->resolve_raw_data();
+      }
 
   #if 0
     // $Vital - CReis If the class is an actor/mind probably need to either:
@@ -1074,6 +1088,9 @@ void SkRemoteRuntimeBase::on_cmd_incremental_update(const void ** binary_pp, uin
     {
     on_class_updated(class_p);
     }
+
+  // Let the runtime do any work that only needs doing once per patch
+  on_class_updates_end(updated_classes.get_length());
   }
 
 //---------------------------------------------------------------------------------------
@@ -1174,6 +1191,10 @@ void SkRemoteRuntimeBase::on_cmd_class_update(const void ** binary_pp)
   // Announce that this class was updated
   on_class_updated(class_p);
 
+  // Let the runtime do its once per patch work (such as syncing reflection) - a class
+  // update is a patch of its own
+  on_class_updates_end(1u);
+
   // Decrement done after calling class constructors since other actions may be waiting to
   // trigger on m_pending_count == 0.
   if (m_pending_count)
@@ -1381,6 +1402,163 @@ void SkRemoteRuntimeBase::on_break_expression(const SkMemberExpression & expr_in
     }
   }
 
+//---------------------------------------------------------------------------------------
+// Queues snippets sent with cmd_invoke_batch() - they are run by process_invoke_queue().
+// 
+// Params:
+//   binary_pp:   command data following the command id
+//   data_length: length of command data in bytes
+void SkRemoteRuntimeBase::on_cmd_invoke_batch(const void ** binary_pp, uint32_t data_length)
+  {
+  #if (SKOOKUM & SK_CODE_IN)
+    //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+    // Binary composition:
+    //   4 bytes - number of snippets
+    //   n bytes - snippet string }- Repeating
+    if (data_length < 4u)
+      {
+      return;
+      }
+
+    uint32_t code_count = A_BYTE_STREAM_UI32_INC(binary_pp);
+    uint32_t remaining  = data_length - 4u;
+    uint32_t code_length;
+
+    for (uint32_t idx = 0u; idx < code_count; idx++)
+      {
+      code_length = (remaining >= 4u) ? A_BYTE_STREAM_UI32(*binary_pp) : 0u;
+
+      if ((remaining < 4u) || (code_length > remaining - 4u))
+        {
+        SkDebug::print_agog("Skookum RT: Malformed invoke batch from IDE - remainder ignored!\n", SkLocale_all, SkDPrintType_error);
+        return;
+        }
+
+      remaining -= 4u + code_length;
+      m_invoke_queue.append(*new AString(binary_pp));
+      }
+  #endif
+  }
+
+//---------------------------------------------------------------------------------------
+// Runs snippets queued by Command_invoke_batch in order until the time budget is used
+// up and sends each result back with cmd_invoke_result() as soon as it completes.  At
+// least one snippet is run per call so a single slow snippet cannot stall the queue.
+// 
+// Should be called once per update by the runtime - it is independent of receiving
+// commands so a large batch does not hitch the frame it arrives on.
+// 
+// Params:
+//   time_budget_seconds: time to spend before leaving the rest of the queue for later
+void SkRemoteRuntimeBase::process_invoke_queue(
+  double time_budget_seconds // = SkRemote_invoke_budget_seconds
+  )
+  {
+  #if (SKOOKUM & SK_CODE_IN)
+    if (m_invoke_queue.is_empty())
+      {
+      return;
+      }
+
+    double    end_time = get_elapsed_seconds() + time_budget_seconds;
+    AString * code_p;
+    AString   result_str;
+
+    do
+      {
+      code_p = m_invoke_queue.pop(0u);
+
+      result_str.empty();
+      SkParser::invoke_script(*code_p, &result_str);
+      cmd_invoke_result(result_str);
+
+      delete code_p;
+      }
+    while (m_invoke_queue.is_filled() && (get_elapsed_seconds() < end_time));
+  #endif
+  }
+
+//---------------------------------------------------------------------------------------
+// Snapshots, streams, stops or resets SkAllocProfiler counts as asked by cmd_memory().
+// 
+// Params:
+//   binary_pp:   command data following the command id
+//   data_length: length of command data in bytes
+void SkRemoteRuntimeBase::on_cmd_memory(const void ** binary_pp, uint32_t data_length)
+  {
+  //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  // Binary composition:
+  //   1 byte  - eMemoryAction
+  //   2 bytes - frame interval
+  //   2 bytes - top count
+  if (data_length < 5u)
+    {
+    return;
+    }
+
+  eMemoryAction action   = eMemoryAction(A_BYTE_STREAM_UI8_INC(binary_pp));
+  uint32_t      interval = A_BYTE_STREAM_UI16_INC(binary_pp);
+
+  m_memory_top_count = A_BYTE_STREAM_UI16_INC(binary_pp);
+
+  switch (action)
+    {
+    case MemoryAction_snapshot:
+      cmd_memory_reply();
+      break;
+
+    case MemoryAction_stream:
+      SkAllocProfiler::enable();
+      m_memory_interval   = a_max(interval, 1u);
+      m_memory_next_frame = SkAllocProfiler::get_frame_count() + m_memory_interval;
+      cmd_memory_reply();
+      break;
+
+    case MemoryAction_stop:
+      m_memory_interval = 0u;
+      SkAllocProfiler::enable(false);
+      cmd_memory_reply();
+      break;
+
+    case MemoryAction_reset:
+      SkAllocProfiler::reset();
+      m_memory_next_frame = m_memory_interval;
+      break;
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Sends the SkAllocProfiler counts to the IDE - see SkAllocProfiler::as_binary()
+void SkRemoteRuntimeBase::cmd_memory_reply()
+  {
+  //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  // Binary composition:
+  //   4 bytes - command id
+  //   n bytes - profiler counts
+  ADatum  datum(4u + SkAllocProfiler::as_binary_length(m_memory_top_count));
+  void *  data_p  = datum.get_data_writable();
+  void ** data_pp = &data_p;
+
+  uint32_t cmd = Command_memory_reply;
+
+  A_BYTE_STREAM_OUT32(data_pp, &cmd);
+  SkAllocProfiler::as_binary(data_pp, m_memory_top_count);
+
+  cmd_send(datum);
+  }
+
+//---------------------------------------------------------------------------------------
+// Sends Command_memory_reply every m_memory_interval frames while the IDE has asked for
+// a stream with MemoryAction_stream.  Should be called once per update by the runtime.
+void SkRemoteRuntimeBase::process_memory_stream()
+  {
+  if (m_memory_interval && (SkAllocProfiler::get_frame_count() >= m_memory_next_frame))
+    {
+    m_memory_next_frame = SkAllocProfiler::get_frame_count() + m_memory_interval;
+    cmd_memory_reply();
+    }
+  }
+
 //---------------------------------------------------------------------------------------
 // Receive and parse/execute a command from the remote side
 // Modifiers:   virtual
@@ -1402,15 +1580,21 @@ bool SkRemoteRuntimeBase::on_cmd_recv(eCommand cmd, const uint8_t * data_p, uint
       //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
       case Command_version:
         {
-        if (data_length != SkRemote_version_byte_size - sizeof(uint32_t))
+        if (data_length < SkRemote_version_byte_size - sizeof(uint32_t))
           {
           disconnect();
           break;
           }
 
-        uint8_t version = A_BYTE_STREAM_UI8_INC(data_pp);
+        uint8_t  version = A_BYTE_STREAM_UI8_INC(data_pp);
+        uint32_t auth    = A_BYTE_STREAM_UI32_INC(data_pp);
+
+        // Newer IDEs append their own flags - older ones never send compressed commands
+        m_remote_flags = (data_length >= SkRemote_version_flags_byte_size - sizeof(uint32_t))
+          ? A_BYTE_STREAM_UI32_INC(data_pp)
+          : SkRemoteFlag_none;
 
-        cmd_version_reply(version, A_BYTE_STREAM_UI32_INC(data_pp));
+        cmd_version_reply(version, auth);
         }
         break;
 
@@ -1520,6 +1704,16 @@ bool SkRemoteRuntimeBase::on_cmd_recv(eCommand cmd, const uint8_t * data_p, uint
         on_cmd_break_print_locals();
         break;
 
+      //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+      case Command_invoke_batch:
+        on_cmd_invoke_batch(data_pp, data_length);
+        break;
+
+      //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+      case Command_memory:
+        on_cmd_memory(data_pp, data_length);
+        break;
+
       //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
       default:
         // Send error to both sides
@@ -1562,6 +1756,15 @@ void SkRemoteRuntimeBase::on_connect_change(eConnectState old_state)
   {
   //ADebug::print_format("Skookum RT: on_connect_change(%u->%u)\n", old_state, m_connect_state);
 
+  // Results of queued snippets would have nowhere to go
+  if (m_connect_state >= ConnectState_disconnecting)
+    {
+    m_invoke_queue.free_all();
+
+    // Stop streaming - profiling is left as is so its counts can still be printed
+    m_memory_interval = 0u;
+    }
+
   #if (SKOOKUM & SK_DEBUG)
     if ((old_state == ConnectState_authenticated)
       && (m_connect_state >= ConnectState_disconnecting))
@@ -0,0 +1,1058 @@
+// Copyright 1998-2019 Epic Games, Inc. All Rights Reserved.
+
+//=======================================================================================
+// SkookumScript C++ library.
+//
+// Deterministic recording and headless replay of a script session
+//=======================================================================================
+
+
+//=======================================================================================
+// Includes
+//=======================================================================================
+
+#include <SkookumScript/Sk.hpp> // Always include Sk.hpp first (as some builds require a designated precompiled header)
+#include <SkookumScript/SkReplay.hpp>
+#include <AgogCore/ABinaryParse.hpp>
+#include <AgogCore/ADatum.hpp>
+#include <SkookumScript/SkBoolean.hpp>
+#include <SkookumScript/SkBrain.hpp>
+#include <SkookumScript/SkClass.hpp>
+#include <SkookumScript/SkCoroutine.hpp>
+#include <SkookumScript/SkDebug.hpp>
+#include <SkookumScript/SkInteger.hpp>
+#include <SkookumScript/SkInvokedCoroutine.hpp>
+#include <SkookumScript/SkInvokedMethod.hpp>
+#include <SkookumScript/SkMethod.hpp>
+#include <SkookumScript/SkRandom.hpp>
+#include <SkookumScript/SkReal.hpp>
+#include <SkookumScript/SkString.hpp>
+#include <SkookumScript/SkSymbol.hpp>
+
+
+//=======================================================================================
+// Local Global Structures
+//=======================================================================================
+
+namespace
+{
+
+  // Stream header - "SKRP", format version and checksums of the compiled binary
+  const uint32_t SkReplay_magic   = 0x534B5250u;
+  const uint16_t SkReplay_version = 2u;
+
+  // Most methods that can be designated as inputs at once
+  const uint32_t SkReplay_input_max = 64u;
+
+  // Value types of Event_input
+  enum eSkReplayValue
+    {
+    SkReplayValue_nil,
+    SkReplayValue_boolean,
+    SkReplayValue_integer,
+    SkReplayValue_real,
+    SkReplayValue_string,
+    SkReplayValue_symbol
+    };
+
+  //---------------------------------------------------------------------------------------
+  // Method binding designated as an input and the C++ function it was bound to
+  struct SkReplayInput
+    {
+    SkMethodFunc * m_method_p;
+    tSkMethodFunc  m_original_f;
+    uint32_t       m_class_name_id;
+    uint32_t       m_method_name_id;
+    bool           m_class_member_b;
+    };
+
+  SkReplayInput g_inputs[SkReplay_input_max];
+  uint32_t      g_input_count = 0u;
+
+  // Recorded stream or copy of the stream being replayed - created on demand
+  ADatum *        g_stream_p = nullptr;
+
+  // Read position and end when replaying
+  const uint8_t * g_play_p     = nullptr;
+  const uint8_t * g_play_end_p = nullptr;
+
+  // Set once an unsupported input result has been reported for the current recording
+  bool            g_unsupported_warned_b = false;
+
+  // Number of updates replayed so far
+  uint32_t        g_play_frame = 0u;
+
+  // Stubbed unbound C++ routine whose call stopped the current replay and the update it
+  // was called in - see SkReplay::on_unbound_call()
+  SkInvokableBase * g_diverged_routine_p = nullptr;
+  uint32_t          g_diverged_frame     = 0u;
+
+  //---------------------------------------------------------------------------------------
+  // Returns `length` writable bytes at the end of the recording
+  inline uint8_t * stream_append(uint32_t length)
+    {
+    return g_stream_p->get_data_end_writable(length, false);
+    }
+
+  //---------------------------------------------------------------------------------------
+  // Returns true if `length` more bytes can be read - otherwise skips to the end
+  inline bool play_has(uint32_t length)
+    {
+    if (uint32_t(g_play_end_p - g_play_p) >= length)
+      {
+      return true;
+      }
+
+    g_play_p = g_play_end_p;
+
+    return false;
+    }
+
+  //---------------------------------------------------------------------------------------
+  // Returns the designated input whose binding is `method_p` or nullptr
+  SkReplayInput * find_input(const SkInvokableBase * method_p)
+    {
+    SkReplayInput * input_p     = g_inputs;
+    SkReplayInput * input_end_p = g_inputs + g_input_count;
+
+    for (; input_p < input_end_p; input_p++)
+      {
+      if (input_p->m_method_p == method_p)
+        {
+        return input_p;
+        }
+      }
+
+    return nullptr;
+    }
+
+} // End unnamed namespace
+
+
+//=======================================================================================
+// Class Data Members
+//=======================================================================================
+
+SkReplay::eMode SkReplay::ms_mode           = SkReplay::Mode_off;
+uint32_t        SkReplay::ms_mismatch_count = 0u;
+
+
+//=======================================================================================
+// Class Methods
+//=======================================================================================
+
+//---------------------------------------------------------------------------------------
+// Designates a C++ method binding as an input - while recording its results are stored
+// and while replaying it returns the stored results instead of being called.
+//
+// Returns true if designated (or already designated) and false if there is no such
+// method, it is not a C++ function binding (SkMethodFunc) or there are too many inputs.
+//
+// $Note - Inputs can only be designated while not recording or replaying since the
+// stream header lists them.  If the bindings are re-registered (such as by loading new
+// compiled binaries) they need to be designated again.
+bool SkReplay::designate_input(
+  const ASymbol & class_name,
+  const ASymbol & method_name,
+  bool            class_member_b
+  )
+  {
+  SkClass * class_p = SkBrain::get_class(class_name);
+
+  if ((ms_mode == Mode_recording) || (ms_mode == Mode_replaying) || (class_p == nullptr))
+    {
+    SkDebug::print(
+      a_str_format("\nSkReplay: could not designate input '%s%s%s' - %s.\n",
+        class_name.as_cstr_dbg(), class_member_b ? "@@" : "@", method_name.as_cstr_dbg(),
+        class_p ? "already recording or replaying" : "unknown class"),
+      SkLocale_all,
+      SkDPrintType_warning);
+
+    return false;
+    }
+
+  // Make sure deferred bindings are in place so that they are not bound over the top later
+  class_p->register_pending_method_funcs();
+
+  SkMethodBase * method_p = class_member_b
+    ? class_p->find_class_method(method_name)
+    : class_p->find_instance_method(method_name);
+
+  if ((method_p == nullptr)
+    || (method_p->get_invoke_type() != SkInvokable_method_func)
+    || (g_input_count >= SkReplay_input_max))
+    {
+    SkDebug::print(
+      a_str_format("\nSkReplay: could not designate input '%s%s%s' - %s.\n",
+        class_name.as_cstr_dbg(), class_member_b ? "@@" : "@", method_name.as_cstr_dbg(),
+        (method_p == nullptr)
+          ? "unknown method"
+          : ((g_input_count >= SkReplay_input_max) ? "too many inputs" : "not a C++ function binding")),
+      SkLocale_all,
+      SkDPrintType_warning);
+
+    return false;
+    }
+
+  SkMethodFunc * func_p = static_cast<SkMethodFunc *>(method_p);
+
+  if (find_input(func_p))
+    {
+    return true;
+    }
+
+  SkReplayInput & input = g_inputs[g_input_count++];
+
+  input.m_method_p       = func_p;
+  input.m_original_f     = func_p->m_atomic_f;
+  input.m_class_name_id  = class_name.get_id();
+  input.m_method_name_id = method_name.get_id();
+  input.m_class_member_b = class_member_b;
+
+  func_p->set_function(mthd_input);
+
+  return true;
+  }
+
+//---------------------------------------------------------------------------------------
+// Restores the original C++ functions of all designated inputs
+void SkReplay::undesignate_inputs()
+  {
+  for (uint32_t input_idx = 0u; input_idx < g_input_count; input_idx++)
+    {
+    g_inputs[input_idx].m_method_p->set_function(g_inputs[input_idx].m_original_f);
+    }
+
+  g_input_count = 0u;
+  }
+
+//---------------------------------------------------------------------------------------
+// Starts recording with the next SkookumScript::initialize_sim() or initialize_gameplay()
+// - whichever comes first.  Any previous recording is discarded.
+void SkReplay::record_arm()
+  {
+  if (ms_mode == Mode_replaying)
+    {
+    play_stop();
+    }
+
+  if (g_stream_p)
+    {
+    g_stream_p->empty();
+    }
+
+  ms_mode = Mode_armed;
+  }
+
+//---------------------------------------------------------------------------------------
+// Ends the recording - also called when gameplay or the sim is deinitialized.  The
+// recording stays available via get_data() until the next record_arm(), play_start()
+// or clear().
+void SkReplay::record_stop()
+  {
+  if (ms_mode == Mode_recording)
+    {
+    *stream_append(1u) = uint8_t(Event_end);
+    }
+
+  if ((ms_mode == Mode_recording) || (ms_mode == Mode_armed))
+    {
+    ms_mode = Mode_off;
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Recorded stream - nullptr if nothing has been recorded
+const uint8_t * SkReplay::get_data()
+  {
+  return ((ms_mode != Mode_replaying) && g_stream_p && g_stream_p->get_data_length())
+    ? g_stream_p->get_data()
+    : nullptr;
+  }
+
+//---------------------------------------------------------------------------------------
+// Byte length of recorded stream
+uint32_t SkReplay::get_data_length()
+  {
+  return ((ms_mode != Mode_replaying) && g_stream_p) ? g_stream_p->get_data_length() : 0u;
+  }
+
+//---------------------------------------------------------------------------------------
+// Starts replaying a recorded stream - a copy of the data is made.  Call play_step()
+// until it returns Event_end - it initializes the sim and gameplay as they were when
+// recorded so this is usually called with SkookumScript at InitializationLevel_program.
+//
+// Returns false if the data is not a compatible recording.
+bool SkReplay::play_start(const void * data_p, uint32_t data_length)
+  {
+  record_stop();
+  play_stop();
+
+  const uint8_t * header_p = static_cast<const uint8_t *>(data_p);
+
+  g_play_p     = header_p;
+  g_play_end_p = header_p + data_length;
+
+  if (!play_has(16u)
+    || (A_BYTE_STREAM_UI32_INC(&g_play_p) != SkReplay_magic)
+    || (A_BYTE_STREAM_UI16_INC(&g_play_p) != SkReplay_version))
+    {
+    SkDebug::print("\nSkReplay: data is not a compatible recording!\n", SkLocale_all, SkDPrintType_error);
+    g_play_p = g_play_end_p = nullptr;
+
+    return false;
+    }
+
+  // The recorded events only make sense for the same scripts
+  uint32_t checksum_folders = A_BYTE_STREAM_UI32_INC(&g_play_p);
+  uint32_t checksum_files   = A_BYTE_STREAM_UI32_INC(&g_play_p);
+
+  if ((checksum_folders != SkBrain::ms_checksum_folders) || (checksum_files != SkBrain::ms_checksum_files))
+    {
+    SkDebug::print(
+      a_str_format("\nSkReplay: recording was made with a different compiled binary (checksums 0x%08x 0x%08x rather than 0x%08x 0x%08x)!\n",
+        checksum_folders, checksum_files, SkBrain::ms_checksum_folders, SkBrain::ms_checksum_files),
+      SkLocale_all,
+      SkDPrintType_error);
+    g_play_p = g_play_end_p = nullptr;
+
+    return false;
+    }
+
+  ms_mismatch_count    = 0u;
+  g_play_frame         = 0u;
+  g_diverged_routine_p = nullptr;
+  g_diverged_frame     = 0u;
+
+  // Designate the same inputs as the recording
+  uint32_t input_count = A_BYTE_STREAM_UI16_INC(&g_play_p);
+
+  for (; input_count && play_has(9u); input_count--)
+    {
+    ASymbol class_name  = ASymbol::create_from_binary((const void **)&g_play_p, false);
+    ASymbol method_name = ASymbol::create_from_binary((const void **)&g_play_p, false);
+
+    designate_input(class_name, method_name, A_BYTE_STREAM_UI8_INC(&g_play_p) != 0u);
+    }
+
+  // Keep own copy of the events
+  uint32_t events_length = uint32_t(g_play_end_p - g_play_p);
+
+  if (g_stream_p == nullptr)
+    {
+    g_stream_p = new ADatum;
+    }
+
+  g_stream_p->set_data(g_play_p, events_length);
+  g_play_p     = g_stream_p->get_data();
+  g_play_end_p = g_play_p + events_length;
+
+  ms_mode = Mode_replaying;
+
+  return true;
+  }
+
+//---------------------------------------------------------------------------------------
+// Replays the next initialization step or update - and everything the scripts consume
+// during it.  Returns the event that was replayed or Event_end once there are none left.
+SkReplay::eEvent SkReplay::play_step()
+  {
+  if ((ms_mode != Mode_replaying) || !play_has(1u))
+    {
+    return Event_end;
+    }
+
+  eEvent event = eEvent(*g_play_p);
+
+  // Streams recorded from gameplay start rely on the sim being initialized beforehand.
+  // Done before the event is consumed so that the class constructors cannot read into it.
+  if (((event == Event_class_seeds) || (event == Event_gameplay_start))
+    && (SkookumScript::get_initialization_level() == SkookumScript::InitializationLevel_program))
+    {
+    SkookumScript::initialize_sim();
+    }
+
+  g_play_p++;
+
+  switch (event)
+    {
+    case Event_sim_start:
+      if (play_has(20u))
+        {
+        uint64_t sim_ticks     = A_BYTE_STREAM_UI64_INC(&g_play_p);
+        uint64_t sim_time_bits = A_BYTE_STREAM_UI64_INC(&g_play_p);
+        f64      sim_time;
+        f32      sim_delta;
+
+        ::memcpy(&sim_time, &sim_time_bits, sizeof(sim_time));
+        A_BYTE_STREAM_IN32(&sim_delta, &g_play_p);
+        SkookumScript::set_time(sim_ticks, sim_time, sim_delta);
+
+        if (SkookumScript::get_initialization_level() == SkookumScript::InitializationLevel_program)
+          {
+          SkookumScript::initialize_sim();
+          }
+        }
+      break;
+
+    case Event_class_seeds:
+      replay_class_seeds();
+      break;
+
+    case Event_gameplay_start:
+      if (play_has(1u))
+        {
+        bool create_master_mind = A_BYTE_STREAM_UI8_INC(&g_play_p) != 0u;
+
+        if (SkookumScript::get_initialization_level() == SkookumScript::InitializationLevel_sim)
+          {
+          SkookumScript::initialize_gameplay(create_master_mind);
+          }
+        }
+      break;
+
+    case Event_update:
+      if (play_has(20u))
+        {
+        uint64_t sim_ticks     = A_BYTE_STREAM_UI64_INC(&g_play_p);
+        uint64_t sim_time_bits = A_BYTE_STREAM_UI64_INC(&g_play_p);
+        f64      sim_time;
+        f32      sim_delta;
+
+        ::memcpy(&sim_time, &sim_time_bits, sizeof(sim_time));
+        A_BYTE_STREAM_IN32(&sim_delta, &g_play_p);
+        SkookumScript::update(sim_ticks, sim_time, sim_delta);
+        g_play_frame++;
+        }
+      break;
+
+    case Event_update_ticks:
+      if (play_has(8u))
+        {
+        SkookumScript::update_ticks(A_BYTE_STREAM_UI64_INC(&g_play_p));
+        g_play_frame++;
+        }
+      break;
+
+    case Event_update_delta:
+      if (play_has(4u))
+        {
+        f32 sim_delta;
+
+        A_BYTE_STREAM_IN32(&sim_delta, &g_play_p);
+        SkookumScript::update_delta(sim_delta);
+        g_play_frame++;
+        }
+      break;
+
+    case Event_end:
+      g_play_p = g_play_end_p;
+      break;
+
+    case Event_seed:
+      // Seed that the replayed scripts did not ask for - they have diverged
+      ms_mismatch_count++;
+
+      if (play_has(4u))
+        {
+        g_play_p += 4u;
+        }
+      break;
+
+    case Event_input:
+      // Input that the replayed scripts did not ask for - they have diverged
+      ms_mismatch_count++;
+      g_play_p--;
+      replay_input()->dereference();
+      break;
+
+    default:
+      SkDebug::print(a_str_format("\nSkReplay: unknown event %u - replay stopped!\n", uint32_t(event)), SkLocale_all, SkDPrintType_error);
+      ms_mismatch_count++;
+      g_play_p = g_play_end_p;
+      event    = Event_end;
+    }
+
+  return event;
+  }
+
+//---------------------------------------------------------------------------------------
+// Stops replaying and restores the designated inputs - the initialization level is left
+// as is so deinitialize as usual afterwards.
+void SkReplay::play_stop()
+  {
+  if (ms_mode == Mode_replaying)
+    {
+    undesignate_inputs();
+
+    if (g_stream_p)
+      {
+      g_stream_p->empty();
+      }
+
+    g_play_p = g_play_end_p = nullptr;
+    ms_mode  = Mode_off;
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Binds every C++ method and coroutine that has no C++ function yet - such as the engine
+// bindings in a headless host - to a stub so that scripts calling them do not stop with
+// an error.  A stubbed method returns nil and a stubbed coroutine completes right away.
+// While replaying, the first call to a stub stops the replay and is reported as the point
+// of divergence - from there on the scripts no longer get what they got when recorded.
+// Designate any engine query a workload depends on as an input so that it is replayed
+// rather than stubbed.
+//
+// Returns the number of routines stubbed.
+//
+// $Note - Call after play_start() so designated inputs are not stubbed.  The stubs stay
+// in place - this is meant for hosts that never bind the routines anyway.
+uint32_t SkReplay::stub_unbound()
+  {
+  uint32_t           stub_count = 0u;
+  const tSkClasses & classes    = SkBrain::get_classes();
+  SkClass **         classes_pp = classes.get_array();
+  SkClass **         classes_end_pp = classes_pp + classes.get_length();
+
+  for (; classes_pp < classes_end_pp; classes_pp++)
+    {
+    SkClass * class_p = *classes_pp;
+
+    // Make sure deferred bindings are in place so that they are not stubbed
+    class_p->register_pending_method_funcs();
+
+    for (uint32_t member_idx = 0u; member_idx < 2u; member_idx++)
+      {
+      const tSkMethodTable & methods = member_idx ? class_p->get_class_methods() : class_p->get_instance_methods();
+      SkMethodBase **        methods_pp = methods.get_array();
+      SkMethodBase **        methods_end_pp = methods_pp + methods.get_length();
+
+      for (; methods_pp < methods_end_pp; methods_pp++)
+        {
+        if (((*methods_pp)->get_invoke_type() == SkInvokable_method_func)
+          && (static_cast<SkMethodFunc *>(*methods_pp)->m_atomic_f == nullptr))
+          {
+          static_cast<SkMethodFunc *>(*methods_pp)->set_function(mthd_unbound);
+          stub_count++;
+          }
+        }
+      }
+
+    const tSkCoroutines & coroutines = class_p->get_coroutines();
+    SkCoroutineBase **    coroutines_pp = coroutines.get_array();
+    SkCoroutineBase **    coroutines_end_pp = coroutines_pp + coroutines.get_length();
+
+    for (; coroutines_pp < coroutines_end_pp; coroutines_pp++)
+      {
+      if (((*coroutines_pp)->get_invoke_type() == SkInvokable_coroutine_func)
+        && (static_cast<SkCoroutineFunc *>(*coroutines_pp)->m_update_f == nullptr))
+        {
+        static_cast<SkCoroutineFunc *>(*coroutines_pp)->m_update_f = coro_unbound;
+        stub_count++;
+        }
+      }
+    }
+
+  return stub_count;
+  }
+
+//---------------------------------------------------------------------------------------
+// Stops recording or replaying and frees the stream
+void SkReplay::clear()
+  {
+  play_stop();
+  undesignate_inputs();
+
+  ms_mode = Mode_off;
+
+  delete g_stream_p;
+  g_stream_p = nullptr;
+  }
+
+//---------------------------------------------------------------------------------------
+// Called at the start of SkookumScript::initialize_sim()
+void SkReplay::on_initialize_sim()
+  {
+  if (ms_mode == Mode_armed)
+    {
+    record_start();
+    }
+
+  if (ms_mode == Mode_recording)
+    {
+    f64       sim_time  = SkookumScript::get_sim_time();
+    f32       sim_delta = SkookumScript::get_sim_delta();
+    uint64_t  sim_ticks = SkookumScript::get_sim_ticks();
+    uint8_t * data_p    = stream_append(21u);
+
+    *data_p++ = uint8_t(Event_sim_start);
+    A_BYTE_STREAM_OUT64(&data_p, &sim_ticks);
+    A_BYTE_STREAM_OUT64(&data_p, &sim_time);
+    A_BYTE_STREAM_OUT32(&data_p, &sim_delta);
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Called at the start of SkookumScript::initialize_gameplay()
+void SkReplay::on_initialize_gameplay(bool create_master_mind)
+  {
+  if (ms_mode == Mode_armed)
+    {
+    record_start();
+
+    // The class constructors ran before recording - so store the state of their randoms
+    record_class_seeds();
+    }
+
+  if (ms_mode == Mode_recording)
+    {
+    uint8_t * data_p = stream_append(2u);
+
+    data_p[0] = uint8_t(Event_gameplay_start);
+    data_p[1] = uint8_t(create_master_mind);
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Called when gameplay or the sim is deinitialized
+void SkReplay::on_deinitialize()
+  {
+  if (ms_mode == Mode_recording)
+    {
+    record_stop();
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Called with the (time based) seed of each default constructed Random - returns the seed
+// to use.
+uint32_t SkReplay::on_seed(uint32_t seed)
+  {
+  switch (ms_mode)
+    {
+    case Mode_recording:
+      {
+      uint8_t * data_p = stream_append(5u);
+
+      *data_p++ = uint8_t(Event_seed);
+      A_BYTE_STREAM_OUT32(&data_p, &seed);
+      break;
+      }
+
+    case Mode_replaying:
+      // Randoms created before a stream recorded from gameplay start get their seeds
+      // from Event_class_seeds instead
+      if (replay_expect(Event_seed) && play_has(4u))
+        {
+        seed = A_BYTE_STREAM_UI32_INC(&g_play_p);
+        }
+      break;
+
+    default:
+      break;
+    }
+
+  return seed;
+  }
+
+//---------------------------------------------------------------------------------------
+// Writes the stream header
+void SkReplay::record_start()
+  {
+  if (g_stream_p == nullptr)
+    {
+    g_stream_p = new ADatum;
+    }
+
+  g_stream_p->empty();
+  g_unsupported_warned_b = false;
+
+  uint8_t * data_p = stream_append(16u + (g_input_count * 9u));
+
+  A_BYTE_STREAM_OUT32(&data_p, &SkReplay_magic);
+  A_BYTE_STREAM_OUT16(&data_p, &SkReplay_version);
+  A_BYTE_STREAM_OUT32(&data_p, &SkBrain::ms_checksum_folders);
+  A_BYTE_STREAM_OUT32(&data_p, &SkBrain::ms_checksum_files);
+
+  uint16_t input_count = uint16_t(g_input_count);
+
+  A_BYTE_STREAM_OUT16(&data_p, &input_count);
+
+  for (uint32_t input_idx = 0u; input_idx < g_input_count; input_idx++)
+    {
+    const SkReplayInput & input = g_inputs[input_idx];
+
+    A_BYTE_STREAM_OUT32(&data_p, &input.m_class_name_id);
+    A_BYTE_STREAM_OUT32(&data_p, &input.m_method_name_id);
+    *data_p++ = uint8_t(input.m_class_member_b);
+    }
+
+  ms_mode = Mode_recording;
+  }
+
+//---------------------------------------------------------------------------------------
+void SkReplay::record_update(uint64_t sim_ticks, f64 sim_time, f32 sim_delta)
+  {
+  uint8_t * data_p = stream_append(21u);
+
+  *data_p++ = uint8_t(Event_update);
+  A_BYTE_STREAM_OUT64(&data_p, &sim_ticks);
+  A_BYTE_STREAM_OUT64(&data_p, &sim_time);
+  A_BYTE_STREAM_OUT32(&data_p, &sim_delta);
+  }
+
+//---------------------------------------------------------------------------------------
+void SkReplay::record_update_ticks(uint64_t sim_ticks)
+  {
+  uint8_t * data_p = stream_append(9u);
+
+  *data_p++ = uint8_t(Event_update_ticks);
+  A_BYTE_STREAM_OUT64(&data_p, &sim_ticks);
+  }
+
+//---------------------------------------------------------------------------------------
+void SkReplay::record_update_delta(f32 sim_delta)
+  {
+  uint8_t * data_p = stream_append(5u);
+
+  *data_p++ = uint8_t(Event_update_delta);
+  A_BYTE_STREAM_OUT32(&data_p, &sim_delta);
+  }
+
+//---------------------------------------------------------------------------------------
+// Stores the state of every Random held directly in class data
+void SkReplay::record_class_seeds()
+  {
+  SkClass * random_class_p = SkRandom::get_class();
+
+  if (random_class_p == nullptr)
+    {
+    return;
+    }
+
+  // Count position is filled in once known
+  uint32_t count_pos  = g_stream_p->get_data_length() + 1u;
+  uint16_t seed_count = 0u;
+  uint8_t * data_p    = stream_append(3u);
+
+  *data_p++ = uint8_t(Event_class_seeds);
+
+  const tSkClasses & classes      = SkBrain::get_classes();
+  SkClass **         class_pp     = classes.get_array();
+  SkClass **         class_end_pp = class_pp + classes.get_length();
+
+  for (; class_pp < class_end_pp; class_pp++)
+    {
+    const SkInstanceList & values      = (*class_pp)->get_class_data_values();
+    uint32_t               value_count = values.get_length();
+
+    for (uint32_t data_idx = 0u; data_idx < value_count; data_idx++)
+      {
+      SkInstance * value_p = values.get_array()[data_idx];
+
+      if (value_p && (value_p->get_class() == random_class_p))
+        {
+        uint32_t class_name_id = (*class_pp)->get_name_id();
+        uint16_t value_idx     = uint16_t(data_idx);
+        uint32_t seed          = value_p->as<SkRandom>().get_seed();
+
+        data_p = stream_append(10u);
+        A_BYTE_STREAM_OUT32(&data_p, &class_name_id);
+        A_BYTE_STREAM_OUT16(&data_p, &value_idx);
+        A_BYTE_STREAM_OUT32(&data_p, &seed);
+        seed_count++;
+        }
+      }
+    }
+
+  data_p = g_stream_p->get_data_writable() + count_pos;
+  A_BYTE_STREAM_OUT16(&data_p, &seed_count);
+  }
+
+//---------------------------------------------------------------------------------------
+// Restores the state of the Randoms stored by record_class_seeds()
+void SkReplay::replay_class_seeds()
+  {
+  if (!play_has(2u))
+    {
+    return;
+    }
+
+  SkClass * random_class_p = SkRandom::get_class();
+  uint32_t  seed_count     = A_BYTE_STREAM_UI16_INC(&g_play_p);
+
+  for (; seed_count && play_has(10u); seed_count--)
+    {
+    SkClass *  class_p  = SkBrain::get_class(ASymbol::create_from_binary((const void **)&g_play_p, false));
+    uint32_t   data_idx = A_BYTE_STREAM_UI16_INC(&g_play_p);
+    uint32_t   seed     = A_BYTE_STREAM_UI32_INC(&g_play_p);
+
+    if (class_p && (data_idx < class_p->get_class_data_values().get_length()))
+      {
+      SkInstance * value_p = class_p->get_class_data_value_by_idx(data_idx);
+
+      if (value_p && (value_p->get_class() == random_class_p))
+        {
+        value_p->as<SkRandom>().set_seed(seed);
+        continue;
+        }
+      }
+
+    ms_mismatch_count++;
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Stores the result of a designated input
+void SkReplay::record_input(SkInstance * result_p)
+  {
+  SkClass * class_p = result_p->get_class();
+  uint8_t * data_p;
+
+  if (class_p == SkBrain::ms_boolean_class_p)
+    {
+    data_p = stream_append(3u);
+    data_p[0] = uint8_t(Event_input);
+    data_p[1] = uint8_t(SkReplayValue_boolean);
+    data_p[2] = uint8_t(result_p->as<SkBoolean>());
+    return;
+    }
+
+  if (class_p == SkBrain::ms_integer_class_p)
+    {
+    data_p = stream_append(6u);
+    data_p[0] = uint8_t(Event_input);
+    data_p[1] = uint8_t(SkReplayValue_integer);
+    data_p += 2;
+    A_BYTE_STREAM_OUT32(&data_p, &result_p->as<SkInteger>());
+    return;
+    }
+
+  if (class_p == SkBrain::ms_real_class_p)
+    {
+    data_p = stream_append(6u);
+    data_p[0] = uint8_t(Event_input);
+    data_p[1] = uint8_t(SkReplayValue_real);
+    data_p += 2;
+    A_BYTE_STREAM_OUT32(&data_p, &result_p->as<SkReal>());
+    return;
+    }
+
+  if (class_p == SkBrain::ms_string_class_p)
+    {
+    const AString & str = result_p->as<SkString>();
+
+    data_p = stream_append(2u + str.as_binary_length());
+    data_p[0] = uint8_t(Event_input);
+    data_p[1] = uint8_t(SkReplayValue_string);
+    data_p += 2;
+    str.as_binary((void **)&data_p);
+    return;
+    }
+
+  if (class_p == SkBrain::ms_symbol_class_p)
+    {
+    data_p = stream_append(2u + ASymbol::as_binary_length());
+    data_p[0] = uint8_t(Event_input);
+    data_p[1] = uint8_t(SkReplayValue_symbol);
+    data_p += 2;
+    result_p->as<SkSymbol>().as_binary((void **)&data_p);
+    return;
+    }
+
+  if ((result_p != SkBrain::ms_nil_p) && !g_unsupported_warned_b)
+    {
+    g_unsupported_warned_b = true;
+
+    SkDebug::print(
+      a_str_format("\nSkReplay: input results of class '%s' are not supported - recording them as nil.\n", class_p->get_name_cstr_dbg()),
+      SkLocale_all,
+      SkDPrintType_warning);
+    }
+
+  data_p = stream_append(2u);
+  data_p[0] = uint8_t(Event_input);
+  data_p[1] = uint8_t(SkReplayValue_nil);
+  }
+
+//---------------------------------------------------------------------------------------
+// Returns the next recorded input result - or nil if the next event is not an input
+SkInstance * SkReplay::replay_input()
+  {
+  if (!replay_expect(Event_input))
+    {
+    ms_mismatch_count++;
+
+    return SkBrain::ms_nil_p;
+    }
+
+  if (!play_has(1u))
+    {
+    return SkBrain::ms_nil_p;
+    }
+
+  switch (A_BYTE_STREAM_UI8_INC(&g_play_p))
+    {
+    case SkReplayValue_boolean:
+      if (play_has(1u))
+        {
+        return SkBoolean::new_instance(A_BYTE_STREAM_UI8_INC(&g_play_p) != 0u);
+        }
+      break;
+
+    case SkReplayValue_integer:
+      if (play_has(4u))
+        {
+        return SkInteger::new_instance(tSkInteger(A_BYTE_STREAM_UI32_INC(&g_play_p)));
+        }
+      break;
+
+    case SkReplayValue_real:
+      if (play_has(4u))
+        {
+        tSkReal value;
+
+        A_BYTE_STREAM_IN32(&value, &g_play_p);
+
+        return SkReal::new_instance(value);
+        }
+      break;
+
+    case SkReplayValue_string:
+      if (play_has(4u) && play_has(4u + A_BYTE_STREAM_UI32(g_play_p)))
+        {
+        return SkString::new_instance(AString((const void **)&g_play_p));
+        }
+      break;
+
+    case SkReplayValue_symbol:
+      if (play_has(4u))
+        {
+        return SkSymbol::new_instance(ASymbol::create_from_binary((const void **)&g_play_p, false));
+        }
+      break;
+
+    default:
+      break;
+    }
+
+  return SkBrain::ms_nil_p;
+  }
+
+//---------------------------------------------------------------------------------------
+// Consumes the tag of the next event and returns true if it is `event` - otherwise the
+// stream is left as is and false is returned.
+bool SkReplay::replay_expect(eEvent event)
+  {
+  if ((g_play_p < g_play_end_p) && (*g_play_p == uint8_t(event)))
+    {
+    g_play_p++;
+
+    return true;
+    }
+
+  return false;
+  }
+
+//---------------------------------------------------------------------------------------
+// C++ function that stands in for designated inputs
+void SkReplay::mthd_input(SkInvokedMethod * scope_p, SkInstance ** result_pp)
+  {
+  SkInstance * result_p = nullptr;
+
+  if (ms_mode == Mode_replaying)
+    {
+    // Skip the original entirely - it may need an engine that is not there
+    result_p = replay_input();
+    }
+  else
+    {
+    SkReplayInput * input_p = find_input(scope_p->get_invokable());
+
+    if (input_p && input_p->m_original_f)
+      {
+      (input_p->m_original_f)(scope_p, &result_p);
+      }
+
+    if (result_p == nullptr)
+      {
+      result_p = SkBrain::ms_nil_p;  // nil does not need to be referenced/dereferenced
+      }
+
+    if (ms_mode == Mode_recording)
+      {
+      record_input(result_p);
+      }
+    }
+
+  if (result_pp)
+    {
+    *result_pp = result_p;
+    }
+  else
+    {
+    result_p->dereference();
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Stubbed unbound C++ routine whose call stopped the current or last replay - nullptr if
+// it did not diverge that way - see stub_unbound()
+const SkInvokableBase * SkReplay::get_diverged_routine()
+  {
+  return g_diverged_routine_p;
+  }
+
+//---------------------------------------------------------------------------------------
+// Index of the update during which get_diverged_routine() was called - the number of
+// updates replayed before it, so 0 also covers the initialization steps
+uint32_t SkReplay::get_diverged_frame()
+  {
+  return g_diverged_frame;
+  }
+
+//---------------------------------------------------------------------------------------
+// Notes a call to a stubbed unbound C++ routine - see stub_unbound().  The scripts get
+// nil rather than what the engine returned when recorded so everything after this point
+// would be measured on a different workload - the replay is stopped instead, i.e. the
+// next play_step() returns Event_end.
+void SkReplay::on_unbound_call(SkInvokableBase * routine_p)
+  {
+  if ((ms_mode != Mode_replaying) || g_diverged_routine_p)
+    {
+    return;
+    }
+
+  ms_mismatch_count++;
+  g_diverged_routine_p = routine_p;
+  g_diverged_frame     = g_play_frame;
+  g_play_p             = g_play_end_p;
+
+  SkDebug::print(
+    a_str_format("\nSkReplay: diverged from the recording at update %u - the scripts called unbound C++ routine '%s' which was not designated as an input.  Replay stopped!\n",
+      g_play_frame, routine_p->as_string_name().as_cstr()),
+    SkLocale_all,
+    SkDPrintType_error);
+  }
+
+//---------------------------------------------------------------------------------------
+// C++ function that stands in for unbound C++ methods - see stub_unbound()
+void SkReplay::mthd_unbound(SkInvokedMethod * scope_p, SkInstance ** result_pp)
+  {
+  on_unbound_call(scope_p->get_invokable());
+
+  if (result_pp)
+    {
+    *result_pp = SkBrain::ms_nil_p;  // nil does not need to be referenced/dereferenced
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// C++ function that stands in for unbound C++ coroutines - see stub_unbound()
+bool SkReplay::coro_unbound(SkInvokedCoroutine * scope_p)
+  {
+  on_unbound_call(scope_p->get_invokable());
+
+  return true;
+  }
@@ -14,10 +14,202 @@
 
 #include <SkookumScript/Sk.hpp> // Always include Sk.hpp first (as some builds require a designated precompiled header)
 #include <SkookumScript/SkRuntimeBase.hpp>
+#include <AgogCore/AMath.hpp>
 #include <AgogCore/ASymbolTable.hpp>
 #include <SkookumScript/SkBrain.hpp>
 #include <SkookumScript/SkClass.hpp>
 #include <SkookumScript/SkDebug.hpp>
+#include <SkookumScript/SkExpressionBase.hpp>
+#include <SkookumScript/SkOptimizer.hpp>
+#include <stdio.h>      // Uses:  fopen, fread, fseek, ftell, fclose
+
+
+//=======================================================================================
+// Local Global Structures
+//=======================================================================================
+
+namespace
+{
+
+  // Size of each read request issued for a streamed load
+  const uint32_t SkBinaryStream_chunk_size      = 64u * 1024u;
+  // Number of read requests kept outstanding during a streamed load
+  const uint32_t SkBinaryStream_reads_in_flight = 4u;
+
+  //---------------------------------------------------------------------------------------
+  // Reads a SkBinaryStream into a single buffer keeping several chunk reads in flight so
+  // deserialization of the bytes that have arrived overlaps reading the rest.
+  class SkBinaryStreamReader
+    {
+    public:
+
+      //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+      SkBinaryStreamReader(SkBinaryStream * stream_p) :
+        m_stream_p(stream_p),
+        m_size(stream_p->get_size()),
+        m_binary_p(static_cast<uint8_t *>(AgogCore::get_app_info()->malloc(m_size, "SkBinaryStreamReader"))),
+        m_requested(0u),
+        m_ready(0u),
+        m_in_flight(0u)
+        {
+        }
+
+      //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+      ~SkBinaryStreamReader()
+        {
+        // Reads still outstanding write into the buffer so wait for them before freeing it
+        for (; m_in_flight; m_in_flight--)
+          {
+          m_stream_p->wait_read();
+          }
+
+        AgogCore::get_app_info()->free(m_binary_p);
+        }
+
+      //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+      const uint8_t * get_binary() const  { return m_binary_p; }
+      uint32_t        get_size() const    { return m_size; }
+
+      //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+      // Waits until at least the first `length` bytes of the binary have arrived.
+      // Returns false if the binary is shorter or a read failed.
+      bool ensure(uint32_t length)
+        {
+        if ((length > m_size) || (m_binary_p == nullptr))
+          {
+          return false;
+          }
+
+        while (m_ready < length)
+          {
+          // Keep the read pipeline full
+          for (; (m_in_flight < SkBinaryStream_reads_in_flight) && (m_requested < m_size); m_in_flight++)
+            {
+            uint32_t chunk_size = a_min(SkBinaryStream_chunk_size, m_size - m_requested);
+
+            m_stream_p->request_read(m_requested, chunk_size, m_binary_p + m_requested);
+            m_requested += chunk_size;
+            }
+
+          m_in_flight--;
+
+          if (!m_stream_p->wait_read())
+            {
+            return false;
+            }
+
+          m_ready = a_min(m_ready + SkBinaryStream_chunk_size, m_size);
+          }
+
+        return true;
+        }
+
+    protected:
+
+      SkBinaryStream * m_stream_p;
+      uint32_t         m_size;
+      uint8_t *        m_binary_p;
+
+      // Bytes requested so far
+      uint32_t m_requested;
+
+      // Bytes that have arrived so far
+      uint32_t m_ready;
+
+      // Number of reads requested but not waited on yet
+      uint32_t m_in_flight;
+    };
+
+  //---------------------------------------------------------------------------------------
+  // Cleans out anything remaining from a previous session and starts up SkookumScript
+  // - registers/connects atomic classes, coroutines, etc. that do not require the code or
+  // compiled binary to be already loaded.
+  void reinitialize_for_load()
+    {
+    if (SkookumScript::get_initialization_level() > SkookumScript::InitializationLevel_none)
+      {
+      // Sim might not be running
+      if (SkookumScript::get_initialization_level() >= SkookumScript::InitializationLevel_sim)
+        {
+        SkookumScript::deinitialize_sim();
+        SkookumScript::deinitialize_program();
+        }
+      SkookumScript::deinitialize();
+      }
+
+    SkookumScript::initialize();
+    }
+
+} // End unnamed namespace
+
+
+//=======================================================================================
+// SkBinaryStreamFile Methods
+//=======================================================================================
+
+//---------------------------------------------------------------------------------------
+// Constructor
+// Notes:  Check is_open() to determine whether the file could be opened.
+SkBinaryStreamFile::SkBinaryStreamFile(const char * path_p) :
+  m_file_p(::fopen(path_p, "rb")),
+  m_size(0u),
+  m_pending_count(0u),
+  m_failed(false)
+  {
+  if (m_file_p)
+    {
+    FILE * file_p = static_cast<FILE *>(m_file_p);
+
+    ::fseek(file_p, 0, SEEK_END);
+    long size = ::ftell(file_p);
+    ::fseek(file_p, 0, SEEK_SET);
+
+    m_size = (size > 0) ? uint32_t(size) : 0u;
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Destructor
+SkBinaryStreamFile::~SkBinaryStreamFile()
+  {
+  if (m_file_p)
+    {
+    ::fclose(static_cast<FILE *>(m_file_p));
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Reads the requested bytes right away - see SkBinaryStream::request_read()
+void SkBinaryStreamFile::request_read(uint32_t offset, uint32_t size, void * dest_p)
+  {
+  m_pending_count++;
+
+  if (m_failed || !m_file_p)
+    {
+    m_failed = true;
+
+    return;
+    }
+
+  FILE * file_p = static_cast<FILE *>(m_file_p);
+
+  m_failed = (::fseek(file_p, long(offset), SEEK_SET) != 0)
+    || (::fread(dest_p, 1u, size, file_p) != size);
+  }
+
+//---------------------------------------------------------------------------------------
+// Returns: true if the oldest requested read succeeded
+bool SkBinaryStreamFile::wait_read()
+  {
+  if (m_pending_count == 0u)
+    {
+    return false;
+    }
+
+  m_pending_count--;
+
+  return !m_failed;
+  }
 
 
 //=======================================================================================
@@ -91,7 +283,18 @@ eSkLoadStatus SkRuntimeBase::load_compiled_hierarchy()
 
 
   //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-  // 2) Load SkookumScript compiled binary
+  // 2) Load SkookumScript compiled binary - streamed if supported
+  SkBinaryStream * stream_p = get_binary_hierarchy_stream();
+
+  if (stream_p)
+    {
+    eSkLoadStatus status = load_compiled_hierarchy_stream(stream_p);
+
+    release_binary_stream(stream_p);
+
+    return status;
+    }
+
   SkBinaryHandle * hierarchy_handle_p  = get_binary_hierarchy();
   const void **    hierarchy_binary_pp = (const void **)&hierarchy_handle_p->m_binary_p;
   eAEquate         version = SkBrain::is_binary_valid(*hierarchy_binary_pp);
@@ -112,22 +315,8 @@ eSkLoadStatus SkRuntimeBase::load_compiled_hierarchy()
     }
 
   //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-  // Clean out anything remaining from a previous session
-  if (SkookumScript::get_initialization_level() > SkookumScript::InitializationLevel_none)
-    {
-    // Sim might not be running
-    if (SkookumScript::get_initialization_level() >= SkookumScript::InitializationLevel_sim)
-      {
-      SkookumScript::deinitialize_sim();
-      SkookumScript::deinitialize_program();
-      }
-    SkookumScript::deinitialize();
-    }
-
-  //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
-  // 3) Starts up SkookumScript - Registers/connects atomic classes, coroutines, etc. that
-  // do not require the code or compiled binary to be already loaded.
-  SkookumScript::initialize();
+  // 3) Clean out anything remaining from a previous session and start up SkookumScript
+  reinitialize_for_load();
 
   //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
   // 4) Convert compiled binary to data structures
@@ -143,6 +332,151 @@ eSkLoadStatus SkRuntimeBase::load_compiled_hierarchy()
   return SkLoadStatus_ok;
   }
 
+//---------------------------------------------------------------------------------------
+// Load the Skookum class hierarchy scripts in compiled binary form from an async byte
+// source.  Reads are pipelined in chunks and each class is deserialized as soon as its
+// record has arrived - the core classes come first in the binary so they are ready while
+// the bulk of the engine classes is still being read.
+// 
+// Params:
+//   stream_p: source of the compiled binary - not released here
+//   
+// Notes:
+//   Called by load_compiled_hierarchy() when get_binary_hierarchy_stream() supplies a
+//   stream - it can also be called directly, for example with a SkBinaryStreamFile.
+//   The symbol table (if any) must already be loaded.
+//   
+// See:  load_compiled_hierarchy(), SkBrain::assign_binary()
+eSkLoadStatus SkRuntimeBase::load_compiled_hierarchy_stream(SkBinaryStream * stream_p)
+  {
+  SkBinaryStreamReader reader(stream_p);
+
+  if (!reader.ensure(SkBrain::Binary_header_size))
+    {
+    return SkLoadStatus_not_found;
+    }
+
+  eAEquate version = SkBrain::is_binary_valid(reader.get_binary());
+
+  if (version != AEquate_equal)
+    {
+    SkDebug::print_agog(a_str_format(
+      "  Compiled binary file is %s!\n\n",
+      (version == AEquate_less)
+        ? "stale, engine is newer"
+        : "newer, engine is older"));
+
+    return (version == AEquate_less)
+        ? SkLoadStatus_stale
+        : SkLoadStatus_runtime_old;
+    }
+
+  // Everything preceding the class records - the hierarchy, the class count and the index
+  // of where each class record ends - is needed in one go.  It is all read and checked
+  // before the current runtime is torn down so a binary that does not add up leaves the
+  // previously loaded scripts in place.
+  uint32_t members_offset = SkBrain::get_binary_members_offset(reader.get_binary());
+
+  if ((members_offset < SkBrain::Binary_header_size) || !reader.ensure(members_offset + 4u))
+    {
+    SkDebug::print_agog("  Compiled binary file is truncated or corrupt!\n\n");
+
+    return SkLoadStatus_not_found;
+    }
+
+  // 4 bytes - number of classes (excluding demand loaded) - 64-bit offset so a corrupt
+  // count cannot wrap around
+  const uint8_t * group_p        = reader.get_binary() + members_offset;
+  uint32_t        class_count    = A_BYTE_STREAM_UI32(group_p);
+  uint64_t        records_offset = members_offset + 4ull + uint64_t(class_count) * SkClass::Binary_group_index_entry_size;
+
+  if ((records_offset > reader.get_size()) || !reader.ensure(uint32_t(records_offset)))
+    {
+    SkDebug::print_agog("  Compiled binary file is truncated or corrupt!\n\n");
+
+    return SkLoadStatus_not_found;
+    }
+
+  // 4 bytes - index entry }- Repeating - gives where each class record ends - the records
+  // must follow each other and exactly fill the rest of the binary
+  uint32_t records_length = reader.get_size() - uint32_t(records_offset);
+  uint32_t prev_end       = 0u;
+
+  for (uint32_t idx = 0u; idx < class_count; idx++)
+    {
+    uint32_t record_end = SkClass::get_binary_record_end(group_p, idx);
+
+    if ((record_end <= prev_end) || (record_end > records_length))
+      {
+      prev_end = UINT32_MAX;
+      break;
+      }
+
+    prev_end = record_end;
+    }
+
+  if (prev_end != records_length)
+    {
+    SkDebug::print_agog("  Compiled binary file is truncated or corrupt!\n\n");
+
+    return SkLoadStatus_not_found;
+    }
+
+  reinitialize_for_load();
+
+  const void * binary_p = reader.get_binary();
+
+  SkBrain::assign_binary_hierarchy(&binary_p);
+  SK_ASSERTX((const uint8_t *)binary_p == reader.get_binary() + members_offset, "Inconsistent class members offset in loaded compiled binary!");
+
+  //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  // Load class members as their records arrive
+  bool loaded_all = true;
+
+  binary_p = reader.get_binary() + records_offset;
+
+  #if (SKOOKUM & SK_DEBUG)
+    SkExpressionBase::set_new_expr_debug_info(SkDebugInfo::Flag__default_source);
+  #endif
+
+  for (uint32_t idx = 0u; idx < class_count; idx++)
+    {
+    // n bytes - class binary
+    uint32_t record_end = uint32_t(records_offset) + SkClass::get_binary_record_end(group_p, idx);
+
+    if (!reader.ensure(record_end))
+      {
+      loaded_all = false;
+      break;
+      }
+
+    SkClass::from_binary_record(&binary_p);
+    SK_ASSERTX((const uint8_t *)binary_p - reader.get_binary() == (ptrdiff_t)record_end, "Inconsistent class record length in loaded compiled binary!");
+    }
+
+  #if (SKOOKUM & SK_DEBUG)
+    SkExpressionBase::set_new_expr_debug_info(SkDebugInfo::Flag__default);
+  #endif
+
+  SkBrain::assign_binary_end();
+
+  if (!loaded_all)
+    {
+    // Only a failed read gets here - everything else was checked up front.  Do not leave
+    // a partially loaded hierarchy behind.
+    SK_ERRORX("Compiled binary could not be read completely - a read failed!");
+    reinitialize_for_load();
+
+    return SkLoadStatus_not_found;
+    }
+
+  SK_ASSERTX((const uint8_t *)binary_p - reader.get_binary() == (ptrdiff_t)reader.get_size(), a_str_format("Inconsistent binary length of loaded compiled binary (expected: %u, actual: %d)!", reader.get_size(), int((const uint8_t *)binary_p - reader.get_binary())));
+
+  // Note: Do _not_ initialize program and sim here - will be done later in bind_compiled_scripts()
+
+  return SkLoadStatus_ok;
+  }
+
 //---------------------------------------------------------------------------------------
 // Loads group of classes the specified class belongs to if not already loaded.
 // This can be used as a mechanism to "demand load" scripts.
@@ -173,6 +507,8 @@ void SkRuntimeBase::load_compiled_class_group(SkClass * class_p)
 
     release_binary(bin_handle_p);
 
+    SkOptimizer::optimize_class_recurse(root_p);
+
     // $Revisit - CReis Should call optional "register bindings" callback for class group
 
     // Call class constructors as requested
@@ -0,0 +1,257 @@
+// Copyright 1998-2019 Epic Games, Inc. All Rights Reserved.
+
+//=======================================================================================
+// SkookumScript C++ library.
+//
+// Character run scanning used by the parser's lexical loops
+//=======================================================================================
+
+
+//=======================================================================================
+// Includes
+//=======================================================================================
+
+#include <SkookumScript/Sk.hpp> // Always include Sk.hpp first (as some builds require a designated precompiled header)
+#include <SkookumScript/SkScanner.hpp>
+
+#if (SKOOKUM & SK_CODE_IN)
+
+#include <AgogCore/AString.hpp>
+
+#if defined(SK_SCANNER_SCALAR)
+  // Portable loops only
+#elif !defined(A_NO_SSE) && (defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__))
+  #define SK_SCANNER_SSE2
+  #include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+  #define SK_SCANNER_NEON
+  #include <arm_neon.h>
+#endif
+
+#if defined(_MSC_VER) && (defined(SK_SCANNER_SSE2) || defined(SK_SCANNER_NEON))
+  #include <intrin.h>
+#endif
+
+
+//=======================================================================================
+// Local Global Structures
+//=======================================================================================
+
+namespace
+{
+
+  #if defined(SK_SCANNER_SSE2) || defined(SK_SCANNER_NEON)
+
+    // Number of characters classified at once by the vectorized loops
+    const ptrdiff_t SkScanner_lane_count = 16;
+
+    //---------------------------------------------------------------------------------------
+    // Returns index of the lowest set bit - `bits` must not be 0
+    inline uint32_t lowest_bit_idx(uint64_t bits)
+      {
+      #if defined(_MSC_VER)
+        unsigned long idx;
+
+        #if defined(A_BITS64)
+          _BitScanForward64(&idx, bits);
+        #else
+          if (!_BitScanForward(&idx, uint32_t(bits)))
+            {
+            _BitScanForward(&idx, uint32_t(bits >> 32u));
+            idx += 32u;
+            }
+        #endif
+
+        return uint32_t(idx);
+      #else
+        return uint32_t(__builtin_ctzll(bits));
+      #endif
+      }
+
+  #endif
+
+  #if defined(SK_SCANNER_SSE2)
+
+    typedef __m128i tSkLanes;
+
+    inline tSkLanes lanes_load(const char * cstr_p)     { return _mm_loadu_si128(reinterpret_cast<const __m128i *>(cstr_p)); }
+    inline tSkLanes lanes_dup(char ch)                  { return _mm_set1_epi8(ch); }
+    inline tSkLanes lanes_eq(tSkLanes a, tSkLanes b)    { return _mm_cmpeq_epi8(a, b); }
+    inline tSkLanes lanes_or(tSkLanes a, tSkLanes b)    { return _mm_or_si128(a, b); }
+    inline tSkLanes lanes_and_not(tSkLanes a, tSkLanes b) { return _mm_andnot_si128(b, a); }
+
+    // Lanes in the inclusive range [first, last] - unsigned comparison via saturating min
+    inline tSkLanes lanes_in_range(tSkLanes chars, char first, char last)
+      {
+      tSkLanes offset = _mm_sub_epi8(chars, _mm_set1_epi8(first));
+
+      return _mm_cmpeq_epi8(_mm_min_epu8(offset, _mm_set1_epi8(char(last - first))), offset);
+      }
+
+    // Bit per lane with the bit of the first lane lowest
+    inline uint64_t lanes_bits(tSkLanes mask)           { return uint64_t(uint32_t(_mm_movemask_epi8(mask))); }
+    const uint64_t  SkScanner_lane_bits_all = 0xFFFFu;
+    const uint32_t  SkScanner_lane_bits_shift = 0u;
+
+  #elif defined(SK_SCANNER_NEON)
+
+    typedef uint8x16_t tSkLanes;
+
+    inline tSkLanes lanes_load(const char * cstr_p)     { return vld1q_u8(reinterpret_cast<const uint8_t *>(cstr_p)); }
+    inline tSkLanes lanes_dup(char ch)                  { return vdupq_n_u8(uint8_t(ch)); }
+    inline tSkLanes lanes_eq(tSkLanes a, tSkLanes b)    { return vceqq_u8(a, b); }
+    inline tSkLanes lanes_or(tSkLanes a, tSkLanes b)    { return vorrq_u8(a, b); }
+    inline tSkLanes lanes_and_not(tSkLanes a, tSkLanes b) { return vbicq_u8(a, b); }
+
+    inline tSkLanes lanes_in_range(tSkLanes chars, char first, char last)
+      {
+      return vcleq_u8(vsubq_u8(chars, vdupq_n_u8(uint8_t(first))), vdupq_n_u8(uint8_t(last - first)));
+      }
+
+    // Nibble per lane with the nibble of the first lane lowest - NEON has no movemask
+    inline uint64_t lanes_bits(tSkLanes mask)
+      {
+      return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(mask), 4)), 0);
+      }
+    const uint64_t  SkScanner_lane_bits_all = ~uint64_t(0u);
+    const uint32_t  SkScanner_lane_bits_shift = 2u;
+
+  #endif
+
+  //---------------------------------------------------------------------------------------
+  // White space - Horizontal Tab, Line Feed, Vertical Tab, Form Feed, Carriage Return and
+  // Space - see ACharMatch_white_space
+  struct SkScanWhiteSpace
+    {
+    explicit SkScanWhiteSpace(bool treat_lf_as_ws) : m_treat_lf_as_ws(treat_lf_as_ws) {}
+
+    bool operator()(uint8_t ch) const
+      {
+      return AString::ms_is_space[ch] && (m_treat_lf_as_ws || (ch != '\n'));
+      }
+
+    #if defined(SK_SCANNER_SSE2) || defined(SK_SCANNER_NEON)
+      tSkLanes lanes(tSkLanes chars) const
+        {
+        tSkLanes mask = lanes_or(lanes_in_range(chars, '\t', '\r'), lanes_eq(chars, lanes_dup(' ')));
+
+        return m_treat_lf_as_ws ? mask : lanes_and_not(mask, lanes_eq(chars, lanes_dup('\n')));
+        }
+    #endif
+
+    bool m_treat_lf_as_ws;
+    };
+
+  //---------------------------------------------------------------------------------------
+  // A-Z, a-z, 0-9 or _ - see ACharMatch_identifier
+  struct SkScanIdentifier
+    {
+    bool operator()(uint8_t ch) const
+      {
+      return AString::ms_char_match_table[ACharMatch_identifier][ch];
+      }
+
+    #if defined(SK_SCANNER_SSE2) || defined(SK_SCANNER_NEON)
+      tSkLanes lanes(tSkLanes chars) const
+        {
+        // Setting bit 5 folds uppercase onto lowercase without making anything else a letter
+        tSkLanes alpha = lanes_in_range(lanes_or(chars, lanes_dup(0x20)), 'a', 'z');
+
+        return lanes_or(lanes_or(alpha, lanes_in_range(chars, '0', '9')), lanes_eq(chars, lanes_dup('_')));
+        }
+    #endif
+    };
+
+  //---------------------------------------------------------------------------------------
+  // Either of two characters
+  struct SkScanEither
+    {
+    SkScanEither(char ch1, char ch2) : m_ch1(ch1), m_ch2(ch2) {}
+
+    bool operator()(uint8_t ch) const
+      {
+      return (ch == uint8_t(m_ch1)) || (ch == uint8_t(m_ch2));
+      }
+
+    #if defined(SK_SCANNER_SSE2) || defined(SK_SCANNER_NEON)
+      tSkLanes lanes(tSkLanes chars) const
+        {
+        return lanes_or(lanes_eq(chars, lanes_dup(m_ch1)), lanes_eq(chars, lanes_dup(m_ch2)));
+        }
+    #endif
+
+    char m_ch1;
+    char m_ch2;
+    };
+
+  //---------------------------------------------------------------------------------------
+  // Returns first position in [cstr_p, cstr_end_p) where characters stop matching (if
+  // `_Skip`) or start matching (if not `_Skip`) or cstr_end_p if there is no such
+  // position.
+  template<bool _Skip, class _Match>
+  inline const char * scan(const char * cstr_p, const char * cstr_end_p, const _Match & match)
+    {
+    #if defined(SK_SCANNER_SSE2) || defined(SK_SCANNER_NEON)
+      while ((cstr_end_p - cstr_p) >= SkScanner_lane_count)
+        {
+        uint64_t bits = lanes_bits(match.lanes(lanes_load(cstr_p)));
+
+        if (_Skip)
+          {
+          bits ^= SkScanner_lane_bits_all;
+          }
+
+        if (bits)
+          {
+          return cstr_p + (lowest_bit_idx(bits) >> SkScanner_lane_bits_shift);
+          }
+
+        cstr_p += SkScanner_lane_count;
+        }
+    #endif
+
+    while ((cstr_p < cstr_end_p) && (match(uint8_t(*cstr_p)) == _Skip))
+      {
+      cstr_p++;
+      }
+
+    return cstr_p;
+    }
+
+} // End unnamed namespace
+
+
+//=======================================================================================
+// SkScanner Class Method Definitions
+//=======================================================================================
+
+//---------------------------------------------------------------------------------------
+// Returns first position that is not white space
+//
+// Params:
+//   treat_lf_as_ws: if line feed is considered white space
+const char * SkScanner::skip_white_space(
+  const char * cstr_p,
+  const char * cstr_end_p,
+  bool         treat_lf_as_ws // = true
+  )
+  {
+  return scan<true>(cstr_p, cstr_end_p, SkScanWhiteSpace(treat_lf_as_ws));
+  }
+
+//---------------------------------------------------------------------------------------
+// Returns first position that is not part of an identifier - A-Z, a-z, 0-9 or _
+const char * SkScanner::skip_identifier(const char * cstr_p, const char * cstr_end_p)
+  {
+  return scan<true>(cstr_p, cstr_end_p, SkScanIdentifier());
+  }
+
+//---------------------------------------------------------------------------------------
+// Returns first position of either `ch1` or `ch2` - pass the same character twice to find
+// a single character.
+const char * SkScanner::find_either(const char * cstr_p, const char * cstr_end_p, char ch1, char ch2)
+  {
+  return scan<false>(cstr_p, cstr_end_p, SkScanEither(ch1, ch2));
+  }
+
+#endif  // (SKOOKUM & SK_CODE_IN)
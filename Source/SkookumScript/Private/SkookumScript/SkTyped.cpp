@@ -17,6 +17,9 @@
   #include <SkookumScript/SkTyped.inl>
 #endif
 
+#include <SkookumScript/SkClass.hpp>
+#include <SkookumScript/SkInstance.hpp>
+
 
 //=======================================================================================
 // SkTypedName Method Definitions
@@ -108,6 +111,8 @@ void SkTypedName::assign_binary(const void ** binary_pp)
 SkTypedNameRaw::SkTypedNameRaw() 
   : m_bind_name(AString::ms_empty)
   , m_raw_data_info()
+  , m_raw_pod_class_p(nullptr)
+  , m_raw_pod_instance_p(nullptr)
   {
   }
 
@@ -117,6 +122,8 @@ SkTypedNameRaw::SkTypedNameRaw(const ASymbol & name, const SkClassDescBase * typ
   : SkTypedName(name, type_p)
   , m_bind_name(bind_name)
   , m_raw_data_info()
+  , m_raw_pod_class_p(nullptr)
+  , m_raw_pod_instance_p(nullptr)
   {
   }
 
@@ -128,6 +135,8 @@ SkTypedNameRaw::SkTypedNameRaw(const void ** binary_pp)
   : SkTypedName(binary_pp)
   , m_bind_name(binary_pp)
   , m_raw_data_info()
+  , m_raw_pod_class_p(nullptr)
+  , m_raw_pod_instance_p(nullptr)
   {
   }
 
@@ -137,10 +146,96 @@ void SkTypedNameRaw::assign_binary(const void ** binary_pp)
   {
   SkTypedName::assign_binary(binary_pp);
   m_bind_name.assign_binary(binary_pp);
+
+  // Type may have changed
+  resolve_raw_pod();
   }
 
 #endif
 
+//---------------------------------------------------------------------------------------
+// Determines if this member can be copied directly to/from the owner's memory - i.e. if
+// its type wraps plain old data of exactly the size the engine reported for it.
+// Called whenever m_raw_data_info or the type changes so accessors can skip the indirect
+// call through the type's tSkRawAccessorFunc.
+void SkTypedNameRaw::resolve_raw_pod()
+  {
+  SkClass * class_p = m_raw_data_info.IsValid() ? m_type_p->get_key_class() : nullptr;
+
+  // Cached instance may be of the old class or size
+  release_raw_pod_instance();
+
+  m_raw_pod_class_p = (class_p && (class_p->get_raw_pod_size() == uint32_t(m_raw_data_info.Size)))
+    ? class_p
+    : nullptr;
+  }
+
+//---------------------------------------------------------------------------------------
+
+SkTypedNameRaw::~SkTypedNameRaw()
+  {
+  release_raw_pod_instance();
+  }
+
+//---------------------------------------------------------------------------------------
+// Returns a new instance of m_raw_pod_class_p holding a copy of the plain old data at
+// data_p - reusing the instance handed out by the previous call if nothing else refers to
+// it any more.  The result has a reference for the caller just like
+// SkInstance::new_instance().
+// 
+// Notes:  Only data that fits inside the instance is cached - larger data is stored on the
+//         heap and must go through the class destructor, so it gets a new instance each
+//         time as before.
+// See:    SkInstanceCache - same idea for bound C++ types
+SkInstance * SkTypedNameRaw::new_raw_pod_instance(const void * data_p) const
+  {
+  uint32_t     byte_size  = uint32_t(m_raw_data_info.Size);
+  SkInstance * instance_p = m_raw_pod_instance_p;
+
+  if (instance_p && (instance_p->get_references() == 1u))
+    {
+    // Anything that kept the id of its previous use must not see it as still alive
+    instance_p->renew_id();
+    instance_p->reference();
+    ::memcpy(instance_p->get_raw_pointer_val(), data_p, byte_size);
+
+    return instance_p;
+    }
+
+  instance_p = SkInstance::new_instance(m_raw_pod_class_p, data_p, byte_size);
+
+  if (!m_raw_pod_instance_p && SkInstance::is_data_stored_by_val(byte_size))
+    {
+    instance_p->reference();
+    m_raw_pod_instance_p = instance_p;
+    }
+
+  return instance_p;
+  }
+
+//---------------------------------------------------------------------------------------
+// Drops the instance cached by new_raw_pod_instance()
+void SkTypedNameRaw::release_raw_pod_instance() const
+  {
+  SkInstance * instance_p = m_raw_pod_instance_p;
+
+  if (instance_p)
+    {
+    m_raw_pod_instance_p = nullptr;
+
+    // Stored by value so there is nothing to destruct - and its class may already be gone
+    // if this is called during class hierarchy tear down
+    if (instance_p->get_references() == 1u)
+      {
+      instance_p->delete_this();
+      }
+    else
+      {
+      instance_p->dereference();
+      }
+    }
+  }
+
 #if (SKOOKUM & SK_COMPILED_OUT)
 
 //---------------------------------------------------------------------------------------
@@ -28,6 +28,9 @@
 // Typed class objects that are shared amongst various data-structures
 APSortedLogicalFree<SkTypedClass> SkTypedClass::ms_typed_classes;
 
+// Hashed look-up in front of ms_typed_classes
+SkInternCache<SkTypedClass> SkTypedClass::ms_intern_cache;
+
 
 //=======================================================================================
 // SkTypedClass Method Definitions
@@ -287,6 +290,11 @@ bool SkTypedClass::shared_ensure_references()
       }
     }
 
+  if (anything_changed)
+    {
+    ms_intern_cache.flush();
+    }
+
   // If empty, get rid of memory
   if (ms_typed_classes.is_empty())
     {
@@ -14,6 +14,7 @@
 
 #include <AgogCore/APSorted.hpp>
 #include <SkookumScript/SkContextClassBase.hpp>
+#include <SkookumScript/SkInternCache.hpp>
 
 
 //=======================================================================================
@@ -97,7 +98,7 @@ class SkTypedClass : public SkContextClassBase
     static SkTypedClass * get_or_create(const SkTypedClass & tclass);
     static SkTypedClass * get_or_create(SkClass * class_p, SkClassDescBase * item_type_p);
     static void           shared_pre_empty();
-    static void           shared_empty()                        { ms_typed_classes.free_all(); }  
+    static void           shared_empty()                        { ms_intern_cache.flush(); ms_typed_classes.free_all(); }  
     static bool           shared_ensure_references();
     static void           shared_track_memory(AMemoryStats * mem_stats_p);
 
@@ -118,6 +119,9 @@ class SkTypedClass : public SkContextClassBase
     // Typed Class objects that are shared amongst various data-structures
     static APSortedLogicalFree<SkTypedClass> ms_typed_classes;
 
+    // Hashed look-up in front of ms_typed_classes - see get_or_create()
+    static SkInternCache<SkTypedClass> ms_intern_cache;
+
   };  // SkTypedClass
 
 
@@ -159,6 +159,7 @@ A_INLINE void SkTypedClass::clear()
 // Author(s):   Conan Reis
 A_INLINE void SkTypedClass::on_no_references()
   {
+  ms_intern_cache.flush();
   ms_typed_classes.free(*this);
   }
 
@@ -171,8 +172,17 @@ A_INLINE void SkTypedClass::on_no_references()
 // Author(s):   Conan Reis
 A_INLINE SkTypedClass * SkTypedClass::get_or_create(const SkTypedClass & tclass)
   {
-  uint32_t       find_pos;
-  SkTypedClass * tclass_p = ms_typed_classes.get(tclass, AMatch_first_found, &find_pos);
+  uint32_t       crc      = tclass.generate_crc32();
+  SkTypedClass * tclass_p = ms_intern_cache.find(tclass, crc);
+
+  if (tclass_p)
+    {
+    return tclass_p;
+    }
+
+  uint32_t find_pos;
+
+  tclass_p = ms_typed_classes.get(tclass, AMatch_first_found, &find_pos);
 
   if (tclass_p == nullptr)
     {
@@ -184,6 +194,8 @@ A_INLINE SkTypedClass * SkTypedClass::get_or_create(const SkTypedClass & tclass)
     ms_typed_classes.insert(*tclass_p, find_pos);
     }
 
+  ms_intern_cache.store(tclass_p, crc);
+
   return tclass_p;
   }
 
@@ -285,6 +285,7 @@ enum eSkAnnotation
   SkAnnotation_reflected_data   = 1 << 2, // This class was auto-generated from data (e.g. a Blueprint class)
   SkAnnotation_invokable        = 1 << 3, // This class represents an invokable instance and must be qualified with a signature
   SkAnnotation_ue4_blueprint    = 1 << 6, // $UE4-specific Expose this method to the UE4 Blueprint system
+  SkAnnotation_ue4_batched      = 1 << 7, // $UE4-specific Defer Blueprint calls of this method and invoke them once per frame
 
   SkAnnotation__none    = 0,
   SkAnnotation__default = SkAnnotation__none
@@ -394,6 +395,7 @@ class SK_API SkookumScript
       static f32      get_sim_delta()                                     { return ms_sim_delta; }
       static void     register_update_time_func(void (*update_time_f)())  { ms_update_time_f = update_time_f; }
       static void     reset_time();
+      static void     set_time(uint64_t sim_ticks, f64 sim_time, f32 sim_delta);
       static void     update_time();
       static void     update_time_ticks(uint64_t sim_ticks);
 
@@ -533,6 +535,19 @@ inline void SkookumScript::reset_time()
   ms_sim_delta = 0.0f;
   }
 
+//---------------------------------------------------------------------------------------
+// Sets the time variables without updating - such as when replaying a recording
+inline void SkookumScript::set_time(
+  uint64_t sim_ticks,
+  f64      sim_time,
+  f32      sim_delta
+  )
+  {
+  ms_sim_ticks = sim_ticks;
+  ms_sim_time  = sim_time;
+  ms_sim_delta = sim_delta;
+  }
+
 #if (SKOOKUM & SK_COMPILED_IN)
 
 //---------------------------------------------------------------------------------------
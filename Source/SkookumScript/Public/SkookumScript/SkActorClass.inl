@@ -54,6 +54,12 @@ A_INLINE void SkActorClass::append_instance(const SkActor & actor)
 
     m_instances.append(actor);
 
+    // Only bump from the class of the actor itself - superclasses are bumped by it
+    if (actor.get_class() == this)
+      {
+      object_id_generation_bump();
+      }
+
     if (m_superclass_p->is_builtin_actor_class())
       {
       static_cast<SkActorClass *>(m_superclass_p)->append_instance(actor);
@@ -81,6 +87,12 @@ A_INLINE void SkActorClass::remove_instance(
     {
     m_instances.remove_elem(actor);
 
+    // Only bump from the class of the actor itself - superclasses are bumped by it
+    if (actor.get_class() == this)
+      {
+      object_id_generation_bump();
+      }
+
     if (m_superclass_p->is_builtin_actor_class())
       {
       static_cast<SkActorClass *>(m_superclass_p)->remove_instance(actor);
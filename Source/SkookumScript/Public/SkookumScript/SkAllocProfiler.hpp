@@ -0,0 +1,66 @@
+// Copyright 1998-2019 Epic Games, Inc. All Rights Reserved.
+
+//=======================================================================================
+// SkookumScript C++ library.
+//
+// Runtime allocation accounting per script routine and per object pool
+//=======================================================================================
+
+#pragma once
+
+//=======================================================================================
+// Includes
+//=======================================================================================
+
+#include <SkookumScript/Sk.hpp>
+
+
+//=======================================================================================
+// Global Structures
+//=======================================================================================
+
+#if (SKOOKUM & SK_DEBUG)
+
+//---------------------------------------------------------------------------------------
+// Opt-in profiler that attributes runtime allocations to the script routine that made
+// them - where AMemoryStats and SkDebug::print_memory_runtime() only give snapshots of
+// how much memory is in use.
+//
+// While enabled it counts:
+//   - every AObjReusePool allocate() / recycle() - via AObjReusePoolObserver so only
+//     when AORPOOL_OBSERVER is defined (A_EXTRA_CHECK builds)
+//   - every AgogCore malloc() / free() - by temporarily putting itself in front of the
+//     app's AAppInfoCore (see AgogCore::set_app_info())
+// against the routine in SkDebug::ms_current_call_p - or against "outside scripts" when
+// no routine is running.  Closures are counted against the routine they are written in.
+//
+// Counts are totals since enable() or reset() plus per frame figures (allocations in
+// the last frame and the worst frame) - a frame ends with each SkMind::update_all().
+// Routines are kept in a fixed size table so the profiler never allocates itself; once
+// it is full further routines are lumped together as "overflow".
+//
+// Results can be printed with print() (also `Debug.print_memory_profile()`) or sent to
+// the IDE with Command_memory_reply - see SkRemoteRuntimeBase::on_cmd_memory().
+//
+// $Note - Only call from the thread that runs scripts - the counters are not atomic.
+class SK_API SkAllocProfiler
+  {
+  public:
+
+  // Class Methods
+
+    static void     enable(bool enable_b = true);
+    static bool     is_enabled();
+    static void     reset();
+    static void     on_frame_end();
+    static uint32_t get_frame_count();
+    static void     print(uint32_t top_count = 20u);
+
+    #if (SKOOKUM & SK_COMPILED_OUT)
+      static void     as_binary(void ** binary_pp, uint32_t top_count);
+      static uint32_t as_binary_length(uint32_t top_count);
+    #endif
+
+  };  // SkAllocProfiler
+
+#endif  // (SKOOKUM & SK_DEBUG)
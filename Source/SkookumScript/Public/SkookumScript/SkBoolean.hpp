@@ -26,5 +26,10 @@ class SK_API SkBoolean : public SkClassBindingSimpleZero<SkBoolean, tSkBoolean>
     static void       register_bindings();
     static SkClass *  get_class();
 
+    // Boolean results are created constantly so instances for both values are reused
+    using tBindingBase::new_instance;
+    static SkInstance * new_instance(tSkBoolean value);
+    static void         release_cached_instances();
+
   };
 
@@ -59,12 +59,21 @@ class SK_API SkBrain
       ErrId_no_superclass                       // Requested superclass does not exist
       };
 
+    enum
+      {
+      // Bytes of compiled binary needed by is_binary_valid() and get_binary_members_offset()
+      Binary_header_size = 8u
+      };
+
     // Header for compiled binary code
     struct BinHeader
       {
       // Compiled binary code id
       uint32_t m_id;
 
+      // Byte offset of class members - see get_binary_members_offset()
+      uint32_t m_members_offset;
+
       // Folder checksum from source scripts
       uint32_t m_checksum_folders;
 
@@ -148,7 +157,10 @@ class SK_API SkBrain
     #if (SKOOKUM & SK_COMPILED_IN)
 
       static void      assign_binary(const void ** binary_pp);
+      static void      assign_binary_hierarchy(const void ** binary_pp);
+      static void      assign_binary_end();
       static void      assign_binary_class_hier(const void ** binary_pp, SkClass * superclass_p);
+      static uint32_t  get_binary_members_offset(const void * binary_p);
       static eAEquate  is_binary_valid(const void * binary_p);
       static eAEquate  is_binary_id_valid(uint32_t bin_id);
 
@@ -17,6 +17,7 @@
 #include <SkookumScript/SkDataInstance.hpp>
 #include <SkookumScript/SkMethod.hpp>
 #include <SkookumScript/SkCoroutine.hpp>  // Needs: tSkCoroutineFunc and tSkCoroutineMthd
+#include <SkookumScript/SkInternCache.hpp>
 
 
 //=======================================================================================
@@ -88,6 +89,10 @@ struct SkProgramUpdateRecord
   APSortedLogicalFree<SkClassUpdateRecord, ASymbol>  m_updated_classes;
   
   SkClassUpdateRecord * get_or_create_class_update_record(const ASymbol & class_name);  
+
+  #if (SKOOKUM & SK_DEBUG)
+    eAIterateResult iterate_expressions(SkApplyExpressionBase * apply_expr_p);
+  #endif
   };
 
 //---------------------------------------------------------------------------------------
@@ -335,6 +340,12 @@ class SK_API SkClass : public SkClassUnaryBase, public ANamed
       ErrId_nonexistent_coroutine,                  // No such coroutine exists
       };
 
+    enum
+      {
+      // Class group binary index entry - record end offset - see as_binary_group()
+      Binary_group_index_entry_size = 4
+      };
+
     enum eSubclass
       {
       Subclass_recurse,  // Apply recursively to subclasses
@@ -399,6 +410,16 @@ class SK_API SkClass : public SkClassUnaryBase, public ANamed
       uint32_t        m_method_name_id;
       tSkMethodFunc   m_atomic_f;
       };
+
+    // Table of method bindings whose registration is deferred until a method of the
+    // class is first invoked unbound - see register_method_func_bulk_deferred()
+    struct PendingMethodFuncs
+      {
+      const MethodInitializerFunc * m_bindings_p;
+      uint32_t                      m_count;
+      eSkBindFlag                   m_flags;
+      PendingMethodFuncs *          m_next_p;
+      };
     
     struct MethodInitializerMthd
       {
@@ -515,6 +536,10 @@ class SK_API SkClass : public SkClassUnaryBase, public ANamed
     tSkRawAccessorFunc   get_raw_accessor_func_inherited() const;
     tSkRawPointerFunc    get_raw_pointer_func() const   { return m_raw_pointer_f; }
     tSkRawPointerFunc    get_raw_pointer_func_inherited() const;
+    void                 register_raw_pod_size(uint32_t byte_size)  { m_raw_pod_size = byte_size; }
+    uint32_t             get_raw_pod_size() const                   { return m_raw_pod_size; }
+    void                 register_payload_size(uint32_t byte_size)  { m_payload_size = byte_size; }
+    uint32_t             get_payload_size() const                   { return m_payload_size; }
     SkInstance *         new_instance_from_raw_data(void * obj_p, tSkRawDataInfo raw_data_info, SkClassDescBase * data_type_p) const;
     void                 assign_raw_data(void * obj_p, tSkRawDataInfo raw_data_info, SkClassDescBase * data_type_p, SkInstance * value_p) const;
     void *               get_raw_pointer(SkInstance * obj_p) const;
@@ -522,7 +547,6 @@ class SK_API SkClass : public SkClassUnaryBase, public ANamed
     #if (SKOOKUM & SK_COMPILED_OUT)
       virtual void     as_binary(void ** binary_pp, bool include_routines = true) const;
       virtual uint32_t as_binary_length(bool include_routines = true) const;
-      void             as_binary_recurse(void ** binary_pp, bool skip_demand_loaded) const;
       uint32_t         as_binary_recurse_length(bool skip_demand_loaded) const;
       void             as_binary_group(void ** binary_pp, bool skip_demand_loaded) const;
       uint32_t         as_binary_group_length(bool skip_demand_loaded) const;
@@ -534,8 +558,16 @@ class SK_API SkClass : public SkClassUnaryBase, public ANamed
 
     #if (SKOOKUM & SK_COMPILED_IN)
       void             assign_binary(const void ** binary_pp, bool include_routines = true);
+      bool             is_data_binary_same(const void ** binary_pp) const;
       static SkClass * from_binary_ref(const void ** binary_pp);
+      static SkClass * from_binary_record(const void ** binary_pp);
       static void      from_binary_group(const void ** binary_pp);
+
+      // Offset of the first class record from the start of a class group binary
+      static uint32_t  get_binary_records_offset(uint32_t class_count)  { return 4u + (class_count * Binary_group_index_entry_size); }
+
+      // Offset of the end of record `idx` from the first class record of a class group binary
+      static uint32_t  get_binary_record_end(const void * group_binary_p, uint32_t idx)  { return A_BYTE_STREAM_UI32((const uint8_t *)group_binary_p + get_binary_records_offset(idx)); }
       void             append_instance_method(const void ** binary_pp, SkRoutineUpdateRecord * update_record_p = nullptr);
       void             append_class_method(const void ** binary_pp, SkRoutineUpdateRecord * update_record_p = nullptr);
       void             append_coroutine(const void ** binary_pp, SkRoutineUpdateRecord * update_record_p = nullptr);
@@ -573,6 +605,9 @@ class SK_API SkClass : public SkClassUnaryBase, public ANamed
       void                 set_object_id_lookup_func(tSkObjectIdLookupFunc object_id_lookup_f);
       virtual SkInstance * object_id_lookup(const SkBindName & name, SkInvokedBase * caller_p = nullptr) const;
       void                 object_id_lookup_clear_cache()                 { m_object_id_lookup_p = nullptr; }
+      void                 object_id_generation_bump();
+      void                 object_id_generation_bump_all()                { m_object_id_generation_all++; }
+      uint32_t             get_object_id_generation() const;
 
       #if (SKOOKUM & SK_CODE_IN)
         void              clear_object_id_valid_list();
@@ -595,6 +630,7 @@ class SK_API SkClass : public SkClassUnaryBase, public ANamed
       SkClass *                  find_common_class(const SkClass & cls) const;
       virtual SkClassUnaryBase * find_common_type(const SkClassDescBase & cls) const override;
       uint32_t                   get_class_recurse_count(bool skip_demand_loaded) const;
+      void                       get_class_breadth_first(APArray<SkClass> * classes_p, bool skip_demand_loaded) const;
       tSkClasses &               get_subclasses()                       { return m_subclasses; }
       const tSkClasses &         get_subclasses() const                 { return m_subclasses; }
       void                       get_subclasses_all(tSkClasses * classes_p) const;
@@ -641,6 +677,10 @@ class SK_API SkClass : public SkClassUnaryBase, public ANamed
         void                   register_method_mthd(const char * method_name_p, tSkMethodMthd atomic_m, eSkBindFlag flags = SkBindFlag_default);
         void                   register_method_func_bulk(const MethodInitializerFunc   * bindings_p, uint32_t count, eSkBindFlag flags);
         void                   register_method_func_bulk(const MethodInitializerFuncId * bindings_p, uint32_t count, eSkBindFlag flags);
+        void                   register_method_func_bulk_deferred(const MethodInitializerFunc * bindings_p, uint32_t count, eSkBindFlag flags);
+        bool                   register_pending_method_funcs();
+        uint32_t               get_pending_method_func_count() const;
+        bool                   is_method_func_pending(const ASymbol & method_name, bool is_class_member) const;
         void                   register_method_mthd_bulk(const MethodInitializerMthd   * bindings_p, uint32_t count, eSkBindFlag flags);
         void                   register_method_mthd_bulk(const MethodInitializerMthdId * bindings_p, uint32_t count, eSkBindFlag flags);
 
@@ -791,6 +831,7 @@ class SK_API SkClass : public SkClassUnaryBase, public ANamed
     void         demand_unload_recurse();
     void         set_destructor(SkMethodBase * destructor_p);
     void         build_vtables(bool force_new);
+    void         clear_pending_method_funcs();
 
   // Internal Class Methods
 
@@ -828,6 +869,15 @@ class SK_API SkClass : public SkClassUnaryBase, public ANamed
     // Function to get raw data pointer from an instance of this class type
     tSkRawPointerFunc m_raw_pointer_f;
 
+    // Byte size of the plain old data wrapped by instances of this class or 0 if not plain
+    // old data. If non-zero, raw members of this type with a matching size are copied
+    // directly to/from the owner's memory rather than via m_raw_member_accessor_f.
+    uint32_t m_raw_pod_size;
+
+    // Byte size of the user data wrapped by instances of this class (0 if unknown) - used
+    // by new_instance() to pick an instance whose inline payload can hold the data.
+    uint32_t m_payload_size;
+
     // Object ID Info
 
       // Used to lookup named instance objects via object ID expressions. If set to nullptr
@@ -839,6 +889,14 @@ class SK_API SkClass : public SkClassUnaryBase, public ANamed
       // Used in object_id_lookup()
       mutable SkMethodBase * m_object_id_lookup_p;
 
+      // Incremented whenever a named object of this class or a subclass is added, removed
+      // or renamed - only read for this class itself. See get_object_id_generation()
+      uint32_t m_object_id_generation;
+
+      // Incremented whenever any named object of this class or a subclass may have changed
+      // (such as a world or level change) - summed over this class and its superclasses.
+      uint32_t m_object_id_generation_all;
+
       // Used to validate object IDs for this class.
       // $Revisit - CReis Since there are few classes that use object IDs it might be an idea
       // to store only the symbol tables for classes that actually use them rather than
@@ -872,6 +930,9 @@ class SK_API SkClass : public SkClassUnaryBase, public ANamed
       // List of available coroutines
       tSkCoroutines m_coroutines;
 
+      // Method binding tables not registered yet - see register_method_func_bulk_deferred()
+      PendingMethodFuncs * m_pending_method_funcs_p;
+
      // Class Member Info
 
       // Class Data Members (name, class type and data) for this class - added via this
@@ -1044,7 +1105,8 @@ class SK_API SkClassUnion : public SkClassDescBase, public ARefCountMix<SkClassU
     static SkClassDescBase * get_merge(const SkClassDescBase & class1, const SkClassDescBase & class2);
     static SkClassDescBase * get_merge(const APArrayBase<SkClassDescBase> & classes, bool object_on_empty_b = true);
     static SkClassDescBase * get_reduced(const SkClassUnion & class_union, const SkClassUnaryBase & class_to_remove);
-    static void              shared_empty()               { ms_shared_unions.free_all(); }  
+    static void              shared_empty();
+    static void              shared_flush_merges();
     static bool              shared_ensure_references();
     static void              shared_track_memory(AMemoryStats * mem_stats_p);
 
@@ -1069,6 +1131,9 @@ class SK_API SkClassUnion : public SkClassDescBase, public ARefCountMix<SkClassU
     // Class union objects that are shared amongst various data-structures
     static APSortedLogicalFree<SkClassUnion> ms_shared_unions;
 
+    // Hashed look-up in front of ms_shared_unions - see get_or_create()
+    static SkInternCache<SkClassUnion> ms_intern_cache;
+
   };  // SkClassUnion
 
 
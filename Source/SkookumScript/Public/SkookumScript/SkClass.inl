@@ -304,6 +304,44 @@ A_INLINE void * SkClass::get_raw_pointer(SkInstance * obj_p) const
   return (*m_raw_pointer_f)(obj_p);
   }
 
+//---------------------------------------------------------------------------------------
+// Notes that a named object of this class was added, removed or renamed so object IDs
+// of this class and its superclasses look their object up again - object IDs of sibling
+// classes and subclasses are unaffected.  Call it once for the class of the object
+// itself - it goes up the superclass chain on its own.
+// See Also  object_id_generation_bump_all(), get_object_id_generation(), SkObjectID::invoke()
+A_INLINE void SkClass::object_id_generation_bump()
+  {
+  SkClass * class_p = this;
+
+  do
+    {
+    class_p->m_object_id_generation++;
+    class_p = class_p->m_superclass_p;
+    }
+  while (class_p);
+  }
+
+//---------------------------------------------------------------------------------------
+// Returns a value that changes whenever a named object that an object ID of this class
+// might refer to is added, removed or renamed - i.e. object_id_generation_bump() on this
+// class or a subclass (bumps propagate up) or object_id_generation_bump_all() on this
+// class or a superclass (summed here).
+A_INLINE uint32_t SkClass::get_object_id_generation() const
+  {
+  uint32_t        generation = m_object_id_generation;
+  const SkClass * class_p    = this;
+
+  do
+    {
+    generation += class_p->m_object_id_generation_all;
+    class_p     = class_p->m_superclass_p;
+    }
+  while (class_p);
+
+  return generation;
+  }
+
 #if (SKOOKUM & SK_CODE_IN)
 
 //---------------------------------------------------------------------------------------
@@ -521,7 +559,7 @@ A_INLINE SkInstance * SkClass::new_instance()
     }
   else
     {
-    return SkInstance::new_instance(this);
+    return SkInstance::new_instance_sized(this, m_payload_size);
     }
   }
 
@@ -958,8 +996,17 @@ A_INLINE void SkClassUnion::clear()
 // Author(s):   Conan Reis
 A_INLINE SkClassUnion * SkClassUnion::get_or_create(const SkClassUnion & class_union)
   {
-  uint32_t       find_pos;
-  SkClassUnion * union_p = ms_shared_unions.get(class_union, AMatch_first_found, &find_pos);
+  uint32_t       crc     = class_union.generate_crc32();
+  SkClassUnion * union_p = ms_intern_cache.find(class_union, crc);
+
+  if (union_p)
+    {
+    return union_p;
+    }
+
+  uint32_t find_pos;
+
+  union_p = ms_shared_unions.get(class_union, AMatch_first_found, &find_pos);
 
   if (union_p == nullptr)
     {
@@ -971,6 +1018,8 @@ A_INLINE SkClassUnion * SkClassUnion::get_or_create(const SkClassUnion & class_u
     ms_shared_unions.insert(*union_p, find_pos);
     }
 
+  ms_intern_cache.store(union_p, crc);
+
   return union_p;
   }
 
@@ -1144,6 +1193,7 @@ A_INLINE void SkClassUnion::reference() const
 // Author(s):   Conan Reis
 A_INLINE void SkClassUnion::on_no_references()
   {
+  ms_intern_cache.flush();
   ms_shared_unions.free(*this);
   }
 
@@ -53,6 +53,12 @@ class SkClassBindingBase : public SkClassBindingAbstract<_BindingClass>, public
     template <typename... tParamClasses>
     static SkInstance * new_instance(const tParamClasses & ... args);
 
+    //---------------------------------------------------------------------------------------
+    // Like new_instance() but stores the value in temp_p instead if it is a temporary of this
+    // type only referenced by the current call - e.g. an argument that was the result of
+    // another expression - saving an allocation for chained operators
+    static SkInstance * new_instance_reuse(SkInstance * temp_p, const _DataType & value);
+
     //---------------------------------------------------------------------------------------
     // Initialize an existing instance of this SkookumScript type
     template <typename... tParamClasses>
@@ -105,6 +111,24 @@ inline SkInstance * SkClassBindingBase<_BindingClass, _DataType>::new_instance(c
   return instance_p;
   }
 
+//---------------------------------------------------------------------------------------
+// Note that routine arguments are passed in with their reference already counted so an
+// argument with a single reference is held solely by the invoked routine and may be
+// overwritten. The result gets its own reference so it outlives the routine.
+template<class _BindingClass, typename _DataType>
+inline SkInstance * SkClassBindingBase<_BindingClass, _DataType>::new_instance_reuse(SkInstance * temp_p, const _DataType & value)
+  {
+  if ((temp_p->get_references() == 1u) && (temp_p->get_class() == _BindingClass::get_class()))
+    {
+    temp_p->as<_BindingClass>() = value;
+    temp_p->reference();
+
+    return temp_p;
+    }
+
+  return new_instance(value);
+  }
+
 //---------------------------------------------------------------------------------------
 
 template<class _BindingClass, typename _DataType>
@@ -117,7 +141,8 @@ inline _DataType & SkClassBindingBase<_BindingClass, _DataType>::construct(const
     }
   else
     {
-    return *(*((_DataType **)&m_user_data) = AMemory::new_object<_DataType>("SkUserData", constructor_args...));
+    // Lands in the inline payload if this is a sized instance - see SkInstance32
+    return *new(allocate_raw(sizeof(_DataType))) _DataType(constructor_args...);
     }
   }
 
@@ -132,7 +157,8 @@ inline void SkClassBindingBase<_BindingClass, _DataType>::destruct()
     }
   else
     {
-    AMemory::delete_object(*((_DataType **)&m_user_data));
+    (*((_DataType **)&m_user_data))->~_DataType();
+    deallocate_raw(sizeof(_DataType));
     }
   }
 
@@ -217,6 +243,9 @@ void SkClassBindingBase<_BindingClass, _DataType>::register_bindings()
     ? static_cast<tSkRawPointerFunc>(&SkInstance::get_raw_pointer_val)
     : static_cast<tSkRawPointerFunc>(&SkInstance::get_raw_pointer_ref));
 
+  // Lets new instances of this class come from the pool whose inline payload fits _DataType
+  _BindingClass::get_class()->register_payload_size(sizeof(_DataType));
+
   // Bind basic methods
   static_assert(_BindingClass::Binding_has_ctor || sizeof(_DataType) <= sizeof(tUserData), "If _DataType does not fit inside m_user_data, it will be allocated from the heap, hence there must be a constructor to allocate the memory.");
   if (_BindingClass::Binding_has_ctor)
@@ -189,6 +189,7 @@ class SK_API SkClassDescBase
       // Class Methods
 
         static void enable_compound_refs(bool use_refs = true)    { ms_compounds_use_ref = use_refs; }
+        static bool is_compound_refs_enabled()                    { return ms_compounds_use_ref; }
 
   protected:
 
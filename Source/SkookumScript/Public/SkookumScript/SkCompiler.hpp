@@ -0,0 +1,184 @@
+// Copyright 1998-2019 Epic Games, Inc. All Rights Reserved.
+
+//=======================================================================================
+// SkookumScript C++ library.
+//
+// Headless compiler - builds a program from script sources without the IDE
+//=======================================================================================
+
+#pragma once
+
+//=======================================================================================
+// Includes
+//=======================================================================================
+
+#include <AgogCore/ADatum.hpp>
+#include <AgogCore/APSorted.hpp>
+#include <AgogCore/AString.hpp>
+#include <AgogCore/AVArray.hpp>
+#include <SkookumScript/SkParser.hpp>
+
+
+//=======================================================================================
+// Global Structures
+//=======================================================================================
+
+#if (SKOOKUM & SK_CODE_IN) && (SKOOKUM & SK_COMPILED_OUT)
+
+// Pre-declarations
+class SkClass;
+class SkInvokableBase;
+
+//---------------------------------------------------------------------------------------
+// Compiles script sources into the program held by SkBrain so that it can be written out
+// with SkBrain::as_binary() and friends - used by command line builds (CI servers, Linux
+// build machines, etc.) that do not run the SkookumIDE.
+//
+// The compiler knows nothing about files - the app gathers the overlays in order and
+// hands over class declarations and member sources:
+//   - declare_class()      - from class folder names `Class` or `Class.Super`
+//   - add_member_file()    - from loose member files `name().sk`, `!Data.sk`, etc.
+//   - add_class_archive()  - from `!Overlay.sk` and `Class.Super.sk` archives
+// A member supplied by a later overlay replaces the same member from an earlier one.
+//
+// compile() then runs these phases:
+//   1. creates the classes - superclasses first
+//   2. applies class meta info and appends data members
+//   3. preparses routine signatures so routine bodies can be type-checked
+//   4. parses routine bodies - or restores them from the cache
+//   5. merges the parsed routines into their classes
+// Phase 4 writes each routine into its own member slot rather than into its class so
+// phase 5 can merge them in member order and the output does not depend on which
+// routines came from the cache.
+//
+// Incremental builds: with the cache enabled each routine that parsed is kept in its
+// binary form keyed by a checksum of its source and of the program interface - class
+// hierarchy, class meta info, data members and routine signatures.  On the next compile
+// a routine whose key still matches is restored from its binary rather than parsed, so
+// editing a routine body only reparses that routine.  Changing the interface invalidates
+// every key.  The app persists the cache - see load_cache() and as_cache_binary().
+//
+// $Note - All phases run on the calling thread.  Parsing interns symbols, parameter lists
+// and class unions in shared tables (with non-atomic reference counts) and memoizes class
+// union merges - none of which are thread-safe.
+class SK_API SkCompiler
+  {
+  public:
+
+  // Nested Structures
+
+    //---------------------------------------------------------------------------------------
+    // Member source - also the result slot of its routine body parse.  Entries loaded from
+    // the cache are Members without a source.
+    struct Member
+      {
+      SK_NEW_OPERATORS(SkCompiler::Member);
+
+      Member(eSkMember type, const ASymbol & class_name, const ASymbol & name, bool class_member_b, const AString & source, const AString & origin, uint32_t row_offset);
+
+      bool operator==(const Member & member) const  { return (m_class_name == member.m_class_name) && (m_class_member_b == member.m_class_member_b) && (m_type == member.m_type) && (m_name == member.m_name); }
+      bool operator<(const Member & member) const;
+
+      eSkMember         m_type;
+      ASymbol           m_class_name;
+      ASymbol           m_name;           // Routine name - null for class meta and data
+      bool              m_class_member_b;
+      AString           m_source;
+      AString           m_origin;         // File path used in error messages
+      uint32_t          m_row_offset;     // Rows preceding m_source in the m_origin file
+
+      // Body parse results - see parse_routine()
+      SkInvokableBase * m_routine_p;
+      SkParser::eResult m_result;
+      uint32_t          m_result_pos;
+      bool              m_parsed_b;
+
+      // Cache key and the routine binary - 1 byte eSkInvokable + SkInvokableBase::as_binary()
+      // without the name.  Only set if the cache is enabled.
+      uint32_t          m_cache_key;
+      ADatum            m_binary;
+      };
+
+  // Common Methods
+
+    SK_NEW_OPERATORS(SkCompiler);
+
+    SkCompiler();
+    ~SkCompiler();
+
+  // Accessors
+
+    uint32_t        get_error_count() const     { return m_error_count; }
+    const AString & get_errors() const          { return m_errors; }
+    uint32_t        get_member_count() const    { return m_members.get_length(); }
+    uint32_t        get_cached_count() const    { return m_cached_count; }
+
+  // Methods
+
+    void declare_class(const ASymbol & class_name, const ASymbol & superclass_name);
+    bool add_member_file(const ASymbol & class_name, const AString & file_name, const AString & source, const AString & origin);
+    bool add_class_archive(const AString & source, const AString & origin, const ASymbol & class_name = ASymbol::get_null());
+    bool compile(const ASymbol & startup_class_name);
+
+  // Incremental Cache Methods
+
+    void     enable_cache(bool enable_b = true)  { m_cache_enabled_b = enable_b; }
+    bool     is_cache_enabled() const            { return m_cache_enabled_b; }
+    bool     load_cache(const void * binary_p, uint32_t length);
+    void     as_cache_binary(void ** binary_pp) const;
+    uint32_t as_cache_binary_length() const;
+
+  protected:
+
+  // Internal Structures
+
+    struct ClassDecl
+      {
+      ASymbol m_name;
+      ASymbol m_superclass_name;
+      };
+
+  // Internal Methods
+
+    void add_member(Member * member_p);
+    void append_error(const Member & member, SkParser::eResult result, uint32_t result_pos);
+    void append_error(const AString & origin, uint32_t row, const AString & message);
+
+    void declare_classes();
+    void parse_class_members();
+    void preparse_routines();
+    void parse_routines();
+    void merge_routines();
+    bool restore_routine(Member * member_p, const ADatum & binary);
+
+  // Internal Class Methods
+
+    static void     parse_routine(Member * member_p);
+    static uint32_t generate_member_crc(const Member & member, uint32_t prev_crc);
+
+  // Data Members
+
+    // Class declarations in the order that they were supplied
+    AVArray<ClassDecl> m_class_decls;
+
+    // Member sources sorted by class, scope and name - see Member::operator<()
+    APSortedLogicalFree<Member> m_members;
+
+    // Routines from the previous compile - see load_cache()
+    APSortedLogicalFree<Member> m_cache;
+
+    // Checksum of the class hierarchy, class meta info, data members and routine
+    // signatures - part of every routine cache key
+    uint32_t m_interface_crc;
+
+    // Number of routines restored from m_cache by the last compile()
+    uint32_t m_cached_count;
+
+    bool     m_cache_enabled_b;
+
+    AString  m_errors;
+    uint32_t m_error_count;
+
+  };  // SkCompiler
+
+#endif  // (SKOOKUM & SK_CODE_IN) && (SKOOKUM & SK_COMPILED_OUT)
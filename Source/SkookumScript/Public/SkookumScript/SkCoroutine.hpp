@@ -68,6 +68,7 @@ class SK_API SkCoroutineBase : public SkInvokableBase
 class SK_API SkCoroutine : public SkCoroutineBase
   {
   friend class SkParser;
+  friend class SkOptimizer;
 
   public:
 	  SK_NEW_OPERATORS(SkCoroutine);
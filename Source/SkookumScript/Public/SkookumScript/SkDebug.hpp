@@ -148,10 +148,13 @@
 // debug action (like a breakpoint) - see SkDebug::hook_expression(),
 // Needed for stepwise debugging so defined even when just `SK_DEBUG` is set and
 // `SKDEBUG_HOOKS` is not defined.
+// With `SK_DEBUG` only the expression's own debug flag is tested - it is patched onto every
+// expression while stepping or an expression hook is active (see
+// SkDebug::patch_expressions()) and is otherwise only set on expressions with breakpoints.
 #if (SKOOKUM & SK_DEBUG)
   
     #define SKDEBUG_HOOK_EXPR(_expr_p, _scope_p, _caller_p, _caller_caller_p, _hook_context) \
-      if (SkDebug::ms_expr_hook_flag | ((_expr_p)->m_debug_info & SkDebugInfo::Flag_debug_enabled)) \
+      if ((_expr_p)->m_debug_info & SkDebugInfo::Flag_debug_enabled) \
         { SkDebug::hook_expression((SkExpressionBase *)(_expr_p), (_scope_p), (_caller_p), (_caller_caller_p), (_hook_context)); } \
       (void(0))
 
@@ -1054,6 +1057,8 @@ class SK_API SkDebug
         static void set_next_expression(SkObjectBase * scope_p, SkInvokedBase * caller_p, SkExpressionBase * expr_p);
         static void set_preferences(uint32_t pref_flags) { ms_pref_flags = pref_flags; }
         static void step(eStep step_type);
+        static bool is_expr_patched() { return ms_expr_patched; }
+        static void patch_expressions(bool patch);
       #endif  // (SKOOKUM & SK_DEBUG)
 
     // Breakpoints
@@ -1200,6 +1205,10 @@ class SK_API SkDebug
       // Breakpoints sorted by member expression info
       static APSortedLogicalFree<SkBreakPoint, SkMemberExpression> ms_breakpoints;
 
+      // Set while every expression has SkDebugInfo::Flag_debug_enabled patched on so that
+      // stepping/expression hooks get called - see patch_expressions()
+      static bool ms_expr_patched;
+
     #endif  // (SKOOKUM & SK_DEBUG)
 
       static void (* ms_scripted_break_f)(const AString & message, SkInvokedMethod * scope_p);
@@ -1269,6 +1278,14 @@ inline void SkDebug::set_flag(
   ms_expr_hook_flag = ((ms_flags & Flag__test_expression_mask) != 0u)
     ? SkDebugInfo::Flag_debug_enabled
     : SkDebugInfo::Flag_debug_disabled;
+
+  #if (SKOOKUM & SK_DEBUG)
+    // Expressions only test their own debug flag so patch it on/off as needed
+    if (ms_expr_patched != (ms_expr_hook_flag == SkDebugInfo::Flag_debug_enabled))
+      {
+      patch_expressions(!ms_expr_patched);
+      }
+  #endif
   }
 
 #endif // SKDEBUG_COMMON
@@ -110,6 +110,7 @@ class SkInvokedExpression;
 class SkParser;
 class SkClassDescBase;
 class SkClass;
+class SkOptimizer;
 
 
 //---------------------------------------------------------------------------------------
@@ -219,6 +220,7 @@ class SK_API SkExpressionBase
     SkInstance *            invoke_now(SkObjectBase * scope_p, SkInvokedBase * caller_p = nullptr) const;
     void                    invoke_now_proc(SkObjectBase * scope_p, SkInvokedBase * caller_p = nullptr) const;
     virtual void            null_receiver(SkExpressionBase * receiver_p);
+    virtual SkExpressionBase * optimize(const SkOptimizer & optimizer);
     virtual void            track_memory(AMemoryStats * mem_stats_p) const = 0;
 
     // Type-checking Methods
@@ -317,6 +319,7 @@ class SkLoop : public SkExpressionBase
     virtual eSkExprType     get_type() const override;
     virtual SkInvokedBase * invoke(SkObjectBase * scope_p, SkInvokedBase * caller_p = nullptr, SkInstance ** result_pp = nullptr) const override;
     virtual bool            is_immediate(uint32_t * durational_idx_p = nullptr) const override;
+    virtual SkExpressionBase * optimize(const SkOptimizer & optimizer) override;
     virtual void            track_memory(AMemoryStats * mem_stats_p) const override;
 
     // Called by SkInvokedExpression
@@ -454,6 +457,7 @@ class SkConversion : public SkExpressionBase
       virtual eSkExprType     get_type() const override;
       virtual SkInvokedBase * invoke(SkObjectBase * scope_p, SkInvokedBase * caller_p = nullptr, SkInstance ** result_pp = nullptr) const override;
       virtual void            null_receiver(SkExpressionBase * receiver_p) override;
+      virtual SkExpressionBase * optimize(const SkOptimizer & optimizer) override;
       virtual void            track_memory(AMemoryStats * mem_stats_p) const override;
 
       // Debugging Methods
@@ -524,6 +528,7 @@ class SkCast : public SkExpressionBase
       virtual eSkExprType     get_type() const override;
       virtual SkInvokedBase * invoke(SkObjectBase * scope_p, SkInvokedBase * caller_p = nullptr, SkInstance ** result_pp = nullptr) const override;
       virtual void            null_receiver(SkExpressionBase * receiver_p) override;
+      virtual SkExpressionBase * optimize(const SkOptimizer & optimizer) override;
       virtual void            track_memory(AMemoryStats * mem_stats_p) const override;
 
       // Debugging Methods
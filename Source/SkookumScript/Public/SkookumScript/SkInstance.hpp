@@ -87,7 +87,7 @@ enum eSkNotifyChild
 //---------------------------------------------------------------------------------------
 // SkookumScript user/reusable instance object / class instance - simplest object without
 // any data members and with reference counting and user data
-// 
+//
 // Subclasses: SkBoolean, SkClosure, SkDataInstance(SkActor), SkInstanceUnreffed(SkMetaClass)
 // Author(s):  Conan Reis
 class SK_API SkInstance : public SkObjectBase, public ARefCountMix<SkInstance>
@@ -408,6 +408,7 @@ class SK_API SkInstance : public SkObjectBase, public ARefCountMix<SkInstance>
     template<typename _UserType>
     static SkInstance * new_instance(SkClass * class_p, const _UserType & user_data);
     static SkInstance * new_instance(SkClass * class_p);
+    static SkInstance * new_instance_sized(SkClass * class_p, uint32_t byte_size);
     static SkInstance * new_instance(SkClass * class_p, const void * user_data_p, uint32_t byte_size);
     static SkInstance * new_instance_val(SkClass * class_p, const void * user_data_p, uint32_t byte_size);
     static SkInstance * new_instance_ref(SkClass * class_p, const void * user_data_p, uint32_t byte_size);
@@ -429,8 +430,12 @@ class SK_API SkInstance : public SkObjectBase, public ARefCountMix<SkInstance>
 
     //---------------------------------------------------------------------------------------
     // Allocate/deallocate memory for internal data
-    void * allocate_raw(uint32_t byte_size)   { return byte_size <= sizeof(m_user_data) ? &m_user_data : (*((void **)&m_user_data) = AgogCore::get_app_info()->malloc(byte_size, "SkUserData")); }
-    void   deallocate_raw(uint32_t byte_size) { if (byte_size > sizeof(m_user_data)) { AgogCore::get_app_info()->free(*((void **)&m_user_data)); }}
+    void * allocate_raw(uint32_t byte_size);
+    void   deallocate_raw(uint32_t byte_size);
+
+    // Returns inline storage that can hold byte_size bytes of user data too large for
+    // m_user_data or nullptr if the data must be allocated from the heap.
+    virtual void * get_payload_embedded(uint32_t byte_size) { return nullptr; }
 
   protected:
 
@@ -509,10 +514,178 @@ class SK_API SkInstanceUnreffed : public SkInstance
   };
 
 
+//---------------------------------------------------------------------------------------
+// Notes      SkookumScript instance object with an inline payload large enough to hold
+//            common engine value types (vectors, rotators, transforms, colors etc.)
+//            that do not fit in m_user_data - so they need no separate heap allocation.
+//            m_user_data still points to the data so the by reference accessors such as
+//            get_raw_pointer_ref() work unchanged.
+//            
+//            Each size class has its own reuse pool. Use SkInstance::new_instance_sized()
+//            or SkClass::new_instance() to get the instance that fits a given data size.
+// See Also   SkInstance64
+class SK_API SkInstance32 : public SkInstance
+  {
+  public:
+
+  // Public Class Data
+
+    enum { Payload_size = 32 };
+
+  // Methods
+
+    SK_NEW_OPERATORS(SkInstance32);
+
+    // Overriding from SkInstance
+
+    virtual void   delete_this() override;
+    virtual void * get_payload_embedded(uint32_t byte_size) override  { return (byte_size <= Payload_size) ? m_payload : nullptr; }
+
+  // Pool Allocation Methods
+
+    static SkInstance32 * new_instance(SkClass * class_p);
+    static AObjReusePool<SkInstance32> & get_pool();
+
+  protected:
+
+    friend class AObjReusePool<SkInstance32>;
+
+  // Internal Methods
+
+    // Default constructor only may be called by the pool
+    SkInstance32() {}
+
+    SkInstance32 ** get_pool_unused_next() { return (SkInstance32 **)&m_user_data.m_data.m_uintptr; } // Area in this class where to store the pointer to the next unused object when not in use
+
+  // Data Members
+
+    alignas(16) uint8_t m_payload[Payload_size];
+
+    // The global pool of SkInstance32 objects
+    static AObjReusePool<SkInstance32> ms_pool;
+
+  };  // SkInstance32
+
+
+//---------------------------------------------------------------------------------------
+// Notes      SkookumScript instance object with a 64 byte inline payload - see SkInstance32
+// See Also   SkInstance32
+class SK_API SkInstance64 : public SkInstance
+  {
+  public:
+
+  // Public Class Data
+
+    enum { Payload_size = 64 };
+
+  // Methods
+
+    SK_NEW_OPERATORS(SkInstance64);
+
+    // Overriding from SkInstance
+
+    virtual void   delete_this() override;
+    virtual void * get_payload_embedded(uint32_t byte_size) override  { return (byte_size <= Payload_size) ? m_payload : nullptr; }
+
+  // Pool Allocation Methods
+
+    static SkInstance64 * new_instance(SkClass * class_p);
+    static AObjReusePool<SkInstance64> & get_pool();
+
+  protected:
+
+    friend class AObjReusePool<SkInstance64>;
+
+  // Internal Methods
+
+    // Default constructor only may be called by the pool
+    SkInstance64() {}
+
+    SkInstance64 ** get_pool_unused_next() { return (SkInstance64 **)&m_user_data.m_data.m_uintptr; } // Area in this class where to store the pointer to the next unused object when not in use
+
+  // Data Members
+
+    alignas(16) uint8_t m_payload[Payload_size];
+
+    // The global pool of SkInstance64 objects
+    static AObjReusePool<SkInstance64> ms_pool;
+
+  };  // SkInstance64
+
+
+//---------------------------------------------------------------------------------------
+// Holds on to a single instance so it can be handed out again once every other holder
+// has let go of it - saving a pool allocation for values that are created over and over
+// such as literals and Boolean results.
+//
+// The cached instance is only ever handed out while nothing else references it so a
+// value is never shared - in-place mutators (increment, add_assign, assign, etc.) act on
+// it exactly as on a freshly allocated instance.
+class SK_API SkInstanceCache
+  {
+  public:
+
+  // Methods
+
+    SkInstanceCache() : m_instance_p(nullptr), m_destruct_f(nullptr) {}
+    SkInstanceCache(const SkInstanceCache &) : m_instance_p(nullptr), m_destruct_f(nullptr) {}
+    ~SkInstanceCache()                                            { release(); }
+
+    SkInstanceCache & operator=(const SkInstanceCache &)          { release(); return *this; }
+
+    template<class _BindingClass>
+      SkInstance * new_instance(const typename _BindingClass::tDataType & value);
+
+    void release();
+
+  protected:
+
+  // Data Members
+
+    // Cached instance - holds one reference of its own
+    SkInstance * m_instance_p;
+
+    // Destructs the C++ data of the cached instance - see release()
+    void (* m_destruct_f)(SkInstance * instance_p);
+
+  };  // SkInstanceCache
+
+
 //=======================================================================================
 // Inline Methods
 //=======================================================================================
 
+//---------------------------------------------------------------------------------------
+// Returns a new instance of _BindingClass set to value - the cached instance if nobody
+// else is using it.  The result has a reference for the caller just like
+// _BindingClass::new_instance().
+template<class _BindingClass>
+inline SkInstance * SkInstanceCache::new_instance(const typename _BindingClass::tDataType & value)
+  {
+  SkInstance * instance_p = m_instance_p;
+
+  if (instance_p && (instance_p->get_references() == 1u))
+    {
+    // Anything that kept the id of its previous use must not see it as still alive
+    instance_p->renew_id();
+    instance_p->reference();
+    instance_p->as<_BindingClass>() = value;
+
+    return instance_p;
+    }
+
+  instance_p = _BindingClass::tBindingBase::new_instance(value);
+
+  if (m_instance_p == nullptr)
+    {
+    instance_p->reference();
+    m_instance_p = instance_p;
+    m_destruct_f = [](SkInstance * cached_p) { cached_p->destruct<_BindingClass>(); };
+    }
+
+  return instance_p;
+  }
+
 //---------------------------------------------------------------------------------------
 // Retrieves an instance object from the dynamic pool and initializes it for use.
 // This method should be used instead of 'new' because it prevents unnecessary
@@ -542,6 +715,20 @@ A_FORCEINLINE AObjReusePool<SkInstance> & SkInstance::get_pool()
   return ms_pool;
   }
 
+//---------------------------------------------------------------------------------------
+// Get the global pool of SkInstance32 objects
+A_FORCEINLINE AObjReusePool<SkInstance32> & SkInstance32::get_pool()
+  {
+  return ms_pool;
+  }
+
+//---------------------------------------------------------------------------------------
+// Get the global pool of SkInstance64 objects
+A_FORCEINLINE AObjReusePool<SkInstance64> & SkInstance64::get_pool()
+  {
+  return ms_pool;
+  }
+
 #endif
 
 #ifndef A_INL_IN_CPP
@@ -193,18 +193,34 @@ A_INLINE SkInstance * SkInstance::new_instance(SkClass * class_p)
   }
 
 //---------------------------------------------------------------------------------------
-// Allocate (from pool) and construct a new SkInstance of given type 
-// (stored either by value or reference depending on byte size)
-A_INLINE SkInstance * SkInstance::new_instance_uninitialized(SkClass * class_p, uint32_t byte_size, void ** user_data_pp)
+// Retrieves an instance object from the pool whose inline storage best fits user data of
+// the given byte size - data larger than the largest payload is allocated from the heap.
+// Modifiers:   static
+A_INLINE SkInstance * SkInstance::new_instance_sized(SkClass * class_p, uint32_t byte_size)
   {
-  SkInstance * instance_p = new_instance(class_p);
-  void * user_data_p = &instance_p->m_user_data;
   if (byte_size > sizeof(tUserData))
     {
-    user_data_p = AgogCore::get_app_info()->malloc(byte_size, "SkUserData");
-    *((void **)&instance_p->m_user_data) = user_data_p;
+    if (byte_size <= SkInstance32::Payload_size)
+      {
+      return SkInstance32::new_instance(class_p);
+      }
+
+    if (byte_size <= SkInstance64::Payload_size)
+      {
+      return SkInstance64::new_instance(class_p);
+      }
     }
-  *user_data_pp = user_data_p;
+
+  return new_instance(class_p);
+  }
+
+//---------------------------------------------------------------------------------------
+// Allocate (from pool) and construct a new SkInstance of given type 
+// (stored either by value or reference depending on byte size)
+A_INLINE SkInstance * SkInstance::new_instance_uninitialized(SkClass * class_p, uint32_t byte_size, void ** user_data_pp)
+  {
+  SkInstance * instance_p = new_instance_sized(class_p, byte_size);
+  *user_data_pp = instance_p->allocate_raw(byte_size);
   return instance_p;
   }
 
@@ -223,10 +239,8 @@ A_INLINE SkInstance * SkInstance::new_instance_uninitialized_val(SkClass * class
 A_INLINE SkInstance * SkInstance::new_instance_uninitialized_ref(SkClass * class_p, uint32_t byte_size, void ** user_data_pp)
   {
   SK_ASSERTX(byte_size > sizeof(tUserData), "Use new_instance_val instead!");
-  SkInstance * instance_p = new_instance(class_p);
-  void * user_data_p = AgogCore::get_app_info()->malloc(byte_size, "SkUserData");
-  *((void **)&instance_p->m_user_data) = user_data_p;
-  *user_data_pp = user_data_p;
+  SkInstance * instance_p = new_instance_sized(class_p, byte_size);
+  *user_data_pp = instance_p->allocate_raw(byte_size);
   return instance_p;
   }
 
@@ -261,6 +275,80 @@ A_INLINE SkInstance * SkInstance::new_instance_ref(SkClass * class_p, const void
   return instance_p;
   }
 
+//---------------------------------------------------------------------------------------
+// Allocate memory for user data - stored inline if it fits in m_user_data, otherwise in
+// the inline payload of a sized instance or from the heap and stored by reference.
+// Returns:    address of the (uninitialized) user data
+A_INLINE void * SkInstance::allocate_raw(uint32_t byte_size)
+  {
+  if (byte_size <= sizeof(m_user_data))
+    {
+    return &m_user_data;
+    }
+
+  void * data_p = get_payload_embedded(byte_size);
+
+  if (!data_p)
+    {
+    data_p = AgogCore::get_app_info()->malloc(byte_size, "SkUserData");
+    }
+
+  *((void **)&m_user_data) = data_p;
+
+  return data_p;
+  }
+
+//---------------------------------------------------------------------------------------
+// Free memory for user data allocated with allocate_raw()
+A_INLINE void SkInstance::deallocate_raw(uint32_t byte_size)
+  {
+  if (byte_size > sizeof(m_user_data))
+    {
+    void * data_p = *((void **)&m_user_data);
+
+    if (data_p != get_payload_embedded(byte_size))
+      {
+      AgogCore::get_app_info()->free(data_p);
+      }
+    }
+  }
+
+
+//=======================================================================================
+// SkInstance32 / SkInstance64 Inline Methods
+//=======================================================================================
+
+//---------------------------------------------------------------------------------------
+// Retrieves an instance object with a 32 byte payload from its pool and initializes it
+// for use.
+// Modifiers:   static
+A_INLINE SkInstance32 * SkInstance32::new_instance(SkClass * class_p)
+  {
+  SkInstance32 * instance_p = get_pool().allocate();
+
+  instance_p->m_class_p   = class_p;
+  instance_p->m_ref_count = 1u;
+  instance_p->m_ptr_id    = ++ms_ptr_id_prev;
+
+  return instance_p;
+  }
+
+//---------------------------------------------------------------------------------------
+// Retrieves an instance object with a 64 byte payload from its pool and initializes it
+// for use.
+// Modifiers:   static
+A_INLINE SkInstance64 * SkInstance64::new_instance(SkClass * class_p)
+  {
+  SkInstance64 * instance_p = get_pool().allocate();
+
+  instance_p->m_class_p   = class_p;
+  instance_p->m_ref_count = 1u;
+  instance_p->m_ptr_id    = ++ms_ptr_id_prev;
+
+  return instance_p;
+  }
+
+
 //=======================================================================================
 // SkInstanceUnreffed Inline Methods
 //=======================================================================================
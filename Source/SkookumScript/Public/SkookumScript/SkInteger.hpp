@@ -20,9 +20,21 @@ class SK_API SkInteger : public SkClassBindingSimpleZero<SkInteger, tSkInteger>
   {
   public:
 
+    // Range of values with reused instances - see new_instance()
+    enum
+      {
+      Cached_min = -16,
+      Cached_max = 255
+      };
+
     static void       register_bindings();
     static SkClass *  get_class();
 
+    // Small integer results are created constantly so instances for them are reused
+    using tBindingBase::new_instance;
+    static SkInstance * new_instance(tSkInteger value);
+    static void         release_cached_instances();
+
   };
 
 
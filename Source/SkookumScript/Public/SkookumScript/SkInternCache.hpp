@@ -0,0 +1,75 @@
+// Copyright 1998-2019 Epic Games, Inc. All Rights Reserved.
+
+//=======================================================================================
+// SkookumScript C++ library.
+//
+// Hashed look-up of shared (interned) compound class descriptors
+//=======================================================================================
+
+#pragma once
+
+//=======================================================================================
+// Includes
+//=======================================================================================
+
+#include <SkookumScript/Sk.hpp>
+
+
+//=======================================================================================
+// Global Structures
+//=======================================================================================
+
+//---------------------------------------------------------------------------------------
+// Direct mapped cache in front of a sorted shared descriptor list (such as
+// SkClassUnion::ms_shared_unions) so that get_or_create() usually finds the shared
+// descriptor with a hash and a single compare rather than a binary search.
+//
+// The shared lists stay the owners and the canonical order (binary references are
+// indexes into them) - a cache slot only remembers a pointer so it must be flushed
+// whenever the list frees descriptors.  A slot collision just replaces the older entry.
+//
+// _DescType needs compare() and generate_crc32().
+template<class _DescType, uint32_t _SlotCount = 256u>
+class SkInternCache
+  {
+  public:
+
+  // Common Methods
+
+    SkInternCache()  { flush(); }
+
+  // Methods
+
+    //---------------------------------------------------------------------------------------
+    // Returns shared descriptor equal to `desc` (with hash `crc`) or nullptr if not cached
+    _DescType * find(const _DescType & desc, uint32_t crc) const
+      {
+      _DescType * desc_p = m_slots[crc & (_SlotCount - 1u)];
+
+      return (desc_p && ((desc_p == &desc) || (desc_p->compare(desc) == AEquate_equal)))
+        ? desc_p
+        : nullptr;
+      }
+
+    //---------------------------------------------------------------------------------------
+    // Remembers shared descriptor `desc_p` with hash `crc`
+    void store(_DescType * desc_p, uint32_t crc)
+      {
+      m_slots[crc & (_SlotCount - 1u)] = desc_p;
+      }
+
+    //---------------------------------------------------------------------------------------
+    void flush()
+      {
+      ::memset(m_slots, 0, sizeof(m_slots));
+      }
+
+  protected:
+
+    static_assert((_SlotCount & (_SlotCount - 1u)) == 0u, "Slot count must be a power of 2.");
+
+  // Data Members
+
+    _DescType * m_slots[_SlotCount];
+
+  };  // SkInternCache
@@ -34,6 +34,7 @@ class SK_API SkInvokeBase : public SkQualifier
 
   {
   friend class SkParser;
+  friend class SkOptimizer;
 
   public:
 	  SK_NEW_OPERATORS(SkInvokeBase);
@@ -168,6 +169,7 @@ class SK_API SkInvocation : public SkExpressionBase
     virtual bool            is_immediate(uint32_t * durational_idx_p = nullptr) const override;
     virtual bool            is_debug_call() const override;
     virtual void            null_receiver(SkExpressionBase * receiver_p) override;
+    virtual SkExpressionBase * optimize(const SkOptimizer & optimizer) override;
     virtual void            track_memory(AMemoryStats * mem_stats_p) const override;
 
   // Debugging Methods
@@ -360,6 +362,7 @@ class SK_API SkInvokeCascade : public SkExpressionBase
     virtual SkInvokedBase * invoke(SkObjectBase * scope_p, SkInvokedBase * caller_p = nullptr, SkInstance ** result_pp = nullptr) const override;
     virtual bool            is_immediate(uint32_t * durational_idx_p = nullptr) const override;
     virtual void            null_receiver(SkExpressionBase * receiver_p) override;
+    virtual SkExpressionBase * optimize(const SkOptimizer & optimizer) override;
     virtual void            track_memory(AMemoryStats * mem_stats_p) const override;
 
     // Called by SkInvokedExpression
@@ -441,6 +444,7 @@ class SK_API SkInstantiate : public SkExpressionBase
       virtual eSkExprType     get_type() const override;
       virtual SkInvokedBase * invoke(SkObjectBase * scope_p, SkInvokedBase * caller_p = nullptr, SkInstance ** result_pp = nullptr) const override;
       virtual void            null_receiver(SkExpressionBase * receiver_p) override;
+      virtual SkExpressionBase * optimize(const SkOptimizer & optimizer) override;
       virtual void            track_memory(AMemoryStats * mem_stats_p) const override;
 
     // Debugging Methods
@@ -514,6 +518,7 @@ class SK_API SkCopyInvoke : public SkExpressionBase
     virtual eSkExprType     get_type() const override;
     virtual SkInvokedBase * invoke(SkObjectBase * scope_p, SkInvokedBase * caller_p = nullptr, SkInstance ** result_pp = nullptr) const override;
     virtual void            null_receiver(SkExpressionBase * receiver_p) override;
+    virtual SkExpressionBase * optimize(const SkOptimizer & optimizer) override;
     virtual void            track_memory(AMemoryStats * mem_stats_p) const override;
 
     // Debugging Methods
@@ -270,6 +270,7 @@ class SK_API SkLiteralClosure : public SkExpressionBase
     SkClosureInfoBase *     get_closure_info() const  { return m_info_p; }
     virtual eSkExprType     get_type() const override          { return m_info_p->is_method() ? SkExprType_closure_method : SkExprType_closure_coroutine; }
     virtual SkInvokedBase * invoke(SkObjectBase * scope_p, SkInvokedBase * caller_p = nullptr, SkInstance ** result_pp = nullptr) const override;
+    virtual SkExpressionBase * optimize(const SkOptimizer & optimizer) override;
     virtual void            track_memory(AMemoryStats * mem_stats_p) const override;
 
   protected:
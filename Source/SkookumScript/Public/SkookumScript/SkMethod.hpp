@@ -65,6 +65,7 @@ class SK_API SkMethodBase : public SkInvokableBase
 class SK_API SkMethod : public SkMethodBase
   {
   friend class SkParser;
+  friend class SkOptimizer;
 
   public:
   // Common Methods
@@ -0,0 +1,128 @@
+// Copyright 1998-2019 Epic Games, Inc. All Rights Reserved.
+
+//=======================================================================================
+// SkookumScript C++ library.
+//
+// Optimization pass over loaded expression trees
+//=======================================================================================
+
+#pragma once
+
+//=======================================================================================
+// Includes
+//=======================================================================================
+
+#include <SkookumScript/SkExpressionBase.hpp>
+
+
+//=======================================================================================
+// Global Macros / Defines
+//=======================================================================================
+
+// Define to have the optimizer off by default - handy when stepping through scripts since
+// folded / pruned expressions cannot be stopped on.  It can also be changed at runtime
+// with SkOptimizer::set_flags() prior to the program being initialized.
+//#define SK_OPTIMIZER_DISABLE
+
+
+//=======================================================================================
+// Global Structures
+//=======================================================================================
+
+// Pre-declarations
+class SkClass;
+class SkInvokableBase;
+class SkInvokeBase;
+class SkLiteral;
+
+//---------------------------------------------------------------------------------------
+// Rewrites the expression trees of script routines once the program is loaded and its
+// bindings are registered:
+//   - folds calls on literals to built-in arithmetic/comparison/logic methods
+//     `2 * 3` -> `6`, `1 < 2` -> `true`, `false and test?` -> `false`
+//   - prunes `if`/`case`/`when`/`unless` clauses that a literal test rules out
+//   - inlines calls to trivial accessors - methods without parameters whose body is just
+//     a literal or a data member - `get_x` -> `@x`
+//
+// Each expression type rewrites itself via SkExpressionBase::optimize() - this supplies
+// the context and the shared helpers.
+//
+// Debug info: expressions built by the optimizer take the source index (and debug info)
+// of the expression they replace so breakpoints set on a rewritten statement still land.
+// Sub-expressions that survive a rewrite keep their own source index.
+//
+// See: SkExpressionBase::optimize(), SkBrain::initialize_post_load()
+class SK_API SkOptimizer
+  {
+  public:
+
+  // Nested Structures
+
+    enum eFlag
+      {
+      Flag_fold_constants   = 1 << 0,  // Fold calls on literals - 2 * 3 -> 6
+      Flag_prune_branches   = 1 << 1,  // Drop clauses ruled out by literal tests
+      Flag_inline_accessors = 1 << 2,  // Inline trivial accessor methods
+
+      Flag__none = 0,
+      Flag__all  = Flag_fold_constants | Flag_prune_branches | Flag_inline_accessors,
+
+      #if defined(SK_OPTIMIZER_DISABLE)
+        Flag__default = Flag__none
+      #elif (SKOOKUM & SK_DEBUG)
+        // An inlined accessor would go stale if the accessor is live updated by the IDE
+        Flag__default = Flag_fold_constants | Flag_prune_branches
+      #else
+        Flag__default = Flag__all
+      #endif
+      };
+
+  // Common Methods
+
+    explicit SkOptimizer(SkClass * this_class_p = nullptr) : m_this_class_p(this_class_p) {}
+
+  // Methods
+
+    bool      is_flag_set(eFlag flag) const      { return (ms_flags & flag) != 0u; }
+    SkClass * get_this_class() const             { return m_this_class_p; }
+
+    void               optimize(SkExpressionBase ** expr_pp) const;
+    void               optimize_array(SkExpressionBase ** exprs_pp, uint32_t count) const;
+    void               optimize_call_args(SkInvokeBase * call_p) const;
+    SkExpressionBase * optimize_call(SkExpressionBase * receiver_p, SkInvokeBase * call_p) const;
+
+  // Class Methods
+
+    static uint32_t get_flags()                  { return ms_flags; }
+    static void     set_flags(uint32_t flags)    { ms_flags = flags; }
+
+    static bool     is_literal_boolean(const SkExpressionBase * expr_p, bool * value_p);
+    static bool     is_literal_equal(const SkExpressionBase * lhs_p, const SkExpressionBase * rhs_p, bool * equal_p);
+    static void     optimize_routine(SkInvokableBase * routine_p, SkClass * this_class_p);
+    static void     optimize_class(SkClass * class_p);
+    static void     optimize_class_recurse(SkClass * class_p);
+
+  protected:
+
+  // Internal Methods
+
+    SkExpressionBase * fold_call(const SkLiteral & receiver, SkInvokeBase * call_p) const;
+    SkExpressionBase * inline_call(SkInvokeBase * call_p) const;
+
+  // Internal Class Methods
+
+    static bool is_overridden(const SkClass & cls, const ASymbol & method_name);
+
+  // Data Members
+
+    // Class that `this` is known to be an instance of (or of a subclass of) in the
+    // expressions being optimized - nullptr if `this` is not an instance of a known class
+    // such as in class methods and closures.
+    SkClass * m_this_class_p;
+
+  // Class Data Members
+
+    // See eFlag
+    static uint32_t ms_flags;
+
+  };  // SkOptimizer
@@ -890,6 +890,11 @@ class SK_API SkParser : public AString
     static AString              get_result_context_string(const AString & code, eResult result, uint32_t result_pos, uint32_t result_start = ADef_uint32, uint32_t start_pos = 0u);
     static AString              get_result_string(eResult result);
     static eResult              invoke_script(const AString & code, AString * result_str_p = nullptr, SkInstance ** result_pp = nullptr, SkInstance * instance_p = nullptr, bool print_info = true);
+    static void                 invoke_cache_flush();
+
+    #if (SKOOKUM & SK_DEBUG)
+      static eAIterateResult    invoke_cache_iterate_expressions(SkApplyExpressionBase * apply_expr_p);
+    #endif
 
   #endif // (SKOOKUM & SK_CODE_IN)
 
@@ -1049,6 +1054,8 @@ class SK_API SkParser : public AString
 
       ASymbol as_symbol(                uint32_t start_pos, uint32_t end_pos) const;
       bool    is_constructor(           uint32_t start_pos = 0u) const;
+      uint32_t find_identifier_end(     uint32_t start_pos) const;
+      uint32_t find_ws_end(             uint32_t start_pos, bool treat_lf_as_ws = true) const;
       eResult parse_digits_lead(        uint32_t start_pos, uint32_t * end_pos_p, tSkInteger * int_p) const;
       void    parse_name_symbol(        uint32_t start_pos, uint32_t * end_pos_p, ASymbol * name_p = nullptr) const;
       eResult parse_name_predicate(     uint32_t start_pos, uint32_t * end_pos_p, ASymbol * name_p = nullptr, bool * predicate_p = nullptr, bool test_resevered = true) const;
@@ -13,6 +13,7 @@
 
 #include <AgogCore/AStringRef.hpp>
 #include <AgogCore/ASymbolTable.hpp>
+#include <SkookumScript/SkScanner.hpp>
 
 
 #if (SKOOKUM & SK_CODE_IN)
@@ -275,6 +276,36 @@ A_INLINE bool SkParser::is_constructor(
     && (cstr_a[ctor_end] == '('));
   }
 
+//---------------------------------------------------------------------------------------
+// Returns position of the first character at or after start_pos that is not A-Z, a-z,
+// 0-9 or _ - or the length of the parse string if there is none.
+A_INLINE uint32_t SkParser::find_identifier_end(uint32_t start_pos) const
+  {
+  const char * cstr_a = m_str_ref_p->m_cstr_p;
+  uint32_t     length = m_str_ref_p->m_length;
+
+  return (start_pos < length)
+    ? uint32_t(SkScanner::skip_identifier(cstr_a + start_pos, cstr_a + length) - cstr_a)
+    : length;
+  }
+
+//---------------------------------------------------------------------------------------
+// Returns position of the first character at or after start_pos that is not white space
+// - or the length of the parse string if there is none.  Comments are not skipped - see
+// parse_ws_any().
+A_INLINE uint32_t SkParser::find_ws_end(
+  uint32_t start_pos,
+  bool     treat_lf_as_ws // = true
+  ) const
+  {
+  const char * cstr_a = m_str_ref_p->m_cstr_p;
+  uint32_t     length = m_str_ref_p->m_length;
+
+  return (start_pos < length)
+    ? uint32_t(SkScanner::skip_white_space(cstr_a + start_pos, cstr_a + length, treat_lf_as_ws) - cstr_a)
+    : length;
+  }
+
 
 #endif // (SKOOKUM & SK_CODE_IN)
 
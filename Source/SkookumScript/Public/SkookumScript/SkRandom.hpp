@@ -22,6 +22,7 @@ class SK_API SkRandom : public SkClassBindingSimple<SkRandom, ARandom>
   {
   public:
 
+    enum { Binding_has_ctor = false }; // Own constructor so seeds can be recorded/replayed - see SkReplay
     enum { Binding_has_dtor = false }; // If to generate destructor
 
     static void       register_bindings();
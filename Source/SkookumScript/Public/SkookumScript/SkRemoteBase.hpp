@@ -13,7 +13,9 @@
 //=======================================================================================
 
 #include <SkookumScript/Sk.hpp>
+#include <AgogCore/ADatum.hpp>
 #include <AgogCore/AString.hpp>
+#include <AgogCore/AVCompactArray.hpp>
 
 
 //=======================================================================================
@@ -66,11 +68,17 @@ enum eSkLocale
 enum eSkRemoteFlag
   {
   SkRemoteFlag_none        = 0x0, 
-  SkRemoteFlag_symbol_db   = 1 << 0  // Remote side has a symbol database (Symbols need to be updated, less or no symbol id translation required)
+  SkRemoteFlag_symbol_db   = 1 << 0, // Remote side has a symbol database (Symbols need to be updated, less or no symbol id translation required)
+  SkRemoteFlag_compression = 1 << 1  // Remote side accepts Command_compressed_chunk
   };
 
 const uint32_t SkRemote_version_byte_size       = 9u;   // command(4) + version(1) + authorization(4)
 const uint32_t SkRemote_version_reply_byte_size = 13u;  // command(4) + version(1) + authorization(4) + client_flags(4)
+const uint32_t SkRemote_version_flags_byte_size = 13u;  // command(4) + version(1) + authorization(4) + ide_flags(4) - newer IDEs append their flags
+
+const uint32_t SkRemote_compress_length_min     = 512u;    // Smaller commands are sent as-is
+const uint32_t SkRemote_chunk_length            = 32768u;  // Uncompressed bytes per Command_compressed_chunk
+const uint32_t SkRemote_chunk_header_byte_size  = 16u;     // command(4) + total_length(4) + offset(4) + chunk_length(4)
 
 //---------------------------------------------------------------------------------------
 // Information about the current project that gets transmitted during authentication
@@ -191,12 +199,31 @@ class SK_API SkRemoteBase
         Command_locals,
         Command_locals_reply,
 
-        Command_memory,
-        Command_memory_reply,
+      // Allocation profiling - see SkAllocProfiler
+
+        Command_memory,                  // I->R cmd_memory() - Snapshot, stream, stop or reset SkAllocProfiler counts
+        Command_memory_reply,            // R->I cmd_memory_reply() - SkAllocProfiler counts
+
+      // Transport - appended so existing command ids are unchanged
+
+        Command_compressed_chunk,        // C->C cmd_send() - Piece of a larger compressed command, see on_cmd_compressed_chunk()
+
+      // Invocation (batched)
+
+        Command_invoke_batch,            // I->R cmd_invoke_batch() - Several snippets run over as many updates as needed, each answered with Command_invoke_result
 
       Command__last
       };
 
+    // What Command_memory asks of the runtime - see cmd_memory()
+    enum eMemoryAction
+      {
+      MemoryAction_snapshot,   // Reply once with the current counts
+      MemoryAction_stream,     // Enable profiling and reply every `frame_interval` frames
+      MemoryAction_stop,       // Stop streaming, disable profiling and reply with the final counts
+      MemoryAction_reset       // Clear the counts
+      };
+
     enum eConnectState
       {
       ConnectState_connecting,       // -> authenticating | disconnecting/disconnected
@@ -238,6 +265,7 @@ class SK_API SkRemoteBase
     bool         is_connecting() const                            { return (m_connect_state <= ConnectState_authenticated); }
     virtual bool is_connected() const                             { return (m_mode != SkLocale_embedded); }
     bool         is_symbol_db_remote() const                      { return ((m_remote_flags & SkRemoteFlag_symbol_db) != 0u); }
+    bool         is_compression_remote() const                    { return ((m_remote_flags & SkRemoteFlag_compression) != 0u); }
     virtual void disconnect();
 
     virtual bool should_class_ctors_be_called() const;
@@ -249,11 +277,14 @@ class SK_API SkRemoteBase
 
     #ifdef SKOOKUM_REMOTE
 
+      eSendResponse cmd_send(const ADatum & datum);
       void          cmd_simple(eCommand cmd);
       void          cmd_simple_uint32(eCommand cmd, uint32_t value);
       eSendResponse cmd_ping_test();
       void          cmd_print(const AString & str, uint32_t type);
       void          cmd_invoke(const AString & code);
+      void          cmd_invoke_batch(const AString * codes_p, uint32_t code_count);
+      void          cmd_memory(eMemoryAction action, uint32_t frame_interval = 1u, uint32_t top_count = 20u);
       void          cmd_invoke_result(const AString & str);
       void          cmd_symbols_update(const ASymbolTable & syms);
 
@@ -278,6 +309,11 @@ class SK_API SkRemoteBase
 
     virtual void on_connect_change(eConnectState old_state);
     virtual void on_class_updated(SkClass * class_p);
+    virtual void on_class_updates_end(uint32_t updated_class_count);
+
+    #ifdef SKOOKUM_REMOTE
+      bool         on_cmd_compressed_chunk(const uint8_t * data_p, uint32_t data_length);
+    #endif
 
   // Data Members
 
@@ -287,6 +323,15 @@ class SK_API SkRemoteBase
     // Flags from remote side - see eSkRemoteFlag
     uint32_t m_remote_flags;
 
+    // Reassembly buffer for Command_compressed_chunk and the number of bytes received so far
+    ADatum   m_chunk_in;
+    uint32_t m_chunk_in_received;
+
+    // Ids of symbols already sent by cmd_symbols_update() this connection so only new ones
+    // are transmitted.  Cleared on reconnect or when the program session changes.
+    AVCompactArrayLogical<uint32_t> m_symbols_sent;  // Sorted
+    uint64_t                        m_symbols_sent_session;
+
   };  // SkRemoteBase
 
 
@@ -12,6 +12,7 @@
 // Includes
 //=======================================================================================
 
+#include <AgogCore/APArray.hpp>
 #include <SkookumScript/SkRemoteBase.hpp>
 #include <SkookumScript/SkDebug.hpp>
 #include <SkookumScript/SkBrain.hpp>
@@ -23,6 +24,9 @@
 
 #ifdef SKOOKUM_REMOTE
 
+// Default time spent per update running snippets queued by Command_invoke_batch
+const double SkRemote_invoke_budget_seconds = 0.002;
+
 //---------------------------------------------------------------------------------------
 // Skookum remote runtime communication commands that are specific to the client runtime.
 class SK_API SkRemoteRuntimeBase : public SkRemoteBase
@@ -81,6 +85,8 @@ class SK_API SkRemoteRuntimeBase : public SkRemoteBase
     bool      is_suspended() const;
     void      suspend();
     void      resume();
+    void      process_invoke_queue(double time_budget_seconds = SkRemote_invoke_budget_seconds);
+    void      process_memory_stream();
 
   // Commands
 
@@ -97,6 +103,7 @@ class SK_API SkRemoteRuntimeBase : public SkRemoteBase
     void cmd_breakpoint_hit(const SkBreakPoint & bp, const SkCallStack * callstack_p);
     void cmd_break_expression(const SkMemberExpression & expr_info, const SkCallStack * callstack_p);
     void cmd_project();
+    void cmd_memory_reply();
 
   protected:
 
@@ -115,6 +122,8 @@ class SK_API SkRemoteRuntimeBase : public SkRemoteBase
     void         on_cmd_hierarchy_update(const void ** binary_pp);
     void         on_cmd_class_update(const void ** binary_pp);
     void         on_cmd_recompile_classes_reply(const void ** binary_pp);
+    void         on_cmd_invoke_batch(const void ** binary_pp, uint32_t data_length);
+    void         on_cmd_memory(const void ** binary_pp, uint32_t data_length);
 
     void         on_cmd_breakpoint_update(SkBreakPoint * bp_p, SkBreakPoint::eUpdate action);
     void         on_cmd_break_continue();
@@ -154,6 +163,19 @@ class SK_API SkRemoteRuntimeBase : public SkRemoteBase
     // Number of errors that occurred in some commands
     uint32_t m_error_count;
 
+    // Snippets from Command_invoke_batch waiting to be run - see process_invoke_queue()
+    APArrayFree<AString> m_invoke_queue;
+
+    // Frames between Command_memory_reply while streaming - 0 if not streaming.  See
+    // process_memory_stream()
+    uint32_t m_memory_interval;
+
+    // SkAllocProfiler frame count at which to send the next streamed reply
+    uint32_t m_memory_next_frame;
+
+    // Number of routines with the most allocations included in Command_memory_reply
+    uint32_t m_memory_top_count;
+
   };  // SkRemoteRuntimeBase
 
 #endif  // SKOOKUM_REMOTE
@@ -0,0 +1,156 @@
+// Copyright 1998-2019 Epic Games, Inc. All Rights Reserved.
+
+//=======================================================================================
+// SkookumScript C++ library.
+//
+// Deterministic recording and headless replay of a script session
+//=======================================================================================
+
+#pragma once
+
+//=======================================================================================
+// Includes
+//=======================================================================================
+
+#include <SkookumScript/Sk.hpp>
+
+
+//=======================================================================================
+// Global Structures
+//=======================================================================================
+
+// Pre-declarations
+class SkInstance;
+class SkInvokableBase;
+class SkInvokedCoroutine;
+class SkInvokedMethod;
+
+//---------------------------------------------------------------------------------------
+// Records everything outside the scripts that a session's script workload depends on so
+// that the workload can later be re-run headlessly - without the engine - with the exact
+// same results.  Used to turn a hitch seen in a running game into a repeatable benchmark
+// (see the SkookumScriptBench `-replay` option).
+//
+// The recording is a compact byte stream of:
+//   - the initialization steps - SkookumScript::initialize_sim() and initialize_gameplay()
+//   - every SkookumScript::update(), update_ticks() and update_delta() and its time
+//   - the seed of every `Random!()` - the only source of nondeterminism in the core
+//     classes - plus the seeds of any Random objects in class data when recording
+//     starts after the class constructors have already run
+//   - the result of every call to a designated "input" - a C++ method binding whose
+//     result depends on the engine (such as a player position or a clock)
+//
+// When replaying, play_step() re-issues the initialization steps and updates, `Random!()`
+// gets the recorded seed and designated inputs return the recorded result *without*
+// calling the original binding - so inputs may be engine bindings that are not even
+// registered in a headless host.  Input results are limited to nil, Boolean, Integer,
+// Real, String and Symbol - anything else is recorded as nil.
+//
+// $Note - Headless replay is meant for pure-script workloads: only designated inputs are
+// replayed and any other engine binding - including the constructors of engine classes
+// run by initialize_sim() - is not registered in a headless host.  stub_unbound() makes
+// the first call to such a binding stop the replay with a report naming it and the update
+// it was called in (see get_diverged_routine()), so a replay that runs to the end is one
+// where every engine query the workload touches was designated.
+//
+// $Note - Engine to script entry points (events, behaviour components, IDE snippets etc.)
+// are not recorded - the replayed workload is what the master mind and class constructors
+// start plus what the recorded inputs feed them.  The replay must use the same compiled
+// binary as the recording - play_start() checks the binary's checksums.
+class SK_API SkReplay
+  {
+  public:
+
+  // Nested Structures
+
+    enum eMode
+      {
+      Mode_off,
+      Mode_armed,      // Recording starts with next initialize_sim() or initialize_gameplay()
+      Mode_recording,
+      Mode_replaying
+      };
+
+    // Stream entry tags
+    enum eEvent
+      {
+      Event_end,
+      Event_sim_start,
+      Event_gameplay_start,  // + create master mind (1 byte)
+      Event_update,          // + ticks (8 bytes), time (8 bytes), delta (4 bytes)
+      Event_update_ticks,    // + ticks (8 bytes)
+      Event_update_delta,    // + delta (4 bytes)
+      Event_seed,            // + seed (4 bytes)
+      Event_class_seeds,     // + count (2 bytes), {class name (4 bytes), data index (2 bytes), seed (4 bytes)}
+      Event_input,           // + value type (1 byte) + value
+
+      Event__count
+      };
+
+  // Class Methods
+
+    static eMode get_mode()                        { return ms_mode; }
+    static bool  is_recording()                    { return ms_mode == Mode_recording; }
+    static bool  is_replaying()                    { return ms_mode == Mode_replaying; }
+
+    static bool designate_input(const ASymbol & class_name, const ASymbol & method_name, bool class_member_b);
+    static void undesignate_inputs();
+
+    // Recording
+
+      static void            record_arm();
+      static void            record_stop();
+      static const uint8_t * get_data();
+      static uint32_t        get_data_length();
+
+    // Replaying
+
+      static bool     play_start(const void * data_p, uint32_t data_length);
+      static eEvent   play_step();
+      static void     play_stop();
+      static uint32_t get_mismatch_count()         { return ms_mismatch_count; }
+      static uint32_t stub_unbound();
+
+      static const SkInvokableBase * get_diverged_routine();
+      static uint32_t                get_diverged_frame();
+
+    static void clear();
+
+    // Hooks - called by SkookumScript and the core bindings
+
+      static void     on_initialize_sim();
+      static void     on_initialize_gameplay(bool create_master_mind);
+      static void     on_deinitialize();
+      static uint32_t on_seed(uint32_t seed);
+
+      static void on_update(uint64_t sim_ticks, f64 sim_time, f32 sim_delta)  { if (ms_mode == Mode_recording) { record_update(sim_ticks, sim_time, sim_delta); } }
+      static void on_update_ticks(uint64_t sim_ticks)                         { if (ms_mode == Mode_recording) { record_update_ticks(sim_ticks); } }
+      static void on_update_delta(f32 sim_delta)                              { if (ms_mode == Mode_recording) { record_update_delta(sim_delta); } }
+
+  protected:
+
+  // Internal Class Methods
+
+    static void record_start();
+    static void record_update(uint64_t sim_ticks, f64 sim_time, f32 sim_delta);
+    static void record_update_ticks(uint64_t sim_ticks);
+    static void record_update_delta(f32 sim_delta);
+    static void record_class_seeds();
+    static void record_input(SkInstance * result_p);
+
+    static SkInstance * replay_input();
+    static void         replay_class_seeds();
+    static bool         replay_expect(eEvent event);
+
+    static void on_unbound_call(SkInvokableBase * routine_p);
+
+    static void mthd_input(SkInvokedMethod * scope_p, SkInstance ** result_pp);
+    static void mthd_unbound(SkInvokedMethod * scope_p, SkInstance ** result_pp);
+    static bool coro_unbound(SkInvokedCoroutine * scope_p);
+
+  // Class Data Members
+
+    static eMode    ms_mode;
+    static uint32_t ms_mismatch_count;
+
+  };  // SkReplay
@@ -54,6 +54,64 @@ struct SkBinaryHandle
     virtual ~SkBinaryHandle() {}
   };
 
+//---------------------------------------------------------------------------------------
+// Source of compiled binary bytes read asynchronously in chunks - used with the
+// SkRuntimeBase get_binary_hierarchy_stream() and release_binary_stream() methods so a
+// binary can be deserialized while the rest of it is still being read.
+// Subclass for the platform specific async file API.  Reads must complete in the order
+// they were requested - a read is allowed to complete before request_read() returns.
+class SK_API SkBinaryStream
+  {
+  public:
+
+  // Methods
+
+    virtual ~SkBinaryStream() {}
+
+    // Total size of binary in bytes
+    virtual uint32_t get_size() = 0;
+
+    // Starts reading size bytes from offset into dest_p
+    virtual void request_read(uint32_t offset, uint32_t size, void * dest_p) = 0;
+
+    // Waits for the oldest outstanding read to complete - returns false if it failed
+    virtual bool wait_read() = 0;
+  };
+
+//---------------------------------------------------------------------------------------
+// Plain stdio file binary stream - reads complete as soon as they are requested.
+// Handy for tools and for exercising the streamed load without a platform async API.
+class SK_API SkBinaryStreamFile : public SkBinaryStream
+  {
+  public:
+
+  // Methods
+
+    explicit SkBinaryStreamFile(const char * path_p);
+    virtual ~SkBinaryStreamFile() override;
+
+    bool is_open() const { return m_file_p != nullptr; }
+
+    virtual uint32_t get_size() override { return m_size; }
+    virtual void     request_read(uint32_t offset, uint32_t size, void * dest_p) override;
+    virtual bool     wait_read() override;
+
+  protected:
+
+  // Data Members
+
+    // FILE handle - kept opaque so stdio need not be included everywhere
+    void * m_file_p;
+
+    uint32_t m_size;
+
+    // Number of requested reads not waited on yet
+    uint32_t m_pending_count;
+
+    // Set once any read fails - all following reads fail too
+    bool m_failed;
+  };
+
 //---------------------------------------------------------------------------------------
 // Abstract base object for platform/OS specific / IO-based functions needed by Skookum
 // for debugging and other tasks.  Derive a subclass and instantiate it prior to using
@@ -88,9 +146,15 @@ class SK_API SkRuntimeBase
     #endif
       virtual void             release_binary(SkBinaryHandle * handle_p) = 0;
 
+      // Optional streamed loading of the class hierarchy - used in place of
+      // get_binary_hierarchy() when a stream is supplied
+      virtual SkBinaryStream * get_binary_hierarchy_stream()                    { return nullptr; }
+      virtual void             release_binary_stream(SkBinaryStream * stream_p) { delete stream_p; }
+
     // Script Loading / Binding
 
       eSkLoadStatus load_compiled_hierarchy();
+      eSkLoadStatus load_compiled_hierarchy_stream(SkBinaryStream * stream_p);
       virtual void  load_compiled_class_group(SkClass * class_p);
       void          load_compiled_class_group_all();
       virtual void  on_bind_routines();
@@ -110,6 +174,7 @@ class SK_API SkRuntimeBase
       friend class SkClass;
       friend class SkClosureInfoMethod;
       friend class SkClosureInfoCoroutine;
+      friend class SkCompiler;
 
     // Internal class methods
 
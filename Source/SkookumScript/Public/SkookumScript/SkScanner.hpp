@@ -0,0 +1,56 @@
+// Copyright 1998-2019 Epic Games, Inc. All Rights Reserved.
+
+//=======================================================================================
+// SkookumScript C++ library.
+//
+// Character run scanning used by the parser's lexical loops
+//=======================================================================================
+
+#pragma once
+
+//=======================================================================================
+// Includes
+//=======================================================================================
+
+#include <SkookumScript/Sk.hpp>
+
+
+//=======================================================================================
+// Global Macros / Defines
+//=======================================================================================
+
+// Define to have the scanner only use its portable scalar loops - handy to check whether
+// a parse difference is caused by the vectorized loops.
+//#define SK_SCANNER_SCALAR
+
+
+//=======================================================================================
+// Global Structures
+//=======================================================================================
+
+#if (SKOOKUM & SK_CODE_IN)
+
+//---------------------------------------------------------------------------------------
+// Finds the end of runs of similar characters 16 at a time using SSE2 (x86/x64) or NEON
+// (ARM) when available and one at a time otherwise.  The character classes match the
+// AString character match tables used by the rest of the parser - ASCII only.
+//
+// All methods take a range [cstr_p, cstr_end_p) and return the position within it where
+// the run ends or cstr_end_p if the run goes to the end of the range.  Nothing is read at
+// or past cstr_end_p.
+//
+// See: SkParser::parse_ws_any(), SkParser::parse_comment_multiline(),
+//   SkParser::find_identifier_end()
+class SK_API SkScanner
+  {
+  public:
+
+  // Class Methods
+
+    static const char * skip_white_space(const char * cstr_p, const char * cstr_end_p, bool treat_lf_as_ws = true);
+    static const char * skip_identifier(const char * cstr_p, const char * cstr_end_p);
+    static const char * find_either(const char * cstr_p, const char * cstr_end_p, char ch1, char ch2);
+
+  };  // SkScanner
+
+#endif  // (SKOOKUM & SK_CODE_IN)
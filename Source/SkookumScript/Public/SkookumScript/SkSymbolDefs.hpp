@@ -304,6 +304,7 @@ const uint32_t ASymbolId_reflected_cpp      = 0xd46e9678;
 const uint32_t ASymbolId_reflected_data     = 0x52e21d21;
 const uint32_t ASymbolId_invokable          = 0x7709b14e;
 const uint32_t ASymbolId_blueprint          = 0x2645e266; // $Revisit MBreyer make this data driven 
+const uint32_t ASymbolId_batched            = 0x73bde094;
 
   // C++ Reserved Words to watch for
 const uint32_t ASymbolId_break              = 0x0c7c50da;
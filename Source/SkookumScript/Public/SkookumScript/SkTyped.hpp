@@ -24,6 +24,7 @@
 //=======================================================================================
 
 // Pre-declarations
+class SkClass;
 class SkClassUnaryBase;
 class SkInstance;
 class SkExpressionBase;
@@ -84,6 +85,7 @@ struct SK_API SkTypedNameRaw : SkTypedName
 
   SkTypedNameRaw();
   SkTypedNameRaw(const ASymbol & name, const SkClassDescBase * type_p, const AString & bind_name);
+  ~SkTypedNameRaw();
 
   #if (SKOOKUM & SK_COMPILED_IN)
     SkTypedNameRaw(const void ** binary_pp);
@@ -95,6 +97,12 @@ struct SK_API SkTypedNameRaw : SkTypedName
     uint32_t as_binary_length() const;
   #endif
 
+  // Methods
+
+  void         resolve_raw_pod();
+  SkInstance * new_raw_pod_instance(const void * data_p) const;
+  void         release_raw_pod_instance() const;
+
   // Data Members
 
   // Lookup symbol used for binding this raw data member to engine data
@@ -105,6 +113,16 @@ struct SK_API SkTypedNameRaw : SkTypedName
   // This value is for runtime use only and not serialized into the compiled binary
   tSkRawDataInfo m_raw_data_info;
 
+  // If non-null, this member is plain old data of this class and can be copied directly
+  // at m_raw_data_info.InternalOffset - set by resolve_raw_pod() at resolve time.
+  // This value is for runtime use only and not serialized into the compiled binary
+  SkClass * m_raw_pod_class_p;
+
+  // Instance last handed out by new_raw_pod_instance() - reused while nothing else refers
+  // to it so that reading a plain old data member does not allocate each time.
+  // This value is for runtime use only and not serialized into the compiled binary
+  mutable SkInstance * m_raw_pod_instance_p;
+
   };
 
 typedef APSortedLogical<SkTypedNameRaw, ASymbol> tSkTypedNamesRaw;
@@ -0,0 +1,790 @@
+// Copyright 1998-2019 Epic Games, Inc. All Rights Reserved.
+
+//=======================================================================================
+// SkookumScript Plugin for Unreal Engine 4
+//
+// Interpreter benchmarks - loads a compiled binary and times its benchmark routines
+// without the engine so that changes to the core interpreter can be measured on their
+// own.
+//
+//   SkookumScriptBench <Classes.sk-bin> [-filter=<text>] [-iterations=<count>] [-out=<file>]
+//   SkookumScriptBench <Classes.sk-bin> -replay=<file> [-out=<file>]
+//
+//   -filter:     only run benchmarks with names containing this text
+//   -iterations: count passed to each benchmark - defaults to 100000
+//   -replay:     replay a session recorded with SkReplay instead of running benchmarks
+//   -out:        file to write the results to as JSON - defaults to the log only
+//
+// Benchmarks are the `Master` methods named `bench_*` and coroutines named `_bench_*`
+// that take the iteration count as their only argument - see Scripts/Core-Bench and
+// Scripts/Skookum-project-bench.ini.  Coroutines are updated a frame at a time until no
+// mind has anything left to update.
+//
+// Each benchmark runs once with a tenth of the iterations to warm up the pools and then
+// once timed.  For the timed run it reports:
+//   - ns_per_op:     wall time / iterations
+//   - allocs_per_op: AAppInfoCore::malloc() calls / iterations
+//   - bytes_per_op:  bytes requested from AAppInfoCore::malloc() / iterations
+//   - pool_max:      AObjReusePool high-water marks - only tracked (non-zero) if the
+//                    build defines AORPOOL_USAGE_COUNT
+//
+// A replay re-runs a recorded session - its initialization, frame updates, random seeds
+// and designated input results - exactly as recorded and times each frame.  It reports
+// the frame count, the min / avg / median / 99th percentile / max frame times, the
+// AAppInfoCore::malloc() calls per frame and the slowest frames as spikes.  The binary
+// must be the one the session was recorded with.  There is no engine here, so only
+// pure-script workloads replay: engine bindings that were not designated as inputs when
+// recording are stubbed and the first call to one stops the replay and reports it as the
+// point of divergence.
+//
+// Exit code is 0 on success, 1 if a benchmark did not complete or a replay diverged from
+// its recording and 2 on a usage or load error.
+//=======================================================================================
+
+#include "RequiredProgramMainCPPInclude.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+#include <AgogCore/AgogCore.hpp>
+#include <AgogCore/AStringRef.hpp>
+#include <SkookumScript/Sk.hpp>
+#include <SkookumScript/SkBrain.hpp>
+#include <SkookumScript/SkClass.hpp>
+#include <SkookumScript/SkCoroutine.hpp>
+#include <SkookumScript/SkDataInstance.hpp>
+#include <SkookumScript/SkInteger.hpp>
+#include <SkookumScript/SkInvokedBase.hpp>
+#include <SkookumScript/SkInvokedCoroutine.hpp>
+#include <SkookumScript/SkMethod.hpp>
+#include <SkookumScript/SkMind.hpp>
+#include <SkookumScript/SkReplay.hpp>
+#include <SkookumScript/SkRuntimeBase.hpp>
+
+DEFINE_LOG_CATEGORY_STATIC(LogSkookumScriptBench, Log, All);
+
+IMPLEMENT_APPLICATION(SkookumScriptBench, "SkookumScriptBench");
+
+// Simulated frame length used to update coroutine benchmarks
+const f32    Bench_frame_delta = 1.0f / 60.0f;
+
+// Coroutine benchmarks still running after this many frames are aborted
+const uint32 Bench_frame_limit = 100000u;
+
+// Number of slowest replay frames reported as spikes
+const int32  Bench_spike_count = 10;
+
+//---------------------------------------------------------------------------------------
+// Object pools that are reported - in FBenchResult::m_pool_max order
+enum eBenchPool
+  {
+  BenchPool_instance,
+  BenchPool_data_instance,
+  BenchPool_invoked_expression,
+  BenchPool_invoked_coroutine,
+  BenchPool_string_ref,
+
+  BenchPool__count
+  };
+
+static const TCHAR * const g_bench_pool_names[BenchPool__count] =
+  {
+  TEXT("instance"),
+  TEXT("data_instance"),
+  TEXT("invoked_expression"),
+  TEXT("invoked_coroutine"),
+  TEXT("string_ref"),
+  };
+
+//---------------------------------------------------------------------------------------
+// App info for the benchmarks - no bindings beyond the core classes and every AgogCore
+// allocation is counted
+class FBenchAppInfo : public AAppInfoCoreDefault, public SkAppInfo
+  {
+  public:
+
+    FBenchAppInfo();
+    virtual ~FBenchAppInfo();
+
+    void reset_alloc_counts()   { m_alloc_count = 0u; m_alloc_bytes = 0u; }
+
+    uint64 m_alloc_count;
+    uint64 m_alloc_bytes;
+
+  protected:
+
+    // AAppInfoCore implementation
+
+    virtual void *             malloc(size_t size, const char * debug_name_p) override;
+    virtual void               free(void * mem_p) override;
+
+    // SkAppInfo implementation
+
+    virtual void               bind_name_construct(SkBindName * bind_name_p, const AString & value) const override;
+    virtual void               bind_name_destruct(SkBindName * bind_name_p) const override;
+    virtual void               bind_name_assign(SkBindName * bind_name_p, const AString & value) const override;
+    virtual AString            bind_name_as_string(const SkBindName & bind_name) const override;
+    virtual SkInstance *       bind_name_new_instance(const SkBindName & bind_name) const override;
+    virtual SkClass *          bind_name_class() const override;
+
+  };
+
+//---------------------------------------------------------------------------------------
+// Compiled binary file held in memory
+class FBenchBinary : public SkBinaryHandle
+  {
+  public:
+
+    static FBenchBinary * create(const FString & file_path);
+
+  protected:
+
+    TArray<uint8> m_bytes;
+
+  };
+
+//---------------------------------------------------------------------------------------
+// Runtime for the benchmarks - loads the compiled binary, its symbol table and its demand
+// loaded class groups from the folder of the binary
+class FBenchRuntime : public SkRuntimeBase
+  {
+  public:
+
+    explicit FBenchRuntime(const FString & binary_path) : m_binary_path(binary_path) {}
+
+  protected:
+
+    virtual bool             is_binary_hierarchy_existing() override;
+    virtual void             on_binary_hierarchy_path_changed() override                    {}
+    virtual SkBinaryHandle * get_binary_hierarchy() override;
+    virtual SkBinaryHandle * get_binary_class_group(const SkClass & cls) override;
+  #if defined(A_SYMBOL_STR_DB_AGOG)
+    virtual SkBinaryHandle * get_binary_symbol_table() override;
+  #endif
+    virtual void             release_binary(SkBinaryHandle * handle_p) override;
+
+    FString m_binary_path;
+
+  };
+
+//---------------------------------------------------------------------------------------
+// Benchmark routine of the master mind class
+struct FBench
+  {
+  ASymbol m_name;
+  bool    m_durational;
+  };
+
+//---------------------------------------------------------------------------------------
+// Measurements of the timed run of a benchmark
+struct FBenchResult
+  {
+  FString m_name;
+  bool    m_durational;
+  bool    m_completed;
+  int32   m_iterations;
+  uint32  m_frames;
+  double  m_seconds;
+  uint64  m_alloc_count;
+  uint64  m_alloc_bytes;
+  uint32  m_pool_max[BenchPool__count];
+  };
+
+//---------------------------------------------------------------------------------------
+// Measurements of a replay
+struct FBenchReplayResult
+  {
+  TArray<double> m_frame_seconds;
+  double         m_seconds;
+  uint64         m_alloc_count;
+  uint32         m_mismatches;
+  FString        m_diverged_routine;  // Unbound C++ routine that stopped the replay - empty if none
+  uint32         m_diverged_frame;
+  };
+
+//---------------------------------------------------------------------------------------
+
+FBenchAppInfo::FBenchAppInfo()
+  : m_alloc_count(0u)
+  , m_alloc_bytes(0u)
+  {
+  AgogCore::initialize(this);
+  SkookumScript::set_app_info(this);
+  }
+
+//---------------------------------------------------------------------------------------
+
+FBenchAppInfo::~FBenchAppInfo()
+  {
+  SkookumScript::set_app_info(nullptr);
+  AgogCore::deinitialize();
+  }
+
+//---------------------------------------------------------------------------------------
+
+void * FBenchAppInfo::malloc(size_t size, const char * debug_name_p)
+  {
+  m_alloc_count++;
+  m_alloc_bytes += size;
+
+  return FMemory::Malloc(size);
+  }
+
+//---------------------------------------------------------------------------------------
+
+void FBenchAppInfo::free(void * mem_p)
+  {
+  FMemory::Free(mem_p);
+  }
+
+//---------------------------------------------------------------------------------------
+// Bind names are only used by the Engine overlays so they are stored as plain strings
+
+void FBenchAppInfo::bind_name_construct(SkBindName * bind_name_p, const AString & value) const
+  {
+  static_assert(sizeof(AString) <= sizeof(SkBindName), "AString must fit into SkBindName.");
+  new (bind_name_p) AString(value);
+  }
+
+//---------------------------------------------------------------------------------------
+
+void FBenchAppInfo::bind_name_destruct(SkBindName * bind_name_p) const
+  {
+  reinterpret_cast<AString *>(bind_name_p)->~AString();
+  }
+
+//---------------------------------------------------------------------------------------
+
+void FBenchAppInfo::bind_name_assign(SkBindName * bind_name_p, const AString & value) const
+  {
+  *reinterpret_cast<AString *>(bind_name_p) = value;
+  }
+
+//---------------------------------------------------------------------------------------
+
+AString FBenchAppInfo::bind_name_as_string(const SkBindName & bind_name) const
+  {
+  return reinterpret_cast<const AString &>(bind_name);
+  }
+
+//---------------------------------------------------------------------------------------
+
+SkInstance * FBenchAppInfo::bind_name_new_instance(const SkBindName & bind_name) const
+  {
+  // There is no Name class without the Engine overlays
+  return nullptr;
+  }
+
+//---------------------------------------------------------------------------------------
+
+SkClass * FBenchAppInfo::bind_name_class() const
+  {
+  return SkBrain::get_class("Name");
+  }
+
+//---------------------------------------------------------------------------------------
+// Returns binary with the contents of `file_path` or nullptr if it could not be read
+
+FBenchBinary * FBenchBinary::create(const FString & file_path)
+  {
+  FBenchBinary * binary_p = new FBenchBinary();
+
+  if (!FFileHelper::LoadFileToArray(binary_p->m_bytes, *file_path))
+    {
+    UE_LOG(LogSkookumScriptBench, Error, TEXT("Could not read '%s'!"), *file_path);
+    delete binary_p;
+    return nullptr;
+    }
+
+  binary_p->m_binary_p = binary_p->m_bytes.GetData();
+  binary_p->m_size     = uint32_t(binary_p->m_bytes.Num());
+
+  return binary_p;
+  }
+
+//---------------------------------------------------------------------------------------
+
+bool FBenchRuntime::is_binary_hierarchy_existing()
+  {
+  return IFileManager::Get().FileExists(*m_binary_path);
+  }
+
+//---------------------------------------------------------------------------------------
+
+SkBinaryHandle * FBenchRuntime::get_binary_hierarchy()
+  {
+  return FBenchBinary::create(m_binary_path);
+  }
+
+//---------------------------------------------------------------------------------------
+
+SkBinaryHandle * FBenchRuntime::get_binary_class_group(const SkClass & cls)
+  {
+  return FBenchBinary::create(FPaths::GetPath(m_binary_path) / FString::Printf(TEXT("Class[%x].sk-bin"), cls.get_name_id()));
+  }
+
+#if defined(A_SYMBOL_STR_DB_AGOG)
+
+//---------------------------------------------------------------------------------------
+
+SkBinaryHandle * FBenchRuntime::get_binary_symbol_table()
+  {
+  return FBenchBinary::create(FPaths::ChangeExtension(m_binary_path, TEXT("sk-sym")));
+  }
+
+#endif
+
+//---------------------------------------------------------------------------------------
+
+void FBenchRuntime::release_binary(SkBinaryHandle * handle_p)
+  {
+  delete static_cast<FBenchBinary *>(handle_p);
+  }
+
+//---------------------------------------------------------------------------------------
+// Starts a new high-water mark at the current usage of each reported pool
+
+static void reset_pool_maxes()
+  {
+  SkInstance::get_pool().reset_count_max();
+  SkDataInstance::get_pool().reset_count_max();
+  SkInvokedExpression::get_pool().reset_count_max();
+  SkInvokedCoroutine::get_pool().reset_count_max();
+  AStringRef::get_pool().reset_count_max();
+  }
+
+//---------------------------------------------------------------------------------------
+
+static void get_pool_maxes(uint32 * pool_max_p)
+  {
+  pool_max_p[BenchPool_instance]           = SkInstance::get_pool().get_count_max();
+  pool_max_p[BenchPool_data_instance]      = SkDataInstance::get_pool().get_count_max();
+  pool_max_p[BenchPool_invoked_expression] = SkInvokedExpression::get_pool().get_count_max();
+  pool_max_p[BenchPool_invoked_coroutine]  = SkInvokedCoroutine::get_pool().get_count_max();
+  pool_max_p[BenchPool_string_ref]         = AStringRef::get_pool().get_count_max();
+  }
+
+//---------------------------------------------------------------------------------------
+// Gathers the benchmark routines of the master mind class in name order
+
+static void gather_benchmarks(SkClass * class_p, const FString & filter, TArray<FBench> * benches_p)
+  {
+  for (SkMethodBase * method_p : class_p->get_instance_methods())
+    {
+    FString name = UTF8_TO_TCHAR(method_p->get_name().as_str_dbg().as_cstr());
+
+    if (name.StartsWith(TEXT("bench_"), ESearchCase::CaseSensitive) && name.Contains(filter))
+      {
+      benches_p->Add({method_p->get_name(), false});
+      }
+    }
+
+  for (SkCoroutineBase * coroutine_p : class_p->get_coroutines())
+    {
+    FString name = UTF8_TO_TCHAR(coroutine_p->get_name().as_str_dbg().as_cstr());
+
+    if (name.StartsWith(TEXT("_bench_"), ESearchCase::CaseSensitive) && name.Contains(filter))
+      {
+      benches_p->Add({coroutine_p->get_name(), true});
+      }
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Calls benchmark routine with `count` and for coroutines updates until every mind is
+// idle.  Returns false if the coroutines had to be aborted.
+
+static bool invoke_benchmark(SkMind * master_p, const FBench & bench, int32 count, uint32 * frames_p)
+  {
+  *frames_p = 0u;
+
+  if (!bench.m_durational)
+    {
+    master_p->method_call(bench.m_name, SkInteger::new_instance(count));
+
+    return true;
+    }
+
+  master_p->coroutine_call(bench.m_name, SkInteger::new_instance(count));
+
+  while (SkMind::get_updating_minds().is_filled())
+    {
+    if (*frames_p >= Bench_frame_limit)
+      {
+      SkMind::abort_all_coroutines();
+
+      return false;
+      }
+
+    SkookumScript::update_delta(Bench_frame_delta);
+    (*frames_p)++;
+    }
+
+  return true;
+  }
+
+//---------------------------------------------------------------------------------------
+
+static void run_benchmark(FBenchAppInfo * app_info_p, SkMind * master_p, const FBench & bench, int32 iterations, FBenchResult * result_p)
+  {
+  result_p->m_name       = UTF8_TO_TCHAR(bench.m_name.as_str_dbg().as_cstr());
+  result_p->m_durational = bench.m_durational;
+  result_p->m_iterations = iterations;
+
+  // Warm up - grows the pools and caches to about what the timed run needs
+  uint32 frames;
+
+  invoke_benchmark(master_p, bench, FMath::Max(iterations / 10, 1), &frames);
+
+  // Timed run
+  reset_pool_maxes();
+  app_info_p->reset_alloc_counts();
+
+  double start_time = FPlatformTime::Seconds();
+
+  result_p->m_completed   = invoke_benchmark(master_p, bench, iterations, &result_p->m_frames);
+  result_p->m_seconds     = FPlatformTime::Seconds() - start_time;
+  result_p->m_alloc_count = app_info_p->m_alloc_count;
+  result_p->m_alloc_bytes = app_info_p->m_alloc_bytes;
+
+  get_pool_maxes(result_p->m_pool_max);
+  }
+
+//---------------------------------------------------------------------------------------
+// Results as a JSON document
+
+static FString results_as_json(const FString & binary_path, int32 iterations, const TArray<FBenchResult> & results)
+  {
+  FString json = TEXT("{\n");
+
+  json += FString::Printf(TEXT("  \"binary\": \"%s\",\n"), *binary_path.ReplaceCharWithEscapedChar());
+  json += FString::Printf(TEXT("  \"iterations\": %d,\n"), iterations);
+
+  #ifdef AORPOOL_USAGE_COUNT
+    json += TEXT("  \"pool_usage_count\": true,\n");
+  #else
+    json += TEXT("  \"pool_usage_count\": false,\n");
+  #endif
+
+  json += TEXT("  \"benchmarks\": [");
+
+  for (int32 result_idx = 0; result_idx < results.Num(); result_idx++)
+    {
+    const FBenchResult & result = results[result_idx];
+    double               ops    = double(FMath::Max(result.m_iterations, 1));
+
+    json += (result_idx > 0) ? TEXT(",\n    {") : TEXT("\n    {");
+    json += FString::Printf(
+      TEXT("\"name\": \"%s\", \"kind\": \"%s\", \"completed\": %s, \"iterations\": %d, \"frames\": %u, ")
+      TEXT("\"seconds\": %.6f, \"ns_per_op\": %.3f, \"allocs_per_op\": %.4f, \"bytes_per_op\": %.2f, \"pool_max\": {"),
+      *result.m_name,
+      result.m_durational ? TEXT("coroutine") : TEXT("method"),
+      result.m_completed ? TEXT("true") : TEXT("false"),
+      result.m_iterations,
+      result.m_frames,
+      result.m_seconds,
+      (result.m_seconds * 1.0e9) / ops,
+      double(result.m_alloc_count) / ops,
+      double(result.m_alloc_bytes) / ops);
+
+    for (int32 pool_idx = 0; pool_idx < BenchPool__count; pool_idx++)
+      {
+      json += FString::Printf(TEXT("%s\"%s\": %u"), pool_idx ? TEXT(", ") : TEXT(""), g_bench_pool_names[pool_idx], result.m_pool_max[pool_idx]);
+      }
+
+    json += TEXT("}}");
+    }
+
+  json += TEXT("\n    ]\n}\n");
+
+  return json;
+  }
+
+//---------------------------------------------------------------------------------------
+// Replays a recording from the start of the program until its end and times each of its
+// frames - leaves SkookumScript at InitializationLevel_program.  Returns false if the
+// recording could not be loaded.
+
+static bool run_replay(FBenchAppInfo * app_info_p, const FString & replay_path, FBenchReplayResult * result_p)
+  {
+  TArray<uint8> bytes;
+
+  if (!FFileHelper::LoadFileToArray(bytes, *replay_path)
+    || !SkReplay::play_start(bytes.GetData(), uint32(bytes.Num())))
+    {
+    return false;
+    }
+
+  // No engine here - a call to one of its bindings that is not designated as an input
+  // stops the replay
+  uint32 stub_count = SkReplay::stub_unbound();
+
+  if (stub_count)
+    {
+    UE_LOG(LogSkookumScriptBench, Display, TEXT("Stubbed %u unbound C++ routines - calling one stops the replay."), stub_count);
+    }
+
+  result_p->m_seconds     = 0.0;
+  result_p->m_alloc_count = 0u;
+
+  SkReplay::eEvent event;
+
+  do
+    {
+    uint64 alloc_count = app_info_p->m_alloc_count;
+    double start_time  = FPlatformTime::Seconds();
+
+    event = SkReplay::play_step();
+
+    double seconds = FPlatformTime::Seconds() - start_time;
+
+    // Only the updates are frames - the initialization steps are not timed
+    if ((event == SkReplay::Event_update) || (event == SkReplay::Event_update_ticks) || (event == SkReplay::Event_update_delta))
+      {
+      result_p->m_frame_seconds.Add(seconds);
+      result_p->m_seconds     += seconds;
+      result_p->m_alloc_count += app_info_p->m_alloc_count - alloc_count;
+      }
+    }
+  while (event != SkReplay::Event_end);
+
+  result_p->m_mismatches     = SkReplay::get_mismatch_count();
+  result_p->m_diverged_frame = SkReplay::get_diverged_frame();
+  if (SkReplay::get_diverged_routine())
+    {
+    result_p->m_diverged_routine = SkReplay::get_diverged_routine()->as_string_name().as_cstr();
+    }
+  SkReplay::play_stop();
+
+  if (SkookumScript::get_initialization_level() == SkookumScript::InitializationLevel_gameplay)
+    {
+    SkookumScript::deinitialize_gameplay();
+    }
+
+  if (SkookumScript::get_initialization_level() == SkookumScript::InitializationLevel_sim)
+    {
+    SkookumScript::deinitialize_sim();
+    }
+
+  return true;
+  }
+
+//---------------------------------------------------------------------------------------
+// Replay results as a JSON document
+
+static FString replay_as_json(const FString & binary_path, const FString & replay_path, const FBenchReplayResult & result)
+  {
+  int32          frame_count = result.m_frame_seconds.Num();
+  TArray<double> sorted      = result.m_frame_seconds;
+  TArray<int32>  spikes;
+
+  sorted.Sort();
+
+  for (int32 frame_idx = 0; frame_idx < frame_count; frame_idx++)
+    {
+    spikes.Add(frame_idx);
+    }
+
+  spikes.Sort([&result](int32 lhs, int32 rhs) { return result.m_frame_seconds[lhs] > result.m_frame_seconds[rhs]; });
+  spikes.SetNum(FMath::Min(spikes.Num(), Bench_spike_count));
+
+  double frames = double(FMath::Max(frame_count, 1));
+  FString json  = TEXT("{\n");
+
+  json += FString::Printf(TEXT("  \"binary\": \"%s\",\n"), *binary_path.ReplaceCharWithEscapedChar());
+  json += FString::Printf(TEXT("  \"replay\": \"%s\",\n"), *replay_path.ReplaceCharWithEscapedChar());
+  json += FString::Printf(TEXT("  \"frames\": %d,\n"), frame_count);
+  json += FString::Printf(TEXT("  \"mismatches\": %u,\n"), result.m_mismatches);
+  if (!result.m_diverged_routine.IsEmpty())
+    {
+    json += FString::Printf(TEXT("  \"diverged\": {\"routine\": \"%s\", \"frame\": %u},\n"), *result.m_diverged_routine.ReplaceCharWithEscapedChar(), result.m_diverged_frame);
+    }
+  json += FString::Printf(TEXT("  \"seconds\": %.6f,\n"), result.m_seconds);
+  json += FString::Printf(
+    TEXT("  \"frame_ms\": {\"min\": %.4f, \"avg\": %.4f, \"median\": %.4f, \"p99\": %.4f, \"max\": %.4f},\n"),
+    frame_count ? sorted[0] * 1.0e3 : 0.0,
+    (result.m_seconds * 1.0e3) / frames,
+    frame_count ? sorted[frame_count / 2] * 1.0e3 : 0.0,
+    frame_count ? sorted[(frame_count * 99) / 100] * 1.0e3 : 0.0,
+    frame_count ? sorted.Last() * 1.0e3 : 0.0);
+  json += FString::Printf(TEXT("  \"allocs_per_frame\": %.4f,\n"), double(result.m_alloc_count) / frames);
+  json += TEXT("  \"spikes\": [");
+
+  for (int32 spike_idx = 0; spike_idx < spikes.Num(); spike_idx++)
+    {
+    json += FString::Printf(
+      TEXT("%s{\"frame\": %d, \"ms\": %.4f}"),
+      spike_idx ? TEXT(", ") : TEXT(""),
+      spikes[spike_idx],
+      result.m_frame_seconds[spikes[spike_idx]] * 1.0e3);
+    }
+
+  json += TEXT("]\n}\n");
+
+  return json;
+  }
+
+//---------------------------------------------------------------------------------------
+
+static int32 run_benchmarks(const TCHAR * command_line_p)
+  {
+  TArray<FString> tokens;
+  TArray<FString> switches;
+
+  FCommandLine::Parse(command_line_p, tokens, switches);
+
+  if (tokens.Num() < 1)
+    {
+    UE_LOG(LogSkookumScriptBench, Error, TEXT("Usage: SkookumScriptBench <Classes.sk-bin> [-filter=<text>] [-iterations=<count>] [-replay=<file>] [-out=<file>]"));
+    return 2;
+    }
+
+  FString binary_path = FPaths::ConvertRelativePathToFull(tokens[0]);
+  FString filter;
+  FString out_path;
+  FString replay_path;
+  int32   iterations = 100000;
+
+  FParse::Value(command_line_p, TEXT("-filter="), filter);
+  FParse::Value(command_line_p, TEXT("-out="), out_path);
+  FParse::Value(command_line_p, TEXT("-replay="), replay_path);
+  FParse::Value(command_line_p, TEXT("-iterations="), iterations);
+  iterations = FMath::Max(iterations, 1);
+
+  //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  // Load the compiled binary and start the sim with the core bindings only
+  FBenchAppInfo app_info;
+  FBenchRuntime runtime(binary_path);
+
+  eSkLoadStatus status = runtime.load_compiled_hierarchy();
+
+  if (status != SkLoadStatus_ok)
+    {
+    UE_LOG(LogSkookumScriptBench, Error, TEXT("Could not load '%s' - load status %d!"), *binary_path, int32(status));
+    return 2;
+    }
+
+  runtime.load_compiled_class_group_all();
+
+  SkookumScript::initialize_program();
+
+  //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  // Replay a recorded session - it initializes the sim and gameplay itself
+  if (!replay_path.IsEmpty())
+    {
+    FBenchReplayResult replay;
+    bool               loaded = run_replay(&app_info, replay_path, &replay);
+
+    SkookumScript::deinitialize_program();
+    SkookumScript::deinitialize();
+
+    if (!loaded)
+      {
+      UE_LOG(LogSkookumScriptBench, Error, TEXT("Could not replay '%s'!"), *replay_path);
+      return 2;
+      }
+
+    UE_LOG(
+      LogSkookumScriptBench,
+      Display,
+      TEXT("Replayed %d frames in %.3f ms %s"),
+      replay.m_frame_seconds.Num(),
+      replay.m_seconds * 1.0e3,
+      replay.m_mismatches ? TEXT("- diverged from the recording!") : TEXT(""));
+
+    if (!replay.m_diverged_routine.IsEmpty())
+      {
+      UE_LOG(
+        LogSkookumScriptBench,
+        Error,
+        TEXT("Replay stopped at frame %u: unbound C++ routine '%s' was called - designate it as an input when recording or replay a pure-script workload."),
+        replay.m_diverged_frame,
+        *replay.m_diverged_routine);
+      }
+
+    if (!out_path.IsEmpty())
+      {
+      if (!FFileHelper::SaveStringToFile(replay_as_json(binary_path, replay_path, replay), *out_path))
+        {
+        UE_LOG(LogSkookumScriptBench, Error, TEXT("Could not write '%s'!"), *out_path);
+        return 2;
+        }
+
+      UE_LOG(LogSkookumScriptBench, Display, TEXT("Results written to '%s'"), *out_path);
+      }
+
+    return replay.m_mismatches ? 1 : 0;
+    }
+
+  SkookumScript::initialize_sim();
+  SkookumScript::initialize_gameplay();
+
+  //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  // Run benchmarks
+  SkMind *             master_p = SkookumScript::get_master_mind();
+  TArray<FBench>       benches;
+  TArray<FBenchResult> results;
+  bool                 completed = true;
+
+  gather_benchmarks(master_p->get_class(), filter, &benches);
+
+  if (benches.Num() == 0)
+    {
+    UE_LOG(LogSkookumScriptBench, Warning, TEXT("No benchmarks found - `%s` needs `bench_*` methods or `_bench_*` coroutines."), UTF8_TO_TCHAR(master_p->get_class()->get_name_cstr_dbg()));
+    }
+
+  results.SetNum(benches.Num());
+
+  for (int32 bench_idx = 0; bench_idx < benches.Num(); bench_idx++)
+    {
+    FBenchResult & result = results[bench_idx];
+
+    run_benchmark(&app_info, master_p, benches[bench_idx], iterations, &result);
+
+    UE_LOG(
+      LogSkookumScriptBench,
+      Display,
+      TEXT("%-24s %12.3f ns/op %10.4f allocs/op %s"),
+      *result.m_name,
+      (result.m_seconds * 1.0e9) / double(iterations),
+      double(result.m_alloc_count) / double(iterations),
+      result.m_completed ? TEXT("") : TEXT("- aborted after frame limit!"));
+
+    completed = result.m_completed && completed;
+    }
+
+  SkookumScript::deinitialize_gameplay();
+  SkookumScript::deinitialize_sim();
+  SkookumScript::deinitialize_program();
+  SkookumScript::deinitialize();
+
+  //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  // Write results
+  if (!out_path.IsEmpty())
+    {
+    if (!FFileHelper::SaveStringToFile(results_as_json(binary_path, iterations, results), *out_path))
+      {
+      UE_LOG(LogSkookumScriptBench, Error, TEXT("Could not write '%s'!"), *out_path);
+      return 2;
+      }
+
+    UE_LOG(LogSkookumScriptBench, Display, TEXT("Results written to '%s'"), *out_path);
+    }
+
+  return completed ? 0 : 1;
+  }
+
+//---------------------------------------------------------------------------------------
+
+INT32_MAIN_INT32_ARGC_TCHAR_ARGV()
+  {
+  GEngineLoop.PreInit(ArgC, ArgV);
+
+  int32 exit_code = run_benchmarks(FCommandLine::Get());
+
+  FEngineLoop::AppPreExit();
+  FModuleManager::Get().UnloadModulesAtShutdown();
+  FEngineLoop::AppExit();
+
+  return exit_code;
+  }
@@ -0,0 +1,30 @@
+// Copyright 1998-2019 Epic Games, Inc. All Rights Reserved.
+
+//=======================================================================================
+// SkookumScript Plugin for Unreal Engine 4
+//=======================================================================================
+
+using UnrealBuildTool;
+
+// SkookumScript interpreter benchmarks - runs the benchmark routines of a compiled binary
+// without the engine so interpreter changes can be measured on their own.
+[SupportedPlatforms(UnrealPlatformClass.Desktop)]
+public class SkookumScriptBenchTarget : TargetRules
+{
+  public SkookumScriptBenchTarget(TargetInfo Target) : base(Target)
+  {
+    Type = TargetType.Program;
+    LinkType = TargetLinkType.Monolithic;
+    LaunchModuleName = "SkookumScriptBench";
+
+    // Only needs Core - no engine, editor or UI
+    bBuildDeveloperTools = false;
+    bCompileAgainstEngine = false;
+    bCompileAgainstCoreUObject = false;
+    bCompileAgainstApplicationCore = false;
+    bCompileICU = false;
+    bUsesSlate = false;
+
+    bIsBuildingConsoleApplication = true;
+  }
+}
@@ -0,0 +1,520 @@
+// Copyright 1998-2019 Epic Games, Inc. All Rights Reserved.
+
+//=======================================================================================
+// SkookumScript Plugin for Unreal Engine 4
+//
+// Headless script compiler - compiles the script overlays of a project to the compiled
+// binaries loaded by SkookumScriptRuntime without the SkookumIDE or the editor.
+//
+//   SkookumScriptCompiler <Skookum-project.ini> [-out=<folder>] [-nocache]
+//
+//   -out:     folder to write the binaries to - defaults to the folder of `CompileTo` in
+//             the [Output] section of the project ini
+//   -nocache: parse every routine and do not write the incremental cache - which is
+//             otherwise kept next to the binaries as `<CompileTo>.sk-cache`
+//
+// Exit code is 0 on success, 1 if the scripts have errors and 2 on a usage error.
+//=======================================================================================
+
+#include "RequiredProgramMainCPPInclude.h"
+#include "HAL/FileManager.h"
+#include "Misc/ConfigCacheIni.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+#include <AgogCore/AgogCore.hpp>
+#include <AgogCore/ASymbolTable.hpp>
+#include <SkookumScript/Sk.hpp>
+#include <SkookumScript/SkBrain.hpp>
+#include <SkookumScript/SkClass.hpp>
+#include <SkookumScript/SkCompiler.hpp>
+#include <SkookumScript/SkParser.hpp>
+#include <SkookumScript/SkRuntimeBase.hpp>
+
+DEFINE_LOG_CATEGORY_STATIC(LogSkookumScriptCompiler, Log, All);
+
+IMPLEMENT_APPLICATION(SkookumScriptCompiler, "SkookumScriptCompiler");
+
+//---------------------------------------------------------------------------------------
+// App info for the compiler - no bindings, no game
+class FCompilerAppInfo : public AAppInfoCoreDefault, public SkAppInfo
+  {
+  public:
+
+    FCompilerAppInfo();
+    virtual ~FCompilerAppInfo();
+
+    bool    m_use_builtin_actor;
+    ASymbol m_custom_actor_class_name;
+
+  protected:
+
+    // SkAppInfo implementation
+
+    virtual bool               use_builtin_actor() const override                { return m_use_builtin_actor; }
+    virtual ASymbol            get_custom_actor_class_name() const override      { return m_custom_actor_class_name; }
+    virtual void               bind_name_construct(SkBindName * bind_name_p, const AString & value) const override;
+    virtual void               bind_name_destruct(SkBindName * bind_name_p) const override;
+    virtual void               bind_name_assign(SkBindName * bind_name_p, const AString & value) const override;
+    virtual AString            bind_name_as_string(const SkBindName & bind_name) const override;
+    virtual SkInstance *       bind_name_new_instance(const SkBindName & bind_name) const override;
+    virtual SkClass *          bind_name_class() const override;
+
+  };
+
+//---------------------------------------------------------------------------------------
+// Runtime for the compiler - it never loads compiled binaries.  Present since routines
+// restored from the compile cache are loaded like compiled routines.
+class FCompilerRuntime : public SkRuntimeBase
+  {
+  protected:
+
+    virtual bool             is_binary_hierarchy_existing() override                        { return false; }
+    virtual void             on_binary_hierarchy_path_changed() override                    {}
+    virtual SkBinaryHandle * get_binary_hierarchy() override                                { return nullptr; }
+    virtual SkBinaryHandle * get_binary_class_group(const SkClass & cls) override           { return nullptr; }
+  #if defined(A_SYMBOL_STR_DB_AGOG)
+    virtual SkBinaryHandle * get_binary_symbol_table() override                             { return nullptr; }
+  #endif
+    virtual void             release_binary(SkBinaryHandle * handle_p) override             {}
+
+  };
+
+//---------------------------------------------------------------------------------------
+
+FCompilerAppInfo::FCompilerAppInfo()
+  : m_use_builtin_actor(false)
+  {
+  AgogCore::initialize(this);
+  SkookumScript::set_app_info(this);
+  }
+
+//---------------------------------------------------------------------------------------
+
+FCompilerAppInfo::~FCompilerAppInfo()
+  {
+  SkookumScript::set_app_info(nullptr);
+  AgogCore::deinitialize();
+  }
+
+//---------------------------------------------------------------------------------------
+// The compiler only ever writes bind names back out so they are stored as plain strings
+
+void FCompilerAppInfo::bind_name_construct(SkBindName * bind_name_p, const AString & value) const
+  {
+  static_assert(sizeof(AString) <= sizeof(SkBindName), "AString must fit into SkBindName.");
+  new (bind_name_p) AString(value);
+  }
+
+//---------------------------------------------------------------------------------------
+
+void FCompilerAppInfo::bind_name_destruct(SkBindName * bind_name_p) const
+  {
+  reinterpret_cast<AString *>(bind_name_p)->~AString();
+  }
+
+//---------------------------------------------------------------------------------------
+
+void FCompilerAppInfo::bind_name_assign(SkBindName * bind_name_p, const AString & value) const
+  {
+  *reinterpret_cast<AString *>(bind_name_p) = value;
+  }
+
+//---------------------------------------------------------------------------------------
+
+AString FCompilerAppInfo::bind_name_as_string(const SkBindName & bind_name) const
+  {
+  return reinterpret_cast<const AString &>(bind_name);
+  }
+
+//---------------------------------------------------------------------------------------
+
+SkInstance * FCompilerAppInfo::bind_name_new_instance(const SkBindName & bind_name) const
+  {
+  // Scripts are never run by the compiler
+  return nullptr;
+  }
+
+//---------------------------------------------------------------------------------------
+
+SkClass * FCompilerAppInfo::bind_name_class() const
+  {
+  return SkBrain::get_class("Name");
+  }
+
+//---------------------------------------------------------------------------------------
+
+static AString to_astring(const FString & str)
+  {
+  return AString(*str, str.Len());
+  }
+
+//---------------------------------------------------------------------------------------
+
+static ASymbol to_symbol(const FString & str)
+  {
+  return ASymbol::create(to_astring(str));
+  }
+
+//---------------------------------------------------------------------------------------
+// Loads a script file with Unix line endings
+
+static bool load_script_file(const FString & file_path, AString * source_p)
+  {
+  TArray<uint8> bytes;
+
+  if (!FFileHelper::LoadFileToArray(bytes, *file_path))
+    {
+    UE_LOG(LogSkookumScriptCompiler, Error, TEXT("Could not read '%s'!"), *file_path);
+    return false;
+    }
+
+  *source_p = AString(reinterpret_cast<const char *>(bytes.GetData()), uint32_t(bytes.Num()));
+  source_p->remove_all('\r');
+
+  return true;
+  }
+
+//---------------------------------------------------------------------------------------
+// Gathers the class folders in `dir_path` and their member files - recursively.
+// Folder `Class` is a subclass of `superclass_name` and `Class.Super` (used past the
+// overlay path depth) names its superclass explicitly.
+
+static bool gather_class_folders(SkCompiler * compiler_p, const FString & dir_path, const ASymbol & superclass_name)
+  {
+  bool success = true;
+  TArray<FString> dir_names;
+
+  IFileManager::Get().FindFiles(dir_names, *(dir_path / TEXT("*")), false, true);
+  dir_names.Sort();
+
+  for (const FString & dir_name : dir_names)
+    {
+    if (dir_name.StartsWith(TEXT("-")))
+      {
+      continue;
+      }
+
+    FString class_str = dir_name;
+    FString super_str;
+    ASymbol super_name = superclass_name;
+
+    if (dir_name.Split(TEXT("."), &class_str, &super_str))
+      {
+      super_name = to_symbol(super_str);
+      }
+
+    ASymbol class_name = to_symbol(class_str);
+    FString class_path = dir_path / dir_name;
+
+    compiler_p->declare_class(class_name, super_name);
+
+    TArray<FString> file_names;
+
+    IFileManager::Get().FindFiles(file_names, *(class_path / TEXT("*")), true, false);
+    file_names.Sort();
+
+    for (const FString & file_name : file_names)
+      {
+      FString file_path = class_path / file_name;
+      AString source;
+
+      success = load_script_file(file_path, &source)
+        && compiler_p->add_member_file(class_name, to_astring(file_name), source, to_astring(file_path))
+        && success;
+      }
+
+    success = gather_class_folders(compiler_p, class_path, class_name) && success;
+    }
+
+  return success;
+  }
+
+//---------------------------------------------------------------------------------------
+// Gathers one `[Script Overlays]` entry - `[-][*]Name|Path[|Depth]` where Depth `A` is a
+// single `!Overlay.sk` archive and `C` is an archive per class named `Class.Super.sk`.
+
+static bool gather_overlay(SkCompiler * compiler_p, const FString & ini_dir, const FString & overlay_entry)
+  {
+  TArray<FString> fields;
+
+  overlay_entry.ParseIntoArray(fields, TEXT("|"), false);
+
+  if (fields.Num() < 2)
+    {
+    UE_LOG(LogSkookumScriptCompiler, Error, TEXT("Malformed overlay '%s'!"), *overlay_entry);
+    return false;
+    }
+
+  if (fields[0].StartsWith(TEXT("-")))
+    {
+    // Disabled overlay
+    return true;
+    }
+
+  FString overlay_path = FPaths::Combine(ini_dir, fields[1].Replace(TEXT("\\"), TEXT("/")));
+  TCHAR   depth        = (fields.Num() > 2 && !fields[2].IsEmpty()) ? FChar::ToUpper(fields[2][0]) : TCHAR('\0');
+
+  FPaths::CollapseRelativeDirectories(overlay_path);
+  UE_LOG(LogSkookumScriptCompiler, Display, TEXT("Overlay '%s' - %s"), *fields[0], *overlay_path);
+
+  switch (depth)
+    {
+    case TCHAR('A'):
+      {
+      FString archive_path = overlay_path / TEXT("!Overlay.sk");
+      AString source;
+
+      return load_script_file(archive_path, &source)
+        && compiler_p->add_class_archive(source, to_astring(archive_path));
+      }
+
+    case TCHAR('C'):
+      {
+      bool            success = true;
+      TArray<FString> file_names;
+
+      IFileManager::Get().FindFiles(file_names, *(overlay_path / TEXT("*.sk")), true, false);
+      file_names.Sort();
+
+      for (const FString & file_name : file_names)
+        {
+        FString class_str;
+        FString super_str;
+
+        if (!FPaths::GetBaseFilename(file_name).Split(TEXT("."), &class_str, &super_str))
+          {
+          // `!Overlay.sk` and the like
+          continue;
+          }
+
+        FString archive_path = overlay_path / file_name;
+        ASymbol class_name   = to_symbol(class_str);
+        AString source;
+
+        compiler_p->declare_class(class_name, to_symbol(super_str));
+        success = load_script_file(archive_path, &source)
+          && compiler_p->add_class_archive(source, to_astring(archive_path), class_name)
+          && success;
+        }
+
+      return success;
+      }
+
+    default:
+      return gather_class_folders(compiler_p, overlay_path, ASymbol::get_null());
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+
+template<typename _WriteFunc>
+static bool save_binary(const FString & file_path, uint32_t length, _WriteFunc write_f)
+  {
+  TArray<uint8> bytes;
+
+  bytes.SetNumUninitialized(int32(length));
+
+  void * binary_p = bytes.GetData();
+
+  write_f(&binary_p);
+
+  if (!FFileHelper::SaveArrayToFile(bytes, *file_path))
+    {
+    UE_LOG(LogSkookumScriptCompiler, Error, TEXT("Could not write '%s'!"), *file_path);
+    return false;
+    }
+
+  UE_LOG(LogSkookumScriptCompiler, Display, TEXT("  %s - %u bytes"), *file_path, length);
+
+  return true;
+  }
+
+//---------------------------------------------------------------------------------------
+// Writes the program, its demand loaded class groups and the symbol table
+
+static bool save_binaries(const FString & out_dir, const FString & out_stem)
+  {
+  bool success = save_binary(
+    out_dir / (out_stem + TEXT(".sk-bin")),
+    SkBrain::as_binary_length(),
+    [](void ** binary_pp) { SkBrain::as_binary(binary_pp); });
+
+  for (SkClass * class_p : SkBrain::get_classes())
+    {
+    SkClass * superclass_p = class_p->get_superclass();
+
+    // Nested demand loaded classes are part of the group of their outermost root
+    if (class_p->is_demand_loaded_root() && !(superclass_p && superclass_p->is_demand_loaded()))
+      {
+      success = save_binary(
+        out_dir / FString::Printf(TEXT("Class[%x].sk-bin"), class_p->get_name_id()),
+        class_p->as_binary_group_length(false),
+        [class_p](void ** binary_pp) { class_p->as_binary_group(binary_pp, false); })
+        && success;
+      }
+    }
+
+  #if defined(A_SYMBOL_STR_DB_AGOG)
+    success = save_binary(
+      out_dir / (out_stem + TEXT(".sk-sym")),
+      ASymbolTable::ms_main_p->as_binary_length(),
+      [](void ** binary_pp) { ASymbolTable::ms_main_p->as_binary(binary_pp); })
+      && success;
+  #endif
+
+  return success;
+  }
+
+//---------------------------------------------------------------------------------------
+
+static int32 compile_project(const TCHAR * command_line_p)
+  {
+  TArray<FString> tokens;
+  TArray<FString> switches;
+
+  FCommandLine::Parse(command_line_p, tokens, switches);
+
+  if (tokens.Num() < 1)
+    {
+    UE_LOG(LogSkookumScriptCompiler, Error, TEXT("Usage: SkookumScriptCompiler <Skookum-project.ini> [-out=<folder>] [-nocache]"));
+    return 2;
+    }
+
+  //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  // Read project settings
+  FString     ini_path = FPaths::ConvertRelativePathToFull(tokens[0]);
+  FString     ini_dir  = FPaths::GetPath(ini_path);
+  FConfigFile ini;
+
+  if (!IFileManager::Get().FileExists(*ini_path))
+    {
+    UE_LOG(LogSkookumScriptCompiler, Error, TEXT("Project file '%s' does not exist!"), *ini_path);
+    return 2;
+    }
+
+  ini.Read(ini_path);
+
+  FString project_name;
+  FString startup_mind      = TEXT("Master");
+  FString custom_actor      = TEXT("Actor");
+  FString compile_to        = TEXT("Classes.sk-bin");
+  bool    strict_parse      = true;
+  bool    use_builtin_actor = false;
+
+  ini.GetString(TEXT("Project"), TEXT("ProjectName"), project_name);
+  ini.GetString(TEXT("Project"), TEXT("StartupMind"), startup_mind);
+  ini.GetString(TEXT("Project"), TEXT("CustomActorClass"), custom_actor);
+  ini.GetBool(TEXT("Project"), TEXT("StrictParse"), strict_parse);
+  ini.GetBool(TEXT("Project"), TEXT("UseBuiltinActor"), use_builtin_actor);
+  ini.GetString(TEXT("Output"), TEXT("CompileTo"), compile_to);
+
+  compile_to = FPaths::Combine(ini_dir, compile_to.Replace(TEXT("\\"), TEXT("/")));
+  FPaths::CollapseRelativeDirectories(compile_to);
+
+  FString out_dir  = FPaths::GetPath(compile_to);
+  FString out_stem = FPaths::GetBaseFilename(compile_to);
+  bool    use_cache = !FParse::Param(command_line_p, TEXT("nocache"));
+
+  FParse::Value(command_line_p, TEXT("-out="), out_dir);
+
+  FString cache_path = out_dir / (out_stem + TEXT(".sk-cache"));
+
+  //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  // Initialize SkookumScript without any bindings
+  FCompilerAppInfo app_info;
+  FCompilerRuntime runtime;
+
+  app_info.m_use_builtin_actor       = use_builtin_actor;
+  app_info.m_custom_actor_class_name = use_builtin_actor ? ASymbol::get_null() : to_symbol(custom_actor);
+
+  SkookumScript::initialize();
+  SkParser::enable_strict(strict_parse);
+
+  SkBrain::ms_project_name = to_astring(project_name);
+  SkBrain::ms_project_path = to_astring(ini_path);
+
+  //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+  // Gather overlays in order and compile - scoped so that any leftover routines are
+  // freed before SkookumScript is deinitialized
+  bool compiled = false;
+
+    {
+    SkCompiler compiler;
+    bool       gathered = true;
+    FString    overlay_entry;
+
+    for (int32 overlay_idx = 1;
+      ini.GetString(TEXT("Script Overlays"), *FString::Printf(TEXT("Overlay%d"), overlay_idx), overlay_entry);
+      overlay_idx++)
+      {
+      gathered = gather_overlay(&compiler, ini_dir, overlay_entry) && gathered;
+      }
+
+    //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+    // Pick up the routines of the previous compile
+    TArray<uint8> cache_bytes;
+
+    if (use_cache)
+      {
+      compiler.enable_cache();
+
+      if (FFileHelper::LoadFileToArray(cache_bytes, *cache_path, FILEREAD_Silent)
+        && !compiler.load_cache(cache_bytes.GetData(), uint32_t(cache_bytes.Num())))
+        {
+        UE_LOG(LogSkookumScriptCompiler, Display, TEXT("Ignoring out of date cache '%s'"), *cache_path);
+        }
+      }
+
+    //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+    // Compile and write binaries
+    UE_LOG(LogSkookumScriptCompiler, Display, TEXT("Compiling %u members..."), compiler.get_member_count());
+
+    double start_time = FPlatformTime::Seconds();
+
+    compiled = compiler.compile(to_symbol(startup_mind)) && gathered;
+
+    if (compiler.get_error_count())
+      {
+      UE_LOG(LogSkookumScriptCompiler, Error, TEXT("%s"), UTF8_TO_TCHAR(compiler.get_errors().as_cstr()));
+      UE_LOG(LogSkookumScriptCompiler, Error, TEXT("%u error(s)"), compiler.get_error_count());
+      }
+
+    if (compiled)
+      {
+      UE_LOG(LogSkookumScriptCompiler, Display, TEXT("Compiled in %.2f seconds - writing binaries to '%s'"), FPlatformTime::Seconds() - start_time, *out_dir);
+
+      compiled = save_binaries(out_dir, out_stem);
+
+      if (use_cache)
+        {
+        UE_LOG(LogSkookumScriptCompiler, Display, TEXT("%u routine(s) restored from cache"), compiler.get_cached_count());
+
+        // Not fatal - the next compile just parses everything
+        save_binary(
+          cache_path,
+          compiler.as_cache_binary_length(),
+          [&compiler](void ** binary_pp) { compiler.as_cache_binary(binary_pp); });
+        }
+      }
+    }
+
+  SkookumScript::deinitialize();
+
+  return compiled ? 0 : 1;
+  }
+
+//---------------------------------------------------------------------------------------
+
+INT32_MAIN_INT32_ARGC_TCHAR_ARGV()
+  {
+  GEngineLoop.PreInit(ArgC, ArgV);
+
+  int32 exit_code = compile_project(FCommandLine::Get());
+
+  FEngineLoop::AppPreExit();
+  FModuleManager::Get().UnloadModulesAtShutdown();
+  FEngineLoop::AppExit();
+
+  return exit_code;
+  }
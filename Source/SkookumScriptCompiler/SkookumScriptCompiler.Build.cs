@@ -0,0 +1,35 @@
+// Copyright 1998-2019 Epic Games, Inc. All Rights Reserved.
+
+//=======================================================================================
+// SkookumScript Plugin for Unreal Engine 4
+//=======================================================================================
+
+using System.IO;
+using UnrealBuildTool;
+
+namespace UnrealBuildTool.Rules
+{
+  public class SkookumScriptCompiler : ModuleRules
+  {
+    public SkookumScriptCompiler(ReadOnlyTargetRules Target) : base(Target)
+    {
+      // Tell build system we're not using PCHs
+      PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+      PublicIncludePaths.Add("Runtime/Launch/Public");
+
+      // For RequiredProgramMainCPPInclude.h
+      PrivateIncludePaths.Add("Runtime/Launch/Private");
+
+      PrivateDependencyModuleNames.AddRange(
+        new string[]
+        {
+          "Core",
+          "Projects",
+          "AgogCore",
+          "SkookumScript",
+        }
+        );
+    }
+  }
+}
@@ -0,0 +1,30 @@
+// Copyright 1998-2019 Epic Games, Inc. All Rights Reserved.
+
+//=======================================================================================
+// SkookumScript Plugin for Unreal Engine 4
+//=======================================================================================
+
+using UnrealBuildTool;
+
+// Headless SkookumScript compiler - compiles the script overlays of a project without the
+// SkookumIDE or editor so CI and Linux build machines can produce the compiled binaries.
+[SupportedPlatforms(UnrealPlatformClass.Desktop)]
+public class SkookumScriptCompilerTarget : TargetRules
+{
+  public SkookumScriptCompilerTarget(TargetInfo Target) : base(Target)
+  {
+    Type = TargetType.Program;
+    LinkType = TargetLinkType.Monolithic;
+    LaunchModuleName = "SkookumScriptCompiler";
+
+    // Only needs Core - no engine, editor or UI
+    bBuildDeveloperTools = false;
+    bCompileAgainstEngine = false;
+    bCompileAgainstCoreUObject = false;
+    bCompileAgainstApplicationCore = false;
+    bCompileICU = false;
+    bUsesSlate = false;
+
+    bIsBuildingConsoleApplication = true;
+  }
+}
@@ -13,6 +13,8 @@
 #include "Internationalization/Regex.h"
 #include "Modules/ModuleManager.h" // For IMPLEMENT_MODULE
 #include "Runtime/Core/Public/Features/IModularFeatures.h"
+#include "Async/ParallelFor.h"
+#include "Misc/Crc.h"
 
 #include "SkookumScriptGeneratorBase.inl"
 
@@ -148,6 +150,17 @@ class FSkookumScriptGenerator : public ISkookumScriptGenerator, public FSkookumS
     bool operator == (UField * type_p) const { return m_type_p == type_p; }
     };
 
+  // Script files of a generated type, written as a unit and tracked in the script manifest
+  struct ScriptFileSet
+    {
+    const GeneratedType * m_generated_type_p;
+    FString               m_class_path;
+    uint32                m_hash;       // Content hash of all files in the set
+    bool                  m_meta_only;  // Just the meta file - to make sure a class from another overlay exists
+    };
+
+  typedef TMap<FString, uint32> tScriptManifest; // Maps class path to content hash of its files
+
   // Record include paths in the order they were encountered
   struct IncludeFilePath
     {
@@ -245,6 +258,11 @@ class FSkookumScriptGenerator : public ISkookumScriptGenerator, public FSkookumS
 
   void                  save_generated_cpp_files(eClassScope class_scope);
   bool                  save_generated_script_files(eClassScope class_scope);
+  bool                  save_script_file_set(const ScriptFileSet & file_set, TArray<FString> * out_failed_paths_p);
+  bool                  load_script_manifest(const FString & manifest_file_path, tScriptManifest * out_manifest_p);
+  void                  delete_script_file_set(const FString & class_path);
+
+  static uint32         get_script_file_set_hash(const GeneratedType & generated_type, bool meta_only);
 
   bool                  can_export_enum(UEnum * enum_p);
   bool                  can_export_method(UFunction * function_p, int32 include_priority, uint32 referenced_flags, bool allow_delegate = false);
@@ -658,7 +676,7 @@ FString FSkookumScriptGenerator::generate_class_header_file_body(UStruct * struc
     }
   else
     {
-    header_code += FString::Printf(TEXT("    using %s::register_bindings;\n"), class_p ? TEXT("tBindingEntity") : TEXT("tBindingStruct"));
+    header_code += FString::Printf(TEXT("    using %s::register_bindings;\n"), class_p ? TEXT("tBindingEntity") : (is_pod(struct_or_class_p) ? TEXT("tBindingStructPod") : TEXT("tBindingStruct")));
     }
   header_code += TEXT("  };\n\n");
 
@@ -738,7 +756,7 @@ FString FSkookumScriptGenerator::generate_class_binding_file_body(UStruct * stru
         {
         if (bindings.m_method_bindings[scope].Num() > 0)
           {
-          generated_code += FString::Printf(TEXT("  ms_class_p->register_method_func_bulk(SkUE%s_Impl::methods_%c, %d, %s);\n"), *skookum_class_name, scope ? TCHAR('c') : TCHAR('i'), bindings.m_method_bindings[scope].Num(), scope ? TEXT("SkBindFlag_class_no_rebind") : TEXT("SkBindFlag_instance_no_rebind"));
+          generated_code += FString::Printf(TEXT("  ms_class_p->register_method_func_bulk_deferred(SkUE%s_Impl::methods_%c, %d, %s);\n"), *skookum_class_name, scope ? TCHAR('c') : TCHAR('i'), bindings.m_method_bindings[scope].Num(), scope ? TEXT("SkBindFlag_class_no_rebind") : TEXT("SkBindFlag_instance_no_rebind"));
           }
         }
       if (bindings.m_event_bindings.Num() > 0)
@@ -1523,11 +1541,19 @@ bool FSkookumScriptGenerator::save_generated_script_files(eClassScope class_scop
     compute_scripts_path_depth(m_targets[ClassScope_engine].m_root_directory_path / TEXT("Scripts/Skookum-project-default.ini"), TEXT("Engine-Generated"));
     }
 
-  // Clear contents of scripts folder for a fresh start
-  FString directory_to_delete(m_overlay_path / TEXT("Object"));
-  IFileManager::Get().DeleteDirectory(*directory_to_delete, false, true);
+  // Loose files from the previous run and their content hashes
+  const FString manifest_file_path(m_overlay_path / TEXT("!Generated.manifest"));
+  tScriptManifest manifest;
 
   // Create single packed file or folder structure of loose files?
+  if (m_overlay_path_depth == PathDepth_archived || !load_script_manifest(manifest_file_path, &manifest))
+    {
+    // Clear contents of scripts folder for a fresh start
+    FString directory_to_delete(m_overlay_path / TEXT("Object"));
+    IFileManager::Get().DeleteDirectory(*directory_to_delete, false, true);
+    IFileManager::Get().Delete(*manifest_file_path, false, true, true);
+    }
+
   if (m_overlay_path_depth == PathDepth_archived)
     {
     // Packed file, generate it
@@ -1661,33 +1687,15 @@ bool FSkookumScriptGenerator::save_generated_script_files(eClassScope class_scop
     generate_root_meta_file(TEXT("Enum"));
     generate_root_meta_file(TEXT("UStruct"));
 
-    // Loop through generated scripts and write them to disk
+    // Gather the file sets to write - class paths must be determined serially as
+    // get_skookum_class_path() might request more types to be generated
+    TArray<ScriptFileSet> file_sets;
+    file_sets.Reserve(m_types_generated.Num());
     for (const GeneratedType & generated_type : m_types_generated)
       {
       if (generated_type.m_class_scope == class_scope)
         {
-        FString skookum_class_path = get_skookum_class_path(generated_type.m_type_p, 0, 0);
-
-        // Write meta file (even if empty)
-        save_text_file(skookum_class_path / TEXT("!Class.sk-meta"), generated_type.m_sk_meta_file_body);
-
-        // Write instance data if any
-        if (!generated_type.m_sk_instance_data_file_body.IsEmpty())
-          {
-          save_text_file(skookum_class_path / TEXT("!Data.sk"), generated_type.m_sk_instance_data_file_body);
-          }
-
-        // Write class data if any
-        if (!generated_type.m_sk_class_data_file_body.IsEmpty())
-          {
-          save_text_file(skookum_class_path / TEXT("!DataC.sk"), generated_type.m_sk_class_data_file_body);
-          }
-
-        // Write method definitions
-        for (tSkRoutines::TConstIterator iter(generated_type.m_sk_routines); iter; ++iter)
-          {
-          save_text_file(skookum_class_path / get_skookum_method_file_name(iter->m_name, iter->m_is_class_member), iter->m_body);
-          }
+        file_sets.Add({ &generated_type, get_skookum_class_path(generated_type.m_type_p, 0, 0), get_script_file_set_hash(generated_type, false), false });
         }
       }
 
@@ -1701,15 +1709,198 @@ bool FSkookumScriptGenerator::save_generated_script_files(eClassScope class_scop
         if (generated_type_p && generated_type_p->m_class_scope == ClassScope_engine)
           {
           // Write just the meta file to ensure class exists
-          save_text_file(get_skookum_class_path(type_to_generate.m_type_p, type_to_generate.m_include_priority, type_to_generate.m_referenced_flags) / TEXT("!Class.sk-meta"), generated_type_p->m_sk_meta_file_body);
+          file_sets.Add({ generated_type_p, get_skookum_class_path(type_to_generate.m_type_p, type_to_generate.m_include_priority, type_to_generate.m_referenced_flags), get_script_file_set_hash(*generated_type_p, true), true });
           }
         }
       }
+
+    // Skip file sets that are unchanged since the last run
+    tScriptManifest new_manifest;
+    new_manifest.Reserve(file_sets.Num());
+    TArray<const ScriptFileSet *> changed_file_sets;
+    for (const ScriptFileSet & file_set : file_sets)
+      {
+      // Each class folder must only be written once as the writes run in parallel
+      if (new_manifest.Contains(file_set.m_class_path))
+        {
+        continue;
+        }
+      new_manifest.Add(file_set.m_class_path, file_set.m_hash);
+      const uint32 * old_hash_p = manifest.Find(file_set.m_class_path);
+      if (old_hash_p && *old_hash_p == file_set.m_hash && IFileManager::Get().FileExists(*(file_set.m_class_path / TEXT("!Class.sk-meta"))))
+        {
+        continue;
+        }
+      if (old_hash_p)
+        {
+        // Remove stale files, e.g. of methods that no longer exist
+        delete_script_file_set(file_set.m_class_path);
+        }
+      IFileManager::Get().MakeDirectory(*file_set.m_class_path, true);
+      changed_file_sets.Add(&file_set);
+      }
+
+    // Remove classes that are no longer generated - deepest first so their folders end up empty
+    TArray<FString> removed_class_paths;
+    for (const tScriptManifest::ElementType & entry : manifest)
+      {
+      if (!new_manifest.Contains(entry.Key))
+        {
+        removed_class_paths.Add(entry.Key);
+        }
+      }
+    removed_class_paths.Sort([](const FString & a, const FString & b) { return a.Len() > b.Len(); });
+    for (const FString & class_path : removed_class_paths)
+      {
+      delete_script_file_set(class_path);
+      IFileManager::Get().DeleteDirectory(*class_path, false, false);
+      }
+
+    UE_LOG(LogSkookumScriptGenerator, Log, TEXT("Writing %d of %d script classes (%d removed)"), changed_file_sets.Num(), file_sets.Num(), removed_class_paths.Num());
+
+    // Write changed file sets to disk - folders exist already so these are independent of each other
+    // Each file set collects its own failures so they can be reported from this thread
+    TArray<TArray<FString>> failed_paths;
+    failed_paths.SetNum(changed_file_sets.Num());
+    ParallelFor(changed_file_sets.Num(), [this, &changed_file_sets, &failed_paths](int32 i)
+      {
+      save_script_file_set(*changed_file_sets[i], &failed_paths[i]);
+      });
+
+    // A file set that was not written completely must not be remembered as up to date
+    for (int32 i = 0; i < changed_file_sets.Num(); ++i)
+      {
+      if (failed_paths[i].Num())
+        {
+        for (const FString & file_path : failed_paths[i])
+          {
+          report_error(FString::Printf(TEXT("Could not save file: %s"), *file_path));
+          }
+        new_manifest.Remove(changed_file_sets[i]->m_class_path);
+        }
+      }
+
+    // Remember what we wrote for the next run
+    FString manifest_text;
+    manifest_text.Reserve(new_manifest.Num() * 128);
+    for (const tScriptManifest::ElementType & entry : new_manifest)
+      {
+      manifest_text += FString::Printf(TEXT("%08x %s\n"), entry.Value, *entry.Key);
+      }
+    save_text_file(manifest_file_path, manifest_text);
     }
 
   return true;
   }
 
+//---------------------------------------------------------------------------------------
+// Write all loose script files of a generated type into its class folder
+// Returns: false if any file could not be written - its path is appended to out_failed_paths_p
+// Notes: Called from multiple threads at once - must only touch its own files and must
+//        not report errors itself
+bool FSkookumScriptGenerator::save_script_file_set(const ScriptFileSet & file_set, TArray<FString> * out_failed_paths_p)
+  {
+  const GeneratedType & generated_type = *file_set.m_generated_type_p;
+  bool success = true;
+
+  auto write_file = [this, out_failed_paths_p, &success](const FString & file_path, const FString & contents)
+    {
+    if (!write_text_file(file_path, contents))
+      {
+      out_failed_paths_p->Add(file_path);
+      success = false;
+      }
+    };
+
+  // Write meta file (even if empty)
+  write_file(file_set.m_class_path / TEXT("!Class.sk-meta"), generated_type.m_sk_meta_file_body);
+  if (file_set.m_meta_only)
+    {
+    return success;
+    }
+
+  // Write instance data if any
+  if (!generated_type.m_sk_instance_data_file_body.IsEmpty())
+    {
+    write_file(file_set.m_class_path / TEXT("!Data.sk"), generated_type.m_sk_instance_data_file_body);
+    }
+
+  // Write class data if any
+  if (!generated_type.m_sk_class_data_file_body.IsEmpty())
+    {
+    write_file(file_set.m_class_path / TEXT("!DataC.sk"), generated_type.m_sk_class_data_file_body);
+    }
+
+  // Write method definitions
+  for (tSkRoutines::TConstIterator iter(generated_type.m_sk_routines); iter; ++iter)
+    {
+    write_file(file_set.m_class_path / get_skookum_method_file_name(iter->m_name, iter->m_is_class_member), iter->m_body);
+    }
+
+  return success;
+  }
+
+//---------------------------------------------------------------------------------------
+// Load class paths and content hashes of the loose script files written by the last run
+// Returns: false if there is no usable manifest, i.e. everything must be regenerated
+bool FSkookumScriptGenerator::load_script_manifest(const FString & manifest_file_path, tScriptManifest * out_manifest_p)
+  {
+  FString manifest_text;
+  if (!load_text_file(manifest_file_path, manifest_text))
+    {
+    return false;
+    }
+
+  TArray<FString> lines;
+  manifest_text.ParseIntoArrayLines(lines);
+  out_manifest_p->Reserve(lines.Num());
+  for (const FString & line : lines)
+    {
+    // Each line is "<hash> <class path>"
+    if (line.Len() < 10 || line[8] != TEXT(' '))
+      {
+      out_manifest_p->Reset();
+      return false;
+      }
+    out_manifest_p->Add(line.Mid(9), FParse::HexNumber(*line.Left(8)));
+    }
+
+  return true;
+  }
+
+//---------------------------------------------------------------------------------------
+// Delete the script files in a class folder, leaving sub class folders alone
+void FSkookumScriptGenerator::delete_script_file_set(const FString & class_path)
+  {
+  TArray<FString> file_names;
+  IFileManager::Get().FindFiles(file_names, *(class_path / TEXT("*.sk*")), true, false);
+  for (const FString & file_name : file_names)
+    {
+    IFileManager::Get().Delete(*(class_path / file_name), false, true, true);
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Content hash of all script files save_script_file_set() writes for a type
+uint32 FSkookumScriptGenerator::get_script_file_set_hash(const GeneratedType & generated_type, bool meta_only)
+  {
+  uint32 hash = FCrc::StrCrc32(*generated_type.m_sk_meta_file_body);
+  if (meta_only)
+    {
+    return hash;
+    }
+
+  hash = FCrc::StrCrc32(*generated_type.m_sk_instance_data_file_body, hash);
+  hash = FCrc::StrCrc32(*generated_type.m_sk_class_data_file_body, hash);
+  for (const GeneratedRoutine & routine : generated_type.m_sk_routines)
+    {
+    hash = FCrc::StrCrc32(*routine.m_name, hash ^ uint32(routine.m_is_class_member));
+    hash = FCrc::StrCrc32(*routine.m_body, hash);
+    }
+
+  return hash;
+  }
+
 //---------------------------------------------------------------------------------------
 // Write two files, a .hpp and an .inl file that define SkUEEngineGeneratedBindings / SkUEProjectGeneratedBindings
 void FSkookumScriptGenerator::save_generated_cpp_files(eClassScope class_scope)
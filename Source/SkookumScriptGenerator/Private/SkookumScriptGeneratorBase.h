@@ -199,6 +199,7 @@ class FSkookumScriptGeneratorBase : public FSkookumScriptGeneratorHelper
     bool                  compute_scripts_path_depth(FString project_ini_file_path, const FString & overlay_name);
     bool                  load_text_file(const FString & file_path, FString & out_contents) const;
     bool                  save_text_file(const FString & file_path, const FString & contents) const;
+    bool                  write_text_file(const FString & file_path, const FString & contents) const; // Like save_text_file() but leaves reporting failure to the caller - safe to call from any thread
     bool                  save_text_file_if_changed(const FString & file_path, const FString & new_file_contents); // Helper to change a file only if needed
     void                  flush_saved_text_files(); // Puts generated files into place after all code generation is done
 
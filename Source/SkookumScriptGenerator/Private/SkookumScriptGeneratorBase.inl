@@ -716,6 +716,19 @@ bool FSkookumScriptGeneratorBase::load_text_file(const FString & file_path, FStr
 //---------------------------------------------------------------------------------------
 
 bool FSkookumScriptGeneratorBase::save_text_file(const FString & file_path, const FString & contents) const
+  {
+  if (!write_text_file(file_path, contents))
+    {
+    report_error(FString::Printf(TEXT("Could not save file: %s"), *file_path));
+    return false;
+    }
+
+  return true;
+  }
+
+//---------------------------------------------------------------------------------------
+
+bool FSkookumScriptGeneratorBase::write_text_file(const FString & file_path, const FString & contents) const
   {
   // On Windows, insert CRs before LFs
   #if PLATFORM_WINDOWS
@@ -724,13 +737,7 @@ bool FSkookumScriptGeneratorBase::save_text_file(const FString & file_path, cons
     const FString & platform_contents = contents;
   #endif
 
-  if (!FFileHelper::SaveStringToFile(platform_contents, *file_path, ms_script_file_encoding, &IFileManager::Get(), FILEWRITE_EvenIfReadOnly))
-    {
-    report_error(FString::Printf(TEXT("Could not save file: %s"), *file_path));
-    return false;
-    }
-
-  return true;
+  return FFileHelper::SaveStringToFile(platform_contents, *file_path, ms_script_file_encoding, &IFileManager::Get(), FILEWRITE_EvenIfReadOnly);
   }
 
 //---------------------------------------------------------------------------------------
@@ -15,7 +15,9 @@
 #include "SkUEName.hpp"
 #include "../SkUERuntime.hpp"
 #include "../SkUEUtils.hpp"
-#include "UObject/UObjectHash.h"
+#include "EngineUtils.h"
+#include "Engine/Engine.h"
+#include "Misc/CoreDelegates.h"
 #include <SkUEWorld.generated.hpp>
 
 #include <SkookumScript/SkList.hpp>
@@ -29,14 +31,13 @@ namespace SkUEActor_Impl
 
   //---------------------------------------------------------------------------------------
   // Get array of actors of the given class or a superclass
-  static UClass * get_actor_super_class_array(SkClass * sk_class_p, TArray<UObject*> * object_array_p, SkClass ** sk_superclass_pp)
+  static UClass * get_actor_super_class_array(SkClass * sk_class_p, TArray<AActor *> * actor_array_p, SkClass ** sk_superclass_pp)
     {
     UClass * ue_superclass_p;
     SkClass * sk_superclass_p = SkUEClassBindingHelper::find_most_derived_super_class_known_to_ue(sk_class_p, &ue_superclass_p);
     if (ue_superclass_p)
       {
-      object_array_p->Reserve(1024);
-      GetObjectsOfClass(ue_superclass_p, *object_array_p, true, RF_ClassDefaultObject);
+      SkUEActorIndex::get_actors(SkUEClassBindingHelper::get_world(), sk_superclass_p, actor_array_p);
       }
     *sk_superclass_pp = sk_superclass_p;
     return ue_superclass_p;
@@ -47,38 +48,38 @@ namespace SkUEActor_Impl
   // instance_pp returns a reffed SkInstance for the actor if one was found
   static AActor * find_named(const FName & name, SkInvokedMethod * scope_p, SkClass ** sk_class_pp, UClass ** ue_class_pp, SkInstance ** instance_pp)
     {
-    // Get actor array
-    TArray<UObject*> object_array;
-    SkClass * sk_super_class_p;
+    // Get actors of that name
+    SkUEActorIndex::tNamedArray named_array;
+    UClass * ue_class_p;
     SkClass * sk_class_p = ((SkMetaClass *)scope_p->get_topmost_scope())->get_class_info();
-    UClass * ue_class_p = get_actor_super_class_array(sk_class_p, &object_array, &sk_super_class_p);
+    SkClass * sk_super_class_p = SkUEClassBindingHelper::find_most_derived_super_class_known_to_ue(sk_class_p, &ue_class_p);
+    if (ue_class_p)
+      {
+      SkUEActorIndex::find_named(SkUEClassBindingHelper::get_world(), name, ue_class_p, &named_array);
+      }
 
     // Find our actor
-    UWorld * world_p = SkUEClassBindingHelper::get_world();
     AActor * actor_p = nullptr;
     SkInstance * instance_p = nullptr;
-    for (UObject ** RESTRICT obj_pp = object_array.GetData(), **RESTRICT end_pp = obj_pp + object_array.Num(); obj_pp != end_pp; ++obj_pp)
+    for (AActor * named_actor_p : named_array)
       {
-      if ((*obj_pp)->GetWorld() == world_p && (*obj_pp)->GetFName() == name)
+      actor_p = named_actor_p;
+      if (sk_super_class_p == sk_class_p)
+        {
+        break;
+        }
+      SkInstance * embedded_instance_p = SkUEClassBindingHelper::get_embedded_instance(actor_p, sk_super_class_p);
+      if (embedded_instance_p)
         {
-        actor_p = static_cast<AActor *>(*obj_pp);
-        if (sk_super_class_p == sk_class_p)
+        SkClass * instance_class_p = embedded_instance_p->get_class();
+        if (instance_class_p->is_class(*sk_class_p))
           {
+          sk_class_p = instance_class_p;
+          ue_class_p = actor_p->GetClass();
+          instance_p = embedded_instance_p;
+          instance_p->reference();
           break;
           }
-        SkInstance * embedded_instance_p = SkUEClassBindingHelper::get_embedded_instance(actor_p, sk_super_class_p);
-        if (embedded_instance_p)
-          {
-          SkClass * instance_class_p = embedded_instance_p->get_class();
-          if (instance_class_p->is_class(*sk_class_p))
-            {
-            sk_class_p = instance_class_p;
-            ue_class_p = actor_p->GetClass();
-            instance_p = embedded_instance_p;
-            instance_p->reference();
-            break;
-            }
-          }
         }
       }
 
@@ -184,40 +185,33 @@ namespace SkUEActor_Impl
     {
     if (result_pp) // Do nothing if result not desired
       {
-      // Get actor array
-      TArray<UObject*> object_array;
+      // Get actor array - only contains live actors of this world
+      TArray<AActor *> actor_array;
       SkClass * sk_super_class_p;
       SkClass * sk_class_p = ((SkMetaClass *)scope_p->get_topmost_scope())->get_class_info();
-      UClass * ue_class_p = get_actor_super_class_array(sk_class_p, &object_array, &sk_super_class_p);
+      UClass * ue_class_p = get_actor_super_class_array(sk_class_p, &actor_array, &sk_super_class_p);
 
       // Build SkList from it
-      UWorld * world_p = SkUEClassBindingHelper::get_world();
-      SkInstance * instance_p = SkList::new_instance(object_array.Num());
+      SkInstance * instance_p = SkList::new_instance(actor_array.Num());
       SkInstanceList & list = instance_p->as<SkList>();
       APArray<SkInstance> & instances = list.get_instances();
-      instances.ensure_size(object_array.Num());
-      for (UObject ** RESTRICT obj_pp = object_array.GetData(), **RESTRICT end_pp = obj_pp + object_array.Num(); obj_pp != end_pp; ++obj_pp)
+      instances.ensure_size(actor_array.Num());
+      for (AActor * actor_p : actor_array)
         {
-        // Must be in this world and not about to die
-        if ((*obj_pp)->GetWorld() == world_p && !(*obj_pp)->IsPendingKill())
+        // Check if the right class
+        SkInstance * embedded_instance_p = SkUEClassBindingHelper::get_embedded_instance(actor_p, sk_super_class_p);
+        if (embedded_instance_p)
           {
-          AActor * actor_p = static_cast<AActor *>(*obj_pp);
-
-          // Check if the right class
-          SkInstance * embedded_instance_p = SkUEClassBindingHelper::get_embedded_instance(actor_p, sk_super_class_p);
-          if (embedded_instance_p)
+          if (embedded_instance_p->get_class()->is_class(*sk_class_p))
             {
-            if (embedded_instance_p->get_class()->is_class(*sk_class_p))
-              {
-              embedded_instance_p->reference();
-              instances.append(*embedded_instance_p);
-              }
-            }
-          else if (sk_super_class_p == sk_class_p)
-            {
-            instances.append(*SkUEEntity::new_instance(actor_p, ue_class_p, sk_class_p));
+            embedded_instance_p->reference();
+            instances.append(*embedded_instance_p);
             }
           }
+        else if (sk_super_class_p == sk_class_p)
+          {
+          instances.append(*SkUEEntity::new_instance(actor_p, ue_class_p, sk_class_p));
+          }
         }
       *result_pp = instance_p;
       }
@@ -229,38 +223,31 @@ namespace SkUEActor_Impl
     {
     if (result_pp) // Do nothing if result not desired
       {
-      // Get actor array
-      TArray<UObject*> object_array;
+      // Get actor array - only contains live actors of this world
+      TArray<AActor *> actor_array;
       SkClass * sk_super_class_p;
       SkClass * sk_class_p = ((SkMetaClass *)scope_p->get_topmost_scope())->get_class_info();
-      UClass * ue_class_p = get_actor_super_class_array(sk_class_p, &object_array, &sk_super_class_p);
+      UClass * ue_class_p = get_actor_super_class_array(sk_class_p, &actor_array, &sk_super_class_p);
 
       // Return first one
-      UWorld * world_p = SkUEClassBindingHelper::get_world();
-      for (UObject ** RESTRICT obj_pp = object_array.GetData(), **RESTRICT end_pp = obj_pp + object_array.Num(); obj_pp != end_pp; ++obj_pp)
+      for (AActor * actor_p : actor_array)
         {
-        // Must be in this world and not about to die
-        if ((*obj_pp)->GetWorld() == world_p && !(*obj_pp)->IsPendingKill())
+        // Check if the right class
+        SkInstance * embedded_instance_p = SkUEClassBindingHelper::get_embedded_instance(actor_p, sk_super_class_p);
+        if (embedded_instance_p)
           {
-          AActor * actor_p = static_cast<AActor *>(*obj_pp);
-
-          // Check if the right class
-          SkInstance * embedded_instance_p = SkUEClassBindingHelper::get_embedded_instance(actor_p, sk_super_class_p);
-          if (embedded_instance_p)
+          if (embedded_instance_p->get_class()->is_class(*sk_class_p))
             {
-            if (embedded_instance_p->get_class()->is_class(*sk_class_p))
-              {
-              embedded_instance_p->reference();
-              *result_pp = embedded_instance_p;
-              return;
-              }
-            }
-          else if (sk_super_class_p == sk_class_p)
-            {
-            *result_pp = SkUEEntity::new_instance(actor_p, ue_class_p, sk_class_p);
+            embedded_instance_p->reference();
+            *result_pp = embedded_instance_p;
             return;
             }
           }
+        else if (sk_super_class_p == sk_class_p)
+          {
+          *result_pp = SkUEEntity::new_instance(actor_p, ue_class_p, sk_class_p);
+          return;
+          }
         }
 
       // None found
@@ -302,6 +289,315 @@ namespace SkUEActor_Impl
 
   } // SkUEActor_Impl
 
+//=======================================================================================
+// SkUEActorIndex
+//=======================================================================================
+
+TWeakObjectPtr<UWorld>                          SkUEActorIndex::ms_world;
+bool                                            SkUEActorIndex::ms_dirty = true;
+int32                                           SkUEActorIndex::ms_built_count = 0;
+TMultiMap<FName, TWeakObjectPtr<AActor>>        SkUEActorIndex::ms_actors_by_name;
+TMap<SkClass *, TSet<TWeakObjectPtr<AActor>>>   SkUEActorIndex::ms_actors_by_class;
+TMap<FName, uint64>                             SkUEActorIndex::ms_name_scan_frames;
+FDelegateHandle                                 SkUEActorIndex::ms_on_actor_spawned_handle;
+FDelegateHandle                                 SkUEActorIndex::ms_on_actor_destroyed_handle;
+FDelegateHandle                                 SkUEActorIndex::ms_on_level_added_handle;
+FDelegateHandle                                 SkUEActorIndex::ms_on_level_removed_handle;
+FDelegateHandle                                 SkUEActorIndex::ms_on_actor_renamed_handle;
+
+//---------------------------------------------------------------------------------------
+// Switch the index over to a different world (or none) - the index is rebuilt lazily
+void SkUEActorIndex::set_world(UWorld * world_p)
+  {
+  UWorld * prev_world_p = ms_world.Get();
+  if (world_p && world_p == prev_world_p)
+    {
+    return;
+    }
+
+  if (prev_world_p)
+    {
+    prev_world_p->RemoveOnActorSpawnedHandler(ms_on_actor_spawned_handle);
+    }
+  if (ms_on_level_added_handle.IsValid())
+    {
+    FWorldDelegates::LevelAddedToWorld.Remove(ms_on_level_added_handle);
+    FWorldDelegates::LevelRemovedFromWorld.Remove(ms_on_level_removed_handle);
+    ms_on_level_added_handle.Reset();
+    ms_on_level_removed_handle.Reset();
+    }
+  if (ms_on_actor_destroyed_handle.IsValid())
+    {
+    if (GEngine)
+      {
+      GEngine->OnLevelActorDeleted().Remove(ms_on_actor_destroyed_handle);
+      }
+    ms_on_actor_destroyed_handle.Reset();
+    }
+  #if WITH_EDITOR
+    if (ms_on_actor_renamed_handle.IsValid())
+      {
+      FCoreDelegates::OnActorLabelChanged.Remove(ms_on_actor_renamed_handle);
+      ms_on_actor_renamed_handle.Reset();
+      }
+  #endif
+
+  ms_world = world_p;
+  if (SkookumScript::get_initialization_level() >= SkookumScript::InitializationLevel_program)
+    {
+    SkUEActor::get_class()->object_id_generation_bump_all();
+    }
+  invalidate();
+
+  if (world_p)
+    {
+    ms_on_actor_spawned_handle = world_p->AddOnActorSpawnedHandler(FOnActorSpawned::FDelegate::CreateStatic(&SkUEActorIndex::on_actor_spawned));
+    ms_on_level_added_handle   = FWorldDelegates::LevelAddedToWorld.AddStatic(&SkUEActorIndex::on_level_changed);
+    ms_on_level_removed_handle = FWorldDelegates::LevelRemovedFromWorld.AddStatic(&SkUEActorIndex::on_level_changed);
+    if (GEngine)
+      {
+      ms_on_actor_destroyed_handle = GEngine->OnLevelActorDeleted().AddStatic(&SkUEActorIndex::on_actor_destroyed);
+      }
+    #if WITH_EDITOR
+      // Changing the label of an actor in the editor renames it as well
+      ms_on_actor_renamed_handle = FCoreDelegates::OnActorLabelChanged.AddStatic(&SkUEActorIndex::on_actor_renamed);
+    #endif
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Drop all entries so the index gets rebuilt on next use - e.g. after the SkookumScript
+// classes it is keyed by have been reloaded
+void SkUEActorIndex::invalidate()
+  {
+  ms_dirty = true;
+  ms_actors_by_name.Empty();
+  ms_actors_by_class.Empty();
+  ms_name_scan_frames.Empty();
+  }
+
+//---------------------------------------------------------------------------------------
+// Get all live actors of the given world named `name` that are of class ue_class_p
+void SkUEActorIndex::find_named(UWorld * world_p, const FName & name, UClass * ue_class_p, tNamedArray * actors_p)
+  {
+  ensure_built(world_p);
+
+  tNamedArray renamed_actors;
+  bool        is_indexed = false;
+
+  for (TMultiMap<FName, TWeakObjectPtr<AActor>>::TKeyIterator actor_it = ms_actors_by_name.CreateKeyIterator(name); actor_it; ++actor_it)
+    {
+    AActor * actor_p = actor_it.Value().Get();
+    if (!actor_p || actor_p->GetFName() != name)
+      {
+      // Destroyed or renamed without notification - a renamed actor is reindexed under
+      // its new name below
+      if (actor_p)
+        {
+        renamed_actors.Add(actor_p);
+        }
+      actor_it.RemoveCurrent();
+      continue;
+      }
+
+    is_indexed = true;
+    if (actor_p->IsA(ue_class_p))
+      {
+      actors_p->Add(actor_p);
+      }
+    }
+
+  for (AActor * actor_p : renamed_actors)
+    {
+    on_actor_renamed(actor_p);
+    }
+
+  // AActor::Rename() at runtime is not reported, so when nothing goes by this name look
+  // for it in the world - but only once per frame so polling for an absent name stays cheap
+  if (!is_indexed && world_p)
+    {
+    uint64 & scan_frame = ms_name_scan_frames.FindOrAdd(name);
+    if (scan_frame != GFrameCounter + 1u)
+      {
+      scan_frame = GFrameCounter + 1u;
+      for (FActorIterator actor_it(world_p); actor_it; ++actor_it)
+        {
+        AActor * actor_p = *actor_it;
+        if (actor_p->GetFName() == name)
+          {
+          ms_actors_by_name.Add(name, TWeakObjectPtr<AActor>(actor_p));
+          if (actor_p->IsA(ue_class_p))
+            {
+            actors_p->Add(actor_p);
+            }
+          }
+        }
+      }
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Get all live actors of the given world that are of class sk_class_p or a subclass -
+// sk_class_p must be known to UE so its subtree covers all actors of its UE class
+void SkUEActorIndex::get_actors(UWorld * world_p, SkClass * sk_class_p, TArray<AActor *> * actors_p)
+  {
+  ensure_built(world_p);
+  append_actors(sk_class_p, actors_p);
+  }
+
+//---------------------------------------------------------------------------------------
+// (Re)build the index from all actors of the world if it is out of date
+void SkUEActorIndex::ensure_built(UWorld * world_p)
+  {
+  // Script code may assign @@world directly
+  if (world_p != ms_world.Get())
+    {
+    set_world(world_p);
+    }
+
+  if (ms_dirty && world_p)
+    {
+    invalidate();
+    for (FActorIterator actor_it(world_p); actor_it; ++actor_it)
+      {
+      add_actor(*actor_it);
+      }
+    ms_built_count = ms_actors_by_name.Num();
+    ms_dirty = false;
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+
+void SkUEActorIndex::add_actor(AActor * actor_p)
+  {
+  TWeakObjectPtr<AActor> actor(actor_p);
+  ms_actors_by_name.Add(actor_p->GetFName(), actor);
+
+  SkClass * sk_class_p = SkUEClassBindingHelper::find_most_derived_super_class_known_to_sk(actor_p->GetClass());
+  if (sk_class_p)
+    {
+    ms_actors_by_class.FindOrAdd(sk_class_p).Add(actor);
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Append the live actors indexed under sk_class_p and its subclasses
+void SkUEActorIndex::append_actors(SkClass * sk_class_p, TArray<AActor *> * actors_p)
+  {
+  TSet<TWeakObjectPtr<AActor>> * class_actors_p = ms_actors_by_class.Find(sk_class_p);
+  if (class_actors_p)
+    {
+    actors_p->Reserve(actors_p->Num() + class_actors_p->Num());
+    for (TSet<TWeakObjectPtr<AActor>>::TIterator actor_it(*class_actors_p); actor_it; ++actor_it)
+      {
+      AActor * actor_p = actor_it->Get();
+      if (actor_p)
+        {
+        actors_p->Add(actor_p);
+        }
+      else
+        {
+        // Went away without being reported as destroyed
+        actor_it.RemoveCurrent();
+        }
+      }
+    }
+
+  for (SkClass * subclass_p : sk_class_p->get_subclasses())
+    {
+    append_actors(subclass_p, actors_p);
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+
+void SkUEActorIndex::on_actor_spawned(AActor * actor_p)
+  {
+  // Invalidate cached object IDs (@'Name') that might refer to this actor
+  SkClass * sk_class_p = SkUEClassBindingHelper::find_most_derived_super_class_known_to_sk(actor_p->GetClass());
+  if (sk_class_p)
+    {
+    sk_class_p->object_id_generation_bump();
+    }
+
+  if (!ms_dirty)
+    {
+    // Destroyed actors are removed as they are reported, but rebuild once the index has
+    // grown well past its last built size in case some went away unreported
+    if (ms_actors_by_name.Num() > 2 * ms_built_count + 256)
+      {
+      ms_dirty = true;
+      }
+    else
+      {
+      add_actor(actor_p);
+      }
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Remove actor_p from the index right away rather than leaving a stale entry behind
+void SkUEActorIndex::on_actor_destroyed(AActor * actor_p)
+  {
+  if (actor_p->GetWorld() != ms_world.Get())
+    {
+    return;
+    }
+
+  SkClass * sk_class_p = SkUEClassBindingHelper::find_most_derived_super_class_known_to_sk(actor_p->GetClass());
+  if (sk_class_p)
+    {
+    sk_class_p->object_id_generation_bump();
+    }
+
+  if (!ms_dirty)
+    {
+    TWeakObjectPtr<AActor> actor(actor_p);
+    ms_actors_by_name.RemoveSingle(actor_p->GetFName(), actor);
+
+    TSet<TWeakObjectPtr<AActor>> * class_actors_p = sk_class_p ? ms_actors_by_class.Find(sk_class_p) : nullptr;
+    if (class_actors_p)
+      {
+      class_actors_p->Remove(actor);
+      }
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Index actor_p under its current name right away so that Actor@named() and object IDs
+// (@'NewName') find it - the entry under its old name is weeded out when next looked up
+void SkUEActorIndex::on_actor_renamed(AActor * actor_p)
+  {
+  if (actor_p->GetWorld() != ms_world.Get())
+    {
+    return;
+    }
+
+  // Invalidate cached object IDs of both the old and the new name
+  SkClass * sk_class_p = SkUEClassBindingHelper::find_most_derived_super_class_known_to_sk(actor_p->GetClass());
+  if (sk_class_p)
+    {
+    sk_class_p->object_id_generation_bump();
+    }
+
+  if (!ms_dirty)
+    {
+    ms_actors_by_name.AddUnique(actor_p->GetFName(), TWeakObjectPtr<AActor>(actor_p));
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// A level was streamed in or out - its actors are not reported as spawned
+void SkUEActorIndex::on_level_changed(ULevel * level_p, UWorld * world_p)
+  {
+  if (world_p == ms_world.Get())
+    {
+    ms_dirty = true;
+    SkUEActor::get_class()->object_id_generation_bump_all();
+    }
+  }
+
 //---------------------------------------------------------------------------------------
 
 void SkUEActor_Ext::register_bindings()
@@ -26,3 +26,49 @@ class SkUEActor_Ext : public SkUEActor
     static void register_bindings();
   };
 
+
+//---------------------------------------------------------------------------------------
+// Index of the actors in the current world by name and by SkookumScript class so that
+// Actor@named(), Actor@instances() and object IDs (@'Name') need not scan all objects of
+// a class. Spawned, renamed (in the editor) and destroyed actors are (re)indexed as they
+// come and go, a name that is not found is looked for once per frame by scanning the
+// world (actors renamed at runtime are not reported) and streamed levels or reloaded
+// classes cause a full rebuild on next use.
+class SkUEActorIndex
+  {
+  public:
+
+    // Actor names are only unique per level, so a name may map to a few actors
+    typedef TArray<AActor *, TInlineAllocator<4>> tNamedArray;
+
+    static void     set_world(UWorld * world_p);
+    static void     invalidate();
+
+    static void     find_named(UWorld * world_p, const FName & name, UClass * ue_class_p, tNamedArray * actors_p);
+    static void     get_actors(UWorld * world_p, SkClass * sk_class_p, TArray<AActor *> * actors_p);
+
+  protected:
+
+    static void     ensure_built(UWorld * world_p);
+    static void     add_actor(AActor * actor_p);
+    static void     append_actors(SkClass * sk_class_p, TArray<AActor *> * actors_p);
+    static void     on_actor_spawned(AActor * actor_p);
+    static void     on_actor_destroyed(AActor * actor_p);
+    static void     on_actor_renamed(AActor * actor_p);
+    static void     on_level_changed(ULevel * level_p, UWorld * world_p);
+
+  // Class Data Members
+
+    static TWeakObjectPtr<UWorld>                         ms_world;
+    static bool                                           ms_dirty;
+    static int32                                          ms_built_count;
+    static TMultiMap<FName, TWeakObjectPtr<AActor>>       ms_actors_by_name;
+    static TMap<SkClass *, TSet<TWeakObjectPtr<AActor>>>  ms_actors_by_class;  // Keyed by the most derived Sk class of each actor
+    static TMap<FName, uint64>                            ms_name_scan_frames; // Frame a missing name was last scanned for
+    static FDelegateHandle                                ms_on_actor_spawned_handle;
+    static FDelegateHandle                                ms_on_actor_destroyed_handle;
+    static FDelegateHandle                                ms_on_level_added_handle;
+    static FDelegateHandle                                ms_on_level_removed_handle;
+    static FDelegateHandle                                ms_on_actor_renamed_handle;
+
+  };
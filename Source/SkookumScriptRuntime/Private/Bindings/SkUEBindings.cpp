@@ -81,6 +81,7 @@ void SkUEBindings::begin_register_bindings()
   SkBoolean::get_class()->register_raw_accessor_func(&SkUEClassBindingHelper::access_raw_data_boolean);
   SkInteger::get_class()->register_raw_accessor_func(&SkUEClassBindingHelper::access_raw_data_integer);
   SkReal::get_class()->register_raw_accessor_func(&SkUEClassBindingHelper::access_raw_data_struct<SkReal>);
+  SkReal::get_class()->register_raw_pod_size(sizeof(tSkReal));
   SkString::get_class()->register_raw_accessor_func(&SkUEClassBindingHelper::access_raw_data_string);
   SkEnum::get_class()->register_raw_accessor_func(&SkUEClassBindingHelper::access_raw_data_enum);
   SkList::get_class()->register_raw_accessor_func(&SkUEClassBindingHelper::access_raw_data_list);
@@ -123,3 +124,30 @@ void SkUEBindings::finish_register_bindings(SkUEBindingsInterface * project_gene
     project_generated_bindings_p->register_bindings();
     }
   }
+
+//---------------------------------------------------------------------------------------
+// Logs how many generated method bindings were never needed by any script - their
+// registration is deferred until the first call so these never cost anything.
+void SkUEBindings::report_unused_bindings()
+  {
+  #if !UE_BUILD_SHIPPING
+    uint32_t class_count   = 0u;
+    uint32_t pending_count = 0u;
+
+    SkClass ** classes_pp     = SkBrain::get_classes().get_array();
+    SkClass ** classes_end_pp = classes_pp + SkBrain::get_classes().get_length();
+
+    for (; classes_pp < classes_end_pp; classes_pp++)
+      {
+      uint32_t class_pending_count = (*classes_pp)->get_pending_method_func_count();
+
+      if (class_pending_count)
+        {
+        pending_count += class_pending_count;
+        class_count++;
+        }
+      }
+
+    UE_LOG(LogSkookum, Log, TEXT("%u generated method bindings on %u classes were never registered since no script called them."), pending_count, class_count);
+  #endif
+  }
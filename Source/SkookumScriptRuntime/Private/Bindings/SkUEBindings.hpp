@@ -21,6 +21,7 @@ class SkUEBindings
     static void ensure_static_ue_types_registered(SkUEBindingsInterface * game_generated_bindings_p);
     static void begin_register_bindings();
     static void finish_register_bindings(SkUEBindingsInterface * game_generated_bindings_p);
+    static void report_unused_bindings();
 
   }; // SkUEBindings
 
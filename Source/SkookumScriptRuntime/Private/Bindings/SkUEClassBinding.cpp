@@ -13,6 +13,7 @@
 #include "SkUEUtils.hpp"
 #include "SkookumScriptClassDataComponent.h"
 #include "SkookumScriptInstanceProperty.h"
+#include "Engine/SkUEActor.hpp"
 #include "Engine/SkUEEntity.hpp"
 #include "VectorMath/SkColor.hpp"
 #include <SkUEWorld.generated.hpp>
@@ -84,6 +85,8 @@ void SkUEClassBindingHelper::set_world(UWorld * world_p)
     {
     SkBrain::ms_object_class_p->set_class_data_value_by_idx_no_ref(get_world_data_idx(), world_p ? SkUEWorld::new_instance(world_p) : SkBrain::ms_nil_p);
     }
+
+  SkUEActorIndex::set_world(world_p);
   }
 
 //---------------------------------------------------------------------------------------
@@ -334,6 +337,7 @@ bool SkUEClassBindingHelper::resolve_raw_data_funcs(SkClass * sk_class_p, UStruc
       ? static_cast<tSkRawPointerFunc>(&SkInstance::get_raw_pointer_val) 
       : static_cast<tSkRawPointerFunc>(&SkInstance::get_raw_pointer_ref));
     sk_class_p->register_raw_accessor_func(&SkUEClassBindingHelper::access_raw_data_user_struct);
+    sk_class_p->register_payload_size(ue_struct_or_class_p->PropertiesSize);
     }
   else if ((sk_class_p->get_annotation_flags() & SkAnnotation_reflected_data) && sk_class_p->is_class(ASymbolId_UStruct))
     {
@@ -115,6 +115,15 @@ SkUEReflectionManager::ReflectedAccessors const SkUEReflectionManager::ms_access
 SkUEReflectionManager::ReflectedAccessors const SkUEReflectionManager::ms_accessors_array           = { &fetch_k2_param_array          , nullptr                        , &assign_k2_value_array          , &store_sk_value_array           };
 SkUEReflectionManager::ReflectedAccessors const SkUEReflectionManager::ms_accessors_name            = { &fetch_k2_param_name           , &fetch_k2_value_name           , &assign_k2_value_name          ,  &store_sk_value_name            };
 
+SkUEReflectionManager::tK2ParamsFetcher const SkUEReflectionManager::ms_k2_params_thunks[K2ParamsThunk_max_params + 1] =
+  {
+  &fetch_k2_params_thunk<0>,
+  &fetch_k2_params_thunk<1>,
+  &fetch_k2_params_thunk<2>,
+  &fetch_k2_params_thunk<3>,
+  &fetch_k2_params_thunk<4>,
+  };
+
 UScriptStruct * SkUEReflectionManager::ms_struct_vector2_p;
 UScriptStruct * SkUEReflectionManager::ms_struct_vector3_p;
 UScriptStruct * SkUEReflectionManager::ms_struct_vector4_p;
@@ -159,6 +168,9 @@ SkUEReflectionManager::~SkUEReflectionManager()
 
 void SkUEReflectionManager::clear(tSkUEOnFunctionRemovedFromClassFunc * on_function_removed_from_class_f)
   {
+  // Queued calls refer to reflected functions by index
+  discard_batched_calls();
+
   // Destroy all UFunctions and UProperties we allocated
   for (uint32_t i = 0; i < m_reflected_functions.get_length(); ++i)
     {
@@ -196,6 +208,12 @@ bool SkUEReflectionManager::sync_all_from_sk(tSkUEOnFunctionRemovedFromClassFunc
     if (reflected_function_p)
       {
       reflected_function_p->m_marked_for_delete_all = true;
+
+      // Cached argument instances belong to the previously loaded classes
+      if (reflected_function_p->m_type == ReflectedFunctionType_call)
+        {
+        static_cast<ReflectedCall *>(reflected_function_p)->release_arg_caches();
+        }
       }
     }
 
@@ -632,6 +650,7 @@ bool SkUEReflectionManager::expose_reflected_function(uint32_t function_index, t
             ReflectedCall * reflected_call_p = static_cast<ReflectedCall *>(reflected_function_p);
 
             // Initialize parameters
+            bool is_thunkable = reflected_function_p->m_num_params <= K2ParamsThunk_max_params;
             for (uint32_t i = 0; i < reflected_function_p->m_num_params; ++i)
               {
               const ReflectedProperty & param_info = param_info_array_p[i];
@@ -639,13 +658,26 @@ bool SkUEReflectionManager::expose_reflected_function(uint32_t function_index, t
               param_entry.set_byte_size(param_info.m_ue_property_p);
               param_entry.m_outer_fetcher_p = param_info.m_outer_p->m_k2_param_fetcher_p;
               param_entry.m_inner_fetcher_p = param_info.m_inner_p ? param_info.m_inner_p->m_k2_value_fetcher_p : nullptr;
+              param_entry.m_kind = param_info.m_inner_p ? K2ParamKind_generic : get_k2_param_kind(param_info.m_outer_p);
+              is_thunkable &= (param_entry.m_kind != K2ParamKind_generic);
               }
 
+            // Pick precompiled parameter thunk if all parameters are of a type it can fetch inline
+            reflected_call_p->m_params_fetcher_p = is_thunkable
+              ? ms_k2_params_thunks[reflected_function_p->m_num_params]
+              : &fetch_k2_params_generic;
+
             // And return parameter
             const ReflectedProperty & return_info = param_info_array_p[reflected_function_p->m_num_params];
             reflected_call_p->m_result.set_byte_size(return_info.m_ue_property_p);
             reflected_call_p->m_result.m_outer_storer_p = return_info.m_outer_p ? return_info.m_outer_p->m_sk_value_storer_p : nullptr;
             reflected_call_p->m_result.m_inner_storer_p = return_info.m_inner_p ? return_info.m_inner_p->m_sk_value_storer_p : nullptr;
+
+            // Calls can only be deferred if nothing has to be passed back to the caller
+            reflected_call_p->m_is_batched = (reflected_function_p->m_sk_invokable_p->get_annotation_flags() & SkAnnotation_ue4_batched)
+              && reflected_function_p->m_sk_invokable_p->get_invoke_type() == SkInvokable_method
+              && !reflected_call_p->m_result.m_outer_storer_p
+              && !reflected_function_p->m_has_out_params;
             }
           else
             {
@@ -850,39 +882,15 @@ void SkUEReflectionManager::exec_sk_method(UObject* context_p, FFrame & stack, v
   SK_ASSERTX(reflected_call.m_type == ReflectedFunctionType_call, "ReflectedFunction has bad type!");
   SK_ASSERTX(reflected_call.m_sk_invokable_p->get_invoke_type() == SkInvokable_method, "Must be a method at this point.");
 
-  SkMethodBase * method_p = static_cast<SkMethodBase *>(reflected_call.m_sk_invokable_p);
-  if (method_p->get_scope() != class_scope_p)
-    {
-    method_p = static_cast<SkMethodBase *>(class_scope_p->get_invokable_from_vtable(this_p ? SkScope_instance : SkScope_class, method_p->get_vtable_index()));
-    #if SKOOKUM & SK_DEBUG
-      // If not found, might be due to recent live update and the vtable not being updated yet - try finding it by name
-      if (!method_p || method_p->get_name() != reflected_call.get_name())
-        {
-        method_p = this_p
-          ? class_scope_p->find_instance_method_inherited(reflected_call.get_name())
-          : class_scope_p->find_class_method_inherited(reflected_call.get_name());
-        }
-      // If still not found, that means the method placed in the graph is not in a parent class of class_scope_p
-      if (!method_p)
-        {
-        // Just revert to original method and then, after processing the arguments on the stack, assert below
-        method_p = static_cast<SkMethodBase *>(reflected_call.m_sk_invokable_p);
-        }
-    #endif
-    }
+  SkMethodBase * method_p = find_sk_method(reflected_call, class_scope_p, this_p);
   SkInvokedMethod imethod(nullptr, this_p ? this_p : &class_scope_p->get_metaclass(), method_p, a_stack_allocate(method_p->get_invoked_data_array_size(), SkInstance*));
 
   SKDEBUG_ICALL_SET_INTERNAL(&imethod);
   SKDEBUG_HOOK_SCRIPT_ENTRY(reflected_call.get_name());
 
   // Fill invoked method's argument list
-  const ReflectedCallParam * call_params_p = reflected_call.get_param_array();
   SK_ASSERTX(imethod.get_data().get_size() >= reflected_call.m_num_params, a_str_format("Not enough space (%d) for %d arguments while invoking '%s@%s'!", imethod.get_data().get_size(), reflected_call.m_num_params, reflected_call.m_sk_invokable_p->get_scope()->get_name_cstr_dbg(), reflected_call.get_name_cstr_dbg()));
-  for (uint32_t i = 0; i < reflected_call.m_num_params; ++i)
-    {
-    const ReflectedCallParam & call_param = call_params_p[i];
-    imethod.data_append_arg((*call_param.m_outer_fetcher_p)(stack, call_param));
-    }
+  (*reflected_call.m_params_fetcher_p)(stack, reflected_call, &imethod);
 
   // Done with stack - now increment the code ptr unless it is null
   stack.Code += !!stack.Code;
@@ -894,6 +902,12 @@ void SkUEReflectionManager::exec_sk_method(UObject* context_p, FFrame & stack, v
       }
     else
   #endif
+    if (reflected_call.m_is_batched)
+      {
+      // Nothing to pass back so just remember the call until the next flush
+      ms_singleton_p->batch_sk_method(context_p, stack.CurrentNativeFunction->RPCId, class_scope_p, this_p ? this_p : &class_scope_p->get_metaclass(), &imethod);
+      }
+    else
       {
       // Call method
       SkInstance * result_instance_p = SkBrain::ms_nil_p;
@@ -909,6 +923,190 @@ void SkUEReflectionManager::exec_sk_method(UObject* context_p, FFrame & stack, v
   SKDEBUG_HOOK_SCRIPT_EXIT();
   }
 
+//---------------------------------------------------------------------------------------
+// Finds the override of a reflected call's method that applies to class_scope_p
+SkMethodBase * SkUEReflectionManager::find_sk_method(const ReflectedCall & reflected_call, SkClass * class_scope_p, SkInstance * this_p)
+  {
+  SkMethodBase * method_p = static_cast<SkMethodBase *>(reflected_call.m_sk_invokable_p);
+  if (method_p->get_scope() != class_scope_p)
+    {
+    method_p = static_cast<SkMethodBase *>(class_scope_p->get_invokable_from_vtable(this_p ? SkScope_instance : SkScope_class, method_p->get_vtable_index()));
+    #if SKOOKUM & SK_DEBUG
+      // If not found, might be due to recent live update and the vtable not being updated yet - try finding it by name
+      if (!method_p || method_p->get_name() != reflected_call.get_name())
+        {
+        method_p = this_p
+          ? class_scope_p->find_instance_method_inherited(reflected_call.get_name())
+          : class_scope_p->find_class_method_inherited(reflected_call.get_name());
+        }
+      // If still not found, that means the method placed in the graph is not in a parent class of class_scope_p
+      if (!method_p)
+        {
+        // Just revert to original method and then, after processing the arguments on the stack, the caller asserts
+        method_p = static_cast<SkMethodBase *>(reflected_call.m_sk_invokable_p);
+        }
+    #endif
+    }
+
+  return method_p;
+  }
+
+//---------------------------------------------------------------------------------------
+// Queues a call to a &batched method instead of invoking it - the arguments already
+// fetched into imethod_p are kept referenced by the queue.
+// Calls are grouped per receiver so flush_batched_calls() runs all calls to one
+// receiver back to back, in the order they were made.
+void SkUEReflectionManager::batch_sk_method(UObject * context_p, uint32_t function_index, SkClass * class_scope_p, SkInstance * receiver_p, SkInvokedMethod * imethod_p)
+  {
+  // Instance receivers are wrapped anew on each call so key them by their UObject
+  bool         is_instance  = (receiver_p != &class_scope_p->get_metaclass());
+  const void * receiver_key = is_instance ? static_cast<const void *>(context_p) : static_cast<const void *>(class_scope_p);
+
+  int32_t * receiver_idx_p = m_batched_receiver_map.Find(receiver_key);
+  if (receiver_idx_p && is_instance && !m_batched_receivers[*receiver_idx_p].m_context_p.IsValid())
+    {
+    // Object died and its address got recycled since - start a new receiver
+    receiver_idx_p = nullptr;
+    }
+  if (!receiver_idx_p)
+    {
+    receiver_p->reference();
+    receiver_idx_p = &m_batched_receiver_map.Add(receiver_key, m_batched_receivers.Add({ receiver_p, class_scope_p, is_instance ? context_p : nullptr, -1, -1 }));
+    }
+
+  // Keep the arguments alive - the invoked method will release its own references
+  uint32_t num_args = imethod_p->get_data().get_length();
+  int32_t first_arg_idx = m_batched_args.Num();
+  for (uint32_t i = 0; i < num_args; ++i)
+    {
+    SkInstance * arg_p = imethod_p->get_arg(i);
+    arg_p->reference();
+    m_batched_args.Add(arg_p);
+    }
+
+  // Link into the receiver's list of calls
+  int32_t call_idx = m_batched_calls.Add({ function_index, uint32_t(first_arg_idx), num_args, -1 });
+  BatchedReceiver & receiver = m_batched_receivers[*receiver_idx_p];
+  if (receiver.m_last_call_idx >= 0)
+    {
+    m_batched_calls[receiver.m_last_call_idx].m_next_call_idx = call_idx;
+    }
+  else
+    {
+    receiver.m_first_call_idx = call_idx;
+    }
+  receiver.m_last_call_idx = call_idx;
+  }
+
+//---------------------------------------------------------------------------------------
+// Invokes all calls queued by batch_sk_method() - one receiver at a time.
+// Called once per frame by SkUERuntime::tick() before the coroutines get updated.
+void SkUEReflectionManager::flush_batched_calls()
+  {
+  if (m_batched_receivers.Num() == 0)
+    {
+    return;
+    }
+
+  // Take over the queue so calls batched by the invoked methods wait for the next flush
+  TArray<BatchedReceiver> receivers(MoveTemp(m_batched_receivers));
+  TArray<BatchedCall>     calls(MoveTemp(m_batched_calls));
+  TArray<SkInstance *>    args(MoveTemp(m_batched_args));
+  m_batched_receiver_map.Reset();
+
+  for (const BatchedReceiver & receiver : receivers)
+    {
+    bool is_instance = (receiver.m_receiver_p != &receiver.m_class_scope_p->get_metaclass());
+
+    for (int32_t call_idx = receiver.m_first_call_idx; call_idx >= 0; call_idx = calls[call_idx].m_next_call_idx)
+      {
+      const BatchedCall & call    = calls[call_idx];
+      SkInstance **       args_pp = args.GetData() + call.m_first_arg_idx;
+
+      // The object might have been destroyed since the call was batched - or by an
+      // earlier call in this flush - so just drop the call and its arguments
+      if (is_instance && !receiver.m_context_p.IsValid())
+        {
+        for (uint32_t i = 0; i < call.m_num_args; ++i)
+          {
+          args_pp[i]->dereference();
+          }
+        continue;
+        }
+
+      invoke_batched_call(receiver, call, args_pp);
+      }
+    receiver.m_receiver_p->dereference();
+    }
+
+  // Hand the storage back for reuse unless new calls came in meanwhile
+  if (m_batched_receivers.Num() == 0)
+    {
+    receivers.Reset();
+    calls.Reset();
+    args.Reset();
+    m_batched_receivers = MoveTemp(receivers);
+    m_batched_calls     = MoveTemp(calls);
+    m_batched_args      = MoveTemp(args);
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Drops all queued calls without invoking them
+void SkUEReflectionManager::discard_batched_calls()
+  {
+  for (SkInstance * arg_p : m_batched_args)
+    {
+    arg_p->dereference();
+    }
+  for (const BatchedReceiver & receiver : m_batched_receivers)
+    {
+    receiver.m_receiver_p->dereference();
+    }
+
+  m_batched_receivers.Reset();
+  m_batched_calls.Reset();
+  m_batched_args.Reset();
+  m_batched_receiver_map.Reset();
+  }
+
+//---------------------------------------------------------------------------------------
+// Invokes a single queued call - passes ownership of its arguments to the invoked method
+// Notes: Separate function so the invoked data array is released from the stack after each call
+void SkUEReflectionManager::invoke_batched_call(const BatchedReceiver & receiver, const BatchedCall & call, SkInstance ** args_pp)
+  {
+  // The reflected call might have been changed or removed by a live update since the call was batched
+  ReflectedFunction * reflected_function_p = call.m_function_index < m_reflected_functions.get_length() ? m_reflected_functions[call.m_function_index] : nullptr;
+  if (!reflected_function_p
+    || reflected_function_p->m_type != ReflectedFunctionType_call
+    || !static_cast<ReflectedCall *>(reflected_function_p)->m_is_batched
+    || reflected_function_p->m_num_params != call.m_num_args)
+    {
+    for (uint32_t i = 0; i < call.m_num_args; ++i)
+      {
+      args_pp[i]->dereference();
+      }
+    return;
+    }
+
+  const ReflectedCall & reflected_call = *static_cast<ReflectedCall *>(reflected_function_p);
+  SkInstance * this_p = (receiver.m_receiver_p != &receiver.m_class_scope_p->get_metaclass()) ? receiver.m_receiver_p : nullptr;
+  SkMethodBase * method_p = find_sk_method(reflected_call, receiver.m_class_scope_p, this_p);
+  SkInvokedMethod imethod(nullptr, receiver.m_receiver_p, method_p, a_stack_allocate(method_p->get_invoked_data_array_size(), SkInstance*));
+
+  SKDEBUG_ICALL_SET_INTERNAL(&imethod);
+  SKDEBUG_HOOK_SCRIPT_ENTRY(reflected_call.get_name());
+
+  for (uint32_t i = 0; i < call.m_num_args; ++i)
+    {
+    imethod.data_append_arg(args_pp[i]);
+    }
+
+  static_cast<SkMethod *>(method_p)->SkMethod::invoke(&imethod); // We know it's a method so call directly
+
+  SKDEBUG_HOOK_SCRIPT_EXIT();
+  }
+
 //---------------------------------------------------------------------------------------
 
 void SkUEReflectionManager::exec_sk_class_method(UObject* context_p, FFrame & stack, void * const result_p)
@@ -971,13 +1169,8 @@ void SkUEReflectionManager::exec_sk_coroutine(UObject* context_p, FFrame & stack
   SKDEBUG_ICALL_SET_EXPR(icoroutine_p, call_expr_p);
 
   // Fill invoked coroutine's argument list
-  const ReflectedCallParam * param_entry_array = reflected_call.get_param_array();
   icoroutine_p->data_ensure_size(reflected_call.m_num_params);
-  for (uint32_t i = 0; i < reflected_call.m_num_params; ++i)
-    {
-    const ReflectedCallParam & call_param = param_entry_array[i];
-    icoroutine_p->data_append_arg((*call_param.m_outer_fetcher_p)(stack, call_param));
-    }
+  (*reflected_call.m_params_fetcher_p)(stack, reflected_call, icoroutine_p);
 
   // Done with stack - now increment the code ptr unless it is null
   stack.Code += !!stack.Code;
@@ -1294,6 +1487,11 @@ void SkUEReflectionManager::delete_reflected_function(uint32_t function_index)
       ue_function_p->MarkPendingKill();
       }
 
+    if (reflected_function_p->m_type == ReflectedFunctionType_call)
+      {
+      static_cast<ReflectedCall *>(reflected_function_p)->release_arg_caches();
+      }
+
     FMemory::Free(reflected_function_p);
     m_reflected_functions[function_index] = nullptr;
     }
@@ -1805,6 +2003,79 @@ void SkUEReflectionManager::on_unknown_type(const ASymbol & sk_name, SkClassDesc
   #endif
   }
 
+//---------------------------------------------------------------------------------------
+// Fetch all parameters of a reflected call from the stack using their per-type fetchers
+void SkUEReflectionManager::fetch_k2_params_generic(FFrame & stack, const ReflectedCall & reflected_call, SkInvokedContextBase * icontext_p)
+  {
+  const ReflectedCallParam * call_params_p = reflected_call.get_param_array();
+  for (uint32_t i = 0; i < reflected_call.m_num_params; ++i)
+    {
+    const ReflectedCallParam & call_param = call_params_p[i];
+    icontext_p->data_append_arg((*call_param.m_outer_fetcher_p)(stack, call_param));
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Precompiled parameter thunk for calls with a fixed number of parameters that are all
+// of a type fetch_k2_param_inline() handles - the loop gets unrolled and each fetch is a
+// switch to a direct call rather than an indirect call through the parameter's accessor.
+template<uint32_t _NumParams>
+void SkUEReflectionManager::fetch_k2_params_thunk(FFrame & stack, const ReflectedCall & reflected_call, SkInvokedContextBase * icontext_p)
+  {
+  const ReflectedCallParam * call_params_p = reflected_call.get_param_array();
+  for (uint32_t i = 0; i < _NumParams; ++i)
+    {
+    icontext_p->data_append_arg(fetch_k2_param_inline(stack, call_params_p[i]));
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+
+A_FORCEINLINE SkInstance * SkUEReflectionManager::fetch_k2_param_inline(FFrame & stack, const ReflectedCallParam & call_param)
+  {
+  // Sk routines take their arguments as instances so values still get boxed - but rather
+  // than allocating a fresh instance per call, Real and Vector3 arguments reuse the one
+  // cached on the parameter entry once the previous call has let go of it. Boolean and
+  // small Integer values already come from shared caches and entities are usually the
+  // instance embedded in the object.
+  switch (call_param.m_kind)
+    {
+    case K2ParamKind_boolean: return fetch_k2_param_boolean(stack, call_param);
+    case K2ParamKind_integer: return fetch_k2_param_integer(stack, call_param);
+    case K2ParamKind_entity:  return fetch_k2_param_entity(stack, call_param);
+
+    case K2ParamKind_real:
+      {
+      FFloatProperty::TCppType value = FFloatProperty::GetDefaultPropertyValue();
+      stack.StepCompiledIn<FFloatProperty>(&value);
+      return call_param.m_arg_cache.new_instance<SkReal>(value);
+      }
+
+    case K2ParamKind_vector3:
+      {
+      FVector value(ForceInitToZero);
+      stack.StepCompiledIn<FStructProperty>(&value);
+      return call_param.m_arg_cache.new_instance<SkVector3>(value);
+      }
+
+    default:
+      return (*call_param.m_outer_fetcher_p)(stack, call_param);
+    }
+  }
+
+//---------------------------------------------------------------------------------------
+// Determine which parameter kind a precompiled parameter thunk can use for the given type
+SkUEReflectionManager::eK2ParamKind SkUEReflectionManager::get_k2_param_kind(const ReflectedAccessors * accessors_p)
+  {
+  if (accessors_p == &ms_accessors_boolean) return K2ParamKind_boolean;
+  if (accessors_p == &ms_accessors_integer) return K2ParamKind_integer;
+  if (accessors_p == &ms_accessors_real)    return K2ParamKind_real;
+  if (accessors_p == &ms_accessors_vector3) return K2ParamKind_vector3;
+  if (accessors_p == &ms_accessors_entity)  return K2ParamKind_entity;
+
+  return K2ParamKind_generic;
+  }
+
 //---------------------------------------------------------------------------------------
 
 SkInstance * SkUEReflectionManager::fetch_k2_param_boolean(FFrame & stack, const ReflectedCallParam & value_type)
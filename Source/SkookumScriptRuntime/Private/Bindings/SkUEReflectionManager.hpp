@@ -28,6 +28,7 @@
 class SkClass;
 class SkClassDescBase;
 class SkInstance;
+class SkInvokedContextBase;
 class SkInvokedMethod;
 struct FFrame;
 
@@ -58,6 +59,9 @@ class SkUEReflectionManager
     static bool  is_skookum_reflected_call(UFunction * function_p);
     static bool  is_skookum_reflected_event(UFunction * function_p);
 
+    void         flush_batched_calls();
+    void         discard_batched_calls();
+
     void         invoke_k2_delegate(const FScriptDelegate & script_delegate, const SkParameters * sk_params_p, SkInvokedMethod * scope_p, SkInstance ** result_pp);
     void         invoke_k2_delegate(const FMulticastScriptDelegate & script_delegate, const SkParameters * sk_params_p, SkInvokedMethod * scope_p, SkInstance ** result_pp);
 
@@ -88,6 +92,7 @@ class SkUEReflectionManager
       };
 
     struct ReflectedCallParam;
+    struct ReflectedCall;
     struct ReflectedParamStorer;
     struct ReflectedEventParam;
 
@@ -95,6 +100,21 @@ class SkUEReflectionManager
     typedef SkInstance *  (*tK2ValueFetcher)(const void * value_p, const TypedName & value_type);
     typedef void          (*tK2ValueAssigner)(SkInstance * dest_p, const void * value_p, const ReflectedEventParam & value_type);
     typedef uint32_t      (*tSkValueStorer)(void * dest_p, SkInstance * value_p, const ReflectedParamStorer & value_type);
+    typedef void          (*tK2ParamsFetcher)(FFrame & stack, const ReflectedCall & reflected_call, SkInvokedContextBase * icontext_p);
+
+    // Parameter types that precompiled parameter thunks fetch inline
+    enum eK2ParamKind : uint8_t
+      {
+      K2ParamKind_generic,  // Anything else - fetched via ReflectedCallParam::m_outer_fetcher_p
+      K2ParamKind_boolean,
+      K2ParamKind_integer,
+      K2ParamKind_real,
+      K2ParamKind_vector3,
+      K2ParamKind_entity,
+      };
+
+    // Max number of parameters handled by a precompiled parameter thunk
+    enum { K2ParamsThunk_max_params = 4 };
 
     enum eReflectedFunctionType : uint8_t
       {
@@ -139,10 +159,12 @@ class SkUEReflectionManager
     // Parameter being passed into Sk from Blueprints
     struct ReflectedCallParam : TypedName
       {
-      tK2ParamFetcher m_outer_fetcher_p;  // Fetches the parameter from the stack
-      tK2ValueFetcher m_inner_fetcher_p;  // Fetches an item from a container parameter
+      tK2ParamFetcher         m_outer_fetcher_p;  // Fetches the parameter from the stack
+      tK2ValueFetcher         m_inner_fetcher_p;  // Fetches an item from a container parameter
+      eK2ParamKind            m_kind;             // Lets precompiled parameter thunks fetch common types inline
+      mutable SkInstanceCache m_arg_cache;        // Argument instance reused by precompiled parameter thunks - see fetch_k2_param_inline()
 
-      ReflectedCallParam(const ASymbol & name, SkClassDescBase * sk_type_p) : TypedName(name, sk_type_p), m_outer_fetcher_p(nullptr), m_inner_fetcher_p(nullptr) {}
+      ReflectedCallParam(const ASymbol & name, SkClassDescBase * sk_type_p) : TypedName(name, sk_type_p), m_outer_fetcher_p(nullptr), m_inner_fetcher_p(nullptr), m_kind(K2ParamKind_generic) {}
       };
 
     // Parameter being passed into Sk from Blueprints
@@ -158,15 +180,29 @@ class SkUEReflectionManager
     struct ReflectedCall : public ReflectedFunction
       {
       ReflectedParamStorer  m_result;
+      tK2ParamsFetcher      m_params_fetcher_p; // Fetches all parameters from the stack - picked in expose_reflected_function()
+      bool                  m_is_batched;       // &batched method without result or out parameters - calls are deferred to flush_batched_calls()
 
       ReflectedCall(SkInvokableBase * sk_invokable_p, uint32_t num_params, SkClassDescBase * sk_result_type_p)
         : ReflectedFunction(ReflectedFunctionType_call, sk_invokable_p, num_params)
         , m_result(ASymbol::ms_null, sk_result_type_p)
+        , m_params_fetcher_p(&SkUEReflectionManager::fetch_k2_params_generic)
+        , m_is_batched(false) // Yet unknown
         {}
 
       // The parameter entries are stored behind this structure in memory
       ReflectedCallParam *       get_param_array()       { return (ReflectedCallParam *)(this + 1); }
       const ReflectedCallParam * get_param_array() const { return (const ReflectedCallParam *)(this + 1); }
+
+      // Let go of the argument instances cached by the parameter entries
+      void release_arg_caches()
+        {
+        ReflectedCallParam * call_params_p = get_param_array();
+        for (uint32_t i = 0; i < m_num_params; ++i)
+          {
+          call_params_p[i].m_arg_cache.release();
+          }
+        }
       };
 
     // Parameter being passed into Blueprints into Sk
@@ -264,10 +300,32 @@ class SkUEReflectionManager
 
     typedef APSortedLogicalFree<ReflectedClass, ASymbol> tReflectedClasses;
 
+    // A call from Blueprints into a &batched Sk method waiting for flush_batched_calls()
+    struct BatchedCall
+      {
+      uint32_t  m_function_index; // Index of the ReflectedCall - re-validated on flush in case it was live updated meanwhile
+      uint32_t  m_first_arg_idx;  // Arguments are stored in m_batched_args
+      uint32_t  m_num_args;
+      int32_t   m_next_call_idx;  // Next call to the same receiver or -1
+      };
+
+    // All batched calls to one receiver, linked in the order they were made
+    struct BatchedReceiver
+      {
+      SkInstance *            m_receiver_p;     // Referenced while queued
+      SkClass *               m_class_scope_p;
+      TWeakObjectPtr<UObject> m_context_p;      // Object the calls came from - to detect recycled addresses
+      int32_t                 m_first_call_idx;
+      int32_t                 m_last_call_idx;
+      };
+
     static void         exec_sk_method(UObject * context_p, FFrame & stack, void * const result_p, SkClass * class_scope_p, SkInstance * this_p);
     static void         exec_sk_class_method(UObject * context_p, FFrame & stack, void * const result_p);
     static void         exec_sk_instance_method(UObject * context_p, FFrame & stack, void * const result_p);
     static void         exec_sk_coroutine(UObject * context_p, FFrame & stack, void * const result_p);
+    static SkMethodBase * find_sk_method(const ReflectedCall & reflected_call, SkClass * class_scope_p, SkInstance * this_p);
+    void                batch_sk_method(UObject * context_p, uint32_t function_index, SkClass * class_scope_p, SkInstance * receiver_p, SkInvokedMethod * imethod_p);
+    void                invoke_batched_call(const BatchedReceiver & receiver, const BatchedCall & call, SkInstance ** args_pp);
 
     template<typename _EventType, typename _LambdaType>
     static void         invoke_k2_event(_EventType * reflected_event_p, SkInvokedMethod * scope_p, SkInstance ** result_pp, _LambdaType && invoker);
@@ -303,6 +361,12 @@ class SkUEReflectionManager
     template<class _TypedName>
     static void         rebind_params_to_sk(const tSkParamList & param_list, _TypedName * param_array_p);
 
+    static void         fetch_k2_params_generic        (FFrame & stack, const ReflectedCall & reflected_call, SkInvokedContextBase * icontext_p);
+    template<uint32_t _NumParams>
+    static void         fetch_k2_params_thunk          (FFrame & stack, const ReflectedCall & reflected_call, SkInvokedContextBase * icontext_p);
+    static SkInstance * fetch_k2_param_inline          (FFrame & stack, const ReflectedCallParam & call_param);
+    static eK2ParamKind get_k2_param_kind              (const ReflectedAccessors * accessors_p);
+
     static SkInstance * fetch_k2_param_boolean         (FFrame & stack, const ReflectedCallParam & value_type);
     static SkInstance * fetch_k2_param_integer         (FFrame & stack, const ReflectedCallParam & value_type);
     static SkInstance * fetch_k2_param_real            (FFrame & stack, const ReflectedCallParam & value_type);
@@ -382,10 +446,17 @@ class SkUEReflectionManager
     static const ReflectedAccessors ms_accessors_array;
     static const ReflectedAccessors ms_accessors_name;
 
+    static const tK2ParamsFetcher   ms_k2_params_thunks[K2ParamsThunk_max_params + 1];
+
     tReflectedFunctions   m_reflected_functions;
     tReflectedClasses     m_reflected_classes;
     tReflectedDelegates   m_reflected_delegates;
 
+    TArray<BatchedReceiver>       m_batched_receivers;
+    TArray<BatchedCall>           m_batched_calls;
+    TArray<SkInstance *>          m_batched_args;
+    TMap<const void *, int32_t>   m_batched_receiver_map; // Receiver key -> index into m_batched_receivers
+
     ASymbol               m_result_name;
 
     UPackage *            m_module_package_p;
@@ -76,6 +76,10 @@ namespace
 {
   const int32_t SkUERemote_ide_port = 12357;
 
+  // Most bytes read from the socket in one call to process_incoming() - the remainder is
+  // picked up on the next update so a large transfer from the IDE is spread over frames.
+  const uint32_t SkUERemote_recv_bytes_per_update = 256u * 1024u;
+
   #if PLATFORM_HAS_BSD_SOCKETS
 
     // $HACK - Access to `Socket` member in the private FSocketBSD and FSocketBSDIPv6
@@ -152,14 +156,18 @@ SkUERemote::~SkUERemote()
 // Processes any remotely received data and call on_cmd_recv() whenever enough data is
 // accumulated.
 // 
+// Reads at most SkUERemote_recv_bytes_per_update bytes per call - a partially received
+// datum is resumed on the next call.
+// 
 // #Author(s): Conan Reis
 void SkUERemote::process_incoming()
   {
   //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
   // Connected and data available?
-  uint32 bytes_available;
+  uint32   bytes_available;
+  uint32_t bytes_budget = SkUERemote_recv_bytes_per_update;
 
-  while (is_connected() && m_socket_p->HasPendingData(bytes_available))
+  while (bytes_budget && is_connected() && m_socket_p->HasPendingData(bytes_available))
     {
     //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
     // Get datum size & prep datum
@@ -179,6 +187,7 @@ void SkUERemote::process_incoming()
       m_socket_p->Recv(reinterpret_cast<uint8 *>(&datum_size), sizeof(uint32_t), bytes_read);
 
       bytes_available -= sizeof(uint32_t);
+      bytes_budget    -= a_min(bytes_budget, uint32_t(sizeof(uint32_t)));
       datum_size -= ADatum_header_size;
       m_data_in.ensure_size(datum_size, false);
       m_data_in.set_data_length(datum_size);
@@ -195,15 +204,16 @@ void SkUERemote::process_incoming()
     uint32_t bytes_to_read;
     uint8 *  buffer_p = m_data_in.get_data_writable();
 
-    while (bytes_available
-      || (is_connected() && m_socket_p->HasPendingData(bytes_available)))
+    while (bytes_budget
+      && (bytes_available || (is_connected() && m_socket_p->HasPendingData(bytes_available))))
       {
-      bytes_to_read = a_min(bytes_available, datum_size - m_data_idx);
+      bytes_to_read = a_min(a_min(bytes_available, datum_size - m_data_idx), bytes_budget);
 
       // Read datum data from socket
       m_socket_p->Recv(buffer_p + m_data_idx, bytes_to_read, bytes_read);
 
       m_data_idx += bytes_read;
+      bytes_budget -= a_min(bytes_budget, uint32_t(bytes_read));
       bytes_available = 0; // Reset to refresh on next loop
 
       if (m_data_idx == datum_size)
@@ -495,15 +505,32 @@ void SkUERemote::on_class_updated(SkClass * class_p)
   SkRemoteBase::on_class_updated(class_p);
 
   #if WITH_EDITOR
-    AMethodArg2<ISkookumScriptRuntimeEditorInterface, UFunction*, bool> editor_on_function_updated_f(m_editor_interface_p, &ISkookumScriptRuntimeEditorInterface::on_function_updated);
     AMethodArg<ISkookumScriptRuntimeEditorInterface, UClass*>           editor_on_function_removed_from_class_f(m_editor_interface_p, &ISkookumScriptRuntimeEditorInterface::on_function_removed_from_class);
-    tSkUEOnFunctionUpdatedFunc *          on_function_updated_f            = &editor_on_function_updated_f;
     tSkUEOnFunctionRemovedFromClassFunc * on_function_removed_from_class_f = &editor_on_function_removed_from_class_f;
   #else
-    tSkUEOnFunctionUpdatedFunc *          on_function_updated_f            = nullptr;
     tSkUEOnFunctionRemovedFromClassFunc * on_function_removed_from_class_f = nullptr;
   #endif
   SkUEReflectionManager::get()->sync_class_from_sk(class_p, on_function_removed_from_class_f);
+  }
+
+//---------------------------------------------------------------------------------------
+void SkUERemote::on_class_updates_end(uint32_t updated_class_count)
+  {
+  // Call superclass behavior
+  SkRemoteBase::on_class_updates_end(updated_class_count);
+
+  if (!updated_class_count)
+    {
+    return;
+    }
+
+  // Push all reflected changes to UE in one pass rather than once per updated class
+  #if WITH_EDITOR
+    AMethodArg2<ISkookumScriptRuntimeEditorInterface, UFunction*, bool> editor_on_function_updated_f(m_editor_interface_p, &ISkookumScriptRuntimeEditorInterface::on_function_updated);
+    tSkUEOnFunctionUpdatedFunc * on_function_updated_f = &editor_on_function_updated_f;
+  #else
+    tSkUEOnFunctionUpdatedFunc * on_function_updated_f = nullptr;
+  #endif
   SkUEReflectionManager::get()->sync_all_to_ue(on_function_updated_f, true);
   }
 
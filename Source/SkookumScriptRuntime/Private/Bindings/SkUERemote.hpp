@@ -119,6 +119,7 @@ class SkUERemote : public SkRemoteRuntimeBase
     virtual void              on_cmd_make_editable() override;
     virtual void              on_cmd_freshen_compiled_reply(eCompiledState state) override;
     virtual void              on_class_updated(SkClass * class_p) override;
+    virtual void              on_class_updates_end(uint32_t updated_class_count) override;
     virtual void              on_connect_change(eConnectState old_state) override;
 
   // Data Members
@@ -23,12 +23,15 @@
 #include "Engine/Blueprint.h"
 #include "Engine/UserDefinedStruct.h"
 #include "HAL/FileManager.h"
+#include "HAL/PlatformFilemanager.h"
+#include "Async/AsyncFileHandle.h"
 #include <chrono>
 
 #include <AgogCore/AMethodArg.hpp>
 #include <SkookumScript/SkClass.hpp>
 #include <SkookumScript/SkParser.hpp>
 #include "Engine/SkUEName.hpp"
+#include "Engine/SkUEActor.hpp"
 
 
 //=======================================================================================
@@ -90,6 +93,95 @@ namespace
         }
     };
 
+  //---------------------------------------------------------------------------------------
+  // Custom Unreal Binary Stream - reads chunks through the platform async file API
+  class SkBinaryStreamUE : public SkBinaryStream
+    {
+    public:
+
+      //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+      static SkBinaryStreamUE * create(const TCHAR * path_p)
+        {
+        IAsyncReadFileHandle * handle_p = FPlatformFileManager::Get().GetPlatformFile().OpenAsyncRead(path_p);
+        if (!handle_p)
+          {
+          return nullptr;
+          }
+
+        // Size is needed up front to allocate the buffer the chunks are read into
+        IAsyncReadRequest * size_request_p = handle_p->SizeRequest();
+        size_request_p->WaitCompletion();
+        int64 size = size_request_p->GetSizeResults();
+        delete size_request_p;
+
+        if (size <= 0)
+          {
+          delete handle_p;
+
+          return nullptr;
+          }
+
+        return new SkBinaryStreamUE(handle_p, (uint32_t)size);
+        }
+
+      //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+      virtual ~SkBinaryStreamUE() override
+        {
+        while (m_requests.Num())
+          {
+          wait_read();
+          }
+
+        delete m_handle_p;
+        }
+
+      //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+      virtual uint32_t get_size() override
+        {
+        return m_size;
+        }
+
+      //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+      virtual void request_read(uint32_t offset, uint32_t size, void * dest_p) override
+        {
+        m_requests.Add(m_handle_p->ReadRequest(offset, size, AIOP_High, nullptr, static_cast<uint8 *>(dest_p)));
+        }
+
+      //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+      virtual bool wait_read() override
+        {
+        if (!m_requests.Num())
+          {
+          return false;
+          }
+
+        IAsyncReadRequest * request_p = m_requests[0];
+        m_requests.RemoveAt(0, 1, false);
+
+        if (!request_p)
+          {
+          return false;
+          }
+
+        request_p->WaitCompletion();
+        bool success = request_p->GetReadResults() != nullptr;
+        delete request_p;
+
+        return success;
+        }
+
+    protected:
+
+      //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+      SkBinaryStreamUE(IAsyncReadFileHandle * handle_p, uint32_t size) : m_handle_p(handle_p), m_size(size)
+        {
+        }
+
+      IAsyncReadFileHandle *      m_handle_p;
+      uint32_t                    m_size;
+      TArray<IAsyncReadRequest *> m_requests; // Outstanding reads oldest first
+    };
+
 
 } // End unnamed namespace
 
@@ -197,6 +289,20 @@ void SkUERuntime::ensure_static_ue_types_registered()
   SkUEBindings::ensure_static_ue_types_registered(m_project_generated_bindings_p);
   }
 
+//---------------------------------------------------------------------------------------
+// Per frame update of SkookumScript
+//
+// Blueprint calls to &batched methods made since the last tick are invoked first, so
+// coroutines they start get their first update in the same frame.
+//
+// #Params:
+//   sim_delta: Simulation delta time (in seconds) since last update.
+void SkUERuntime::tick(float sim_delta)
+  {
+  m_reflection_manager.flush_batched_calls();
+  update(sim_delta);
+  }
+
 //---------------------------------------------------------------------------------------
 // Override to add bindings to any custom C++ routines (methods & coroutines).
 //
@@ -214,6 +320,9 @@ void SkUERuntime::on_bind_routines()
   ensure_static_ue_types_registered();
   SkUEBindings::finish_register_bindings(m_project_generated_bindings_p);
   USkookumScriptBehaviorComponent::initialize();
+
+  // The actor index is keyed by the classes that were just (re)loaded
+  SkUEActorIndex::invalidate();
   
   // We bound all routines at least once
   m_is_compiled_scripts_bound = true;
@@ -223,6 +332,16 @@ void SkUERuntime::on_bind_routines()
 
 void SkUERuntime::on_initialization_level_changed(SkookumScript::eInitializationLevel from_level, SkookumScript::eInitializationLevel to_level)
   {
+  // Calls batched for a sim that is shutting down must not leak into the next one
+  if (to_level < SkookumScript::InitializationLevel_sim)
+    {
+    m_reflection_manager.discard_batched_calls();
+
+    if (from_level >= SkookumScript::InitializationLevel_sim)
+      {
+      SkUEBindings::report_unused_bindings();
+      }
+    }
   }
 
 //---------------------------------------------------------------------------------------
@@ -513,6 +632,21 @@ SkBinaryHandle * SkUERuntime::get_binary_hierarchy()
   return SkBinaryHandleUE::create(*compiled_file);
   }
 
+//---------------------------------------------------------------------------------------
+// Gets async stream of binary for class hierarchy and associated info - used instead of
+// get_binary_hierarchy() so classes are loaded while the rest of the file is being read.
+// 
+// #See Also:   SkRuntimeBase::load_compiled_hierarchy_stream()
+// #Modifiers:  virtual - overridden from SkRuntimeBase
+SkBinaryStream * SkUERuntime::get_binary_hierarchy_stream()
+  {
+  FString compiled_file = FPaths::ConvertRelativePathToFull(get_compiled_path() / TEXT("classes.sk-bin"));
+
+  A_DPRINT("  Streaming compiled binary file '%ls'...\n", *compiled_file);
+
+  return SkBinaryStreamUE::create(*compiled_file);
+  }
+
 //---------------------------------------------------------------------------------------
 // Gets memory representing binary for group of classes with specified class as root.
 // Used as a mechanism to "demand load" scripts.
@@ -49,6 +49,8 @@ class SkUERuntime :
 
     void ensure_static_ue_types_registered();
 
+    void tick(float sim_delta);
+
     // Script Loading / Binding
 
       const FString & get_compiled_path() const;
@@ -70,6 +72,7 @@ class SkUERuntime :
         virtual SkBinaryHandle * get_binary_hierarchy() override;
         virtual SkBinaryHandle * get_binary_class_group(const SkClass & cls) override;
         virtual void             release_binary(SkBinaryHandle * handle_p) override;
+        virtual SkBinaryStream * get_binary_hierarchy_stream() override;
 
         #if defined(A_SYMBOL_STR_DB_AGOG)  
           virtual SkBinaryHandle * get_binary_symbol_table() override;
@@ -95,7 +95,7 @@ namespace SkColor_Impl
     // Do nothing if result not desired
     if (result_pp)
       {
-      *result_pp = SkColor::new_instance(scope_p->this_as<SkColor>() + scope_p->get_arg<SkColor>(SkArg_1));
+      *result_pp = SkColor::new_instance_reuse(scope_p->get_arg(SkArg_1), scope_p->this_as<SkColor>() + scope_p->get_arg<SkColor>(SkArg_1));
       }
     }
 
@@ -124,7 +124,7 @@ namespace SkColor_Impl
     // Do nothing if result not desired
     if (result_pp)
       {
-      *result_pp = SkColor::new_instance(scope_p->this_as<SkColor>() - scope_p->get_arg<SkColor>(SkArg_1));
+      *result_pp = SkColor::new_instance_reuse(scope_p->get_arg(SkArg_1), scope_p->this_as<SkColor>() - scope_p->get_arg<SkColor>(SkArg_1));
       }
     }
 
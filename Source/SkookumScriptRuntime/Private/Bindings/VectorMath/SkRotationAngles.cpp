@@ -96,7 +96,7 @@ namespace SkRotationAngles_Impl
     // Do nothing if result not desired
     if (result_pp)
       {
-      *result_pp = SkRotationAngles::new_instance(scope_p->this_as<SkRotationAngles>() + scope_p->get_arg<SkRotationAngles>(SkArg_1));
+      *result_pp = SkRotationAngles::new_instance_reuse(scope_p->get_arg(SkArg_1), scope_p->this_as<SkRotationAngles>() + scope_p->get_arg<SkRotationAngles>(SkArg_1));
       }
     }
 
@@ -125,7 +125,7 @@ namespace SkRotationAngles_Impl
     // Do nothing if result not desired
     if (result_pp)
       {
-      *result_pp = SkRotationAngles::new_instance(scope_p->this_as<SkRotationAngles>() - scope_p->get_arg<SkRotationAngles>(SkArg_1));
+      *result_pp = SkRotationAngles::new_instance_reuse(scope_p->get_arg(SkArg_1), scope_p->this_as<SkRotationAngles>() - scope_p->get_arg<SkRotationAngles>(SkArg_1));
       }
     }
 
@@ -276,6 +276,7 @@ void SkRotationAngles::register_bindings()
   ms_class_p->register_method_func_bulk(SkRotationAngles_Impl::methods_i, A_COUNT_OF(SkRotationAngles_Impl::methods_i), SkBindFlag_instance_no_rebind);
 
   ms_class_p->register_raw_accessor_func(&SkUEClassBindingHelper::access_raw_data_struct<SkRotationAngles>);
+  ms_class_p->register_raw_pod_size(sizeof(tDataType));
   SkUEClassBindingHelper::resolve_raw_data_struct(ms_class_p, TEXT("Rotator"));
   }
 
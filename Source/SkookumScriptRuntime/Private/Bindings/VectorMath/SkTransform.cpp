@@ -147,6 +147,7 @@ void SkTransform::register_bindings()
   ms_class_p->register_method_func_bulk(SkTransform_Impl::methods_i, A_COUNT_OF(SkTransform_Impl::methods_i), SkBindFlag_instance_no_rebind);
 
   ms_class_p->register_raw_accessor_func(&SkUEClassBindingHelper::access_raw_data_struct<SkTransform>);
+  ms_class_p->register_raw_pod_size(sizeof(tDataType));
 
   // Handle special case here - in UE4, the scale variable is called "Scale3D" while in Sk, we decided to call it just "scale"
   UStruct * ue_struct_p = FindObjectChecked<UScriptStruct>(UObject::StaticClass()->GetOutermost(), TEXT("Transform"), false);
@@ -116,7 +116,7 @@ namespace SkVector2_Impl
     // Do nothing if result not desired
     if (result_pp)
       {
-      *result_pp = SkVector2::new_instance(scope_p->this_as<SkVector2>() + scope_p->get_arg<SkVector2>(SkArg_1));
+      *result_pp = SkVector2::new_instance_reuse(scope_p->get_arg(SkArg_1), scope_p->this_as<SkVector2>() + scope_p->get_arg<SkVector2>(SkArg_1));
       }
     }
 
@@ -145,7 +145,7 @@ namespace SkVector2_Impl
     // Do nothing if result not desired
     if (result_pp)
       {
-      *result_pp = SkVector2::new_instance(scope_p->this_as<SkVector2>() - scope_p->get_arg<SkVector2>(SkArg_1));
+      *result_pp = SkVector2::new_instance_reuse(scope_p->get_arg(SkArg_1), scope_p->this_as<SkVector2>() - scope_p->get_arg<SkVector2>(SkArg_1));
       }
     }
 
@@ -466,6 +466,7 @@ void SkVector2::register_bindings()
   ms_class_p->register_method_func_bulk(SkVector2_Impl::methods_i, A_COUNT_OF(SkVector2_Impl::methods_i), SkBindFlag_instance_no_rebind);
 
   ms_class_p->register_raw_accessor_func(&SkUEClassBindingHelper::access_raw_data_struct<SkVector2>);
+  ms_class_p->register_raw_pod_size(sizeof(tDataType));
   SkUEClassBindingHelper::resolve_raw_data_struct(ms_class_p, TEXT("Vector2D"));
   }
 
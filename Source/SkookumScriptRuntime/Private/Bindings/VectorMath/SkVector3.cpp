@@ -159,7 +159,7 @@ namespace SkVector3_Impl
     // Do nothing if result not desired
     if (result_pp)
       {
-      *result_pp = SkVector3::new_instance(scope_p->this_as<SkVector3>() + scope_p->get_arg<SkVector3>(SkArg_1));
+      *result_pp = SkVector3::new_instance_reuse(scope_p->get_arg(SkArg_1), scope_p->this_as<SkVector3>() + scope_p->get_arg<SkVector3>(SkArg_1));
       }
     }
 
@@ -188,7 +188,7 @@ namespace SkVector3_Impl
     // Do nothing if result not desired
     if (result_pp)
       {
-      *result_pp = SkVector3::new_instance(scope_p->this_as<SkVector3>() - scope_p->get_arg<SkVector3>(SkArg_1));
+      *result_pp = SkVector3::new_instance_reuse(scope_p->get_arg(SkArg_1), scope_p->this_as<SkVector3>() - scope_p->get_arg<SkVector3>(SkArg_1));
       }
     }
 
@@ -594,6 +594,7 @@ void SkVector3::register_bindings()
   ms_class_p->register_method_func_bulk(SkVector3_Impl::methods_i, A_COUNT_OF(SkVector3_Impl::methods_i), SkBindFlag_instance_no_rebind);
 
   ms_class_p->register_raw_accessor_func(&SkUEClassBindingHelper::access_raw_data_struct<SkVector3>);
+  ms_class_p->register_raw_pod_size(sizeof(tDataType));
   SkUEClassBindingHelper::resolve_raw_data_struct(ms_class_p, TEXT("Vector"));
   }
 
@@ -180,7 +180,7 @@ namespace SkVector4_Impl
     // Do nothing if result not desired
     if (result_pp)
       {
-      *result_pp = SkVector4::new_instance(scope_p->this_as<SkVector4>() + scope_p->get_arg<SkVector4>(SkArg_1));
+      *result_pp = SkVector4::new_instance_reuse(scope_p->get_arg(SkArg_1), scope_p->this_as<SkVector4>() + scope_p->get_arg<SkVector4>(SkArg_1));
       }
     }
 
@@ -209,7 +209,7 @@ namespace SkVector4_Impl
     // Do nothing if result not desired
     if (result_pp)
       {
-      *result_pp = SkVector4::new_instance(scope_p->this_as<SkVector4>() - scope_p->get_arg<SkVector4>(SkArg_1));
+      *result_pp = SkVector4::new_instance_reuse(scope_p->get_arg(SkArg_1), scope_p->this_as<SkVector4>() - scope_p->get_arg<SkVector4>(SkArg_1));
       }
     }
 
@@ -541,6 +541,7 @@ void SkVector4::register_bindings()
   ms_class_p->register_method_func_bulk(SkVector4_Impl::methods_i, A_COUNT_OF(SkVector4_Impl::methods_i), SkBindFlag_instance_no_rebind);
 
   ms_class_p->register_raw_accessor_func(&SkUEClassBindingHelper::access_raw_data_struct<SkVector4>);
+  ms_class_p->register_raw_pod_size(sizeof(tDataType));
   SkUEClassBindingHelper::resolve_raw_data_struct(ms_class_p, TEXT("Vector4"));
   }
 
@@ -15,6 +15,9 @@
 #include "SkookumScriptInstancePropertyOld.h"
 
 #include "Modules/ModuleManager.h" // For IMPLEMENT_MODULE
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
 
 #if WITH_EDITOR
 #include "Misc/OutputDeviceConsole.h"
@@ -25,6 +28,7 @@
 #endif
 
 #include <AgogCore/AMethodArg.hpp>
+#include <SkookumScript/SkReplay.hpp>
 
 // For profiling SkookumScript performance
 DECLARE_CYCLE_STAT(TEXT("SkookumScript Time"), STAT_SkookumScriptTime, STATGROUP_Game);
@@ -154,6 +158,86 @@ IMPLEMENT_MODULE(FSkookumScriptRuntime, SkookumScriptRuntime)
 DEFINE_LOG_CATEGORY(LogSkookum);
 
 
+#if !UE_BUILD_SHIPPING
+
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Session recording console commands - see SkReplay
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+
+//---------------------------------------------------------------------------------------
+// Sk.ReplayRecord [Class@method | Class@@class_method]...
+// Records the next play session - the given C++ method bindings are designated as inputs
+
+static void replay_record(const TArray<FString> & args)
+  {
+  // Inputs can only be designated while not recording
+  SkReplay::record_stop();
+
+  for (const FString & arg : args)
+    {
+    FString class_name;
+    FString method_name;
+    bool    class_member_b = arg.Split(TEXT("@@"), &class_name, &method_name);
+
+    if (!class_member_b && !arg.Split(TEXT("@"), &class_name, &method_name))
+      {
+      UE_LOG(LogSkookum, Warning, TEXT("Sk.ReplayRecord: expected Class@method or Class@@method but got '%s'."), *arg);
+      continue;
+      }
+
+    SkReplay::designate_input(
+      ASymbol::create_existing(TCHAR_TO_UTF8(*class_name)),
+      ASymbol::create_existing(TCHAR_TO_UTF8(*method_name)),
+      class_member_b);
+    }
+
+  SkReplay::record_arm();
+
+  UE_LOG(LogSkookum, Display, TEXT("SkookumScript will record the next play session - save it with Sk.ReplaySave."));
+  }
+
+//---------------------------------------------------------------------------------------
+// Sk.ReplaySave [file]
+// Ends the recording and saves it - by default to Saved/SkookumScript/Session.skreplay
+
+static void replay_save(const TArray<FString> & args)
+  {
+  SkReplay::record_stop();
+
+  const uint8_t * data_p = SkReplay::get_data();
+
+  if (!data_p)
+    {
+    UE_LOG(LogSkookum, Warning, TEXT("Sk.ReplaySave: nothing has been recorded - start a recording with Sk.ReplayRecord."));
+    return;
+    }
+
+  FString       file_path = args.Num() ? args[0] : FPaths::ProjectSavedDir() / TEXT("SkookumScript/Session.skreplay");
+  TArray<uint8> bytes(data_p, int32(SkReplay::get_data_length()));
+
+  if (FFileHelper::SaveArrayToFile(bytes, *file_path))
+    {
+    UE_LOG(LogSkookum, Display, TEXT("SkookumScript session recording (%d bytes) saved to '%s' - replay it with SkookumScriptBench -replay."), bytes.Num(), *file_path);
+    }
+  else
+    {
+    UE_LOG(LogSkookum, Error, TEXT("Sk.ReplaySave: could not write '%s'!"), *file_path);
+    }
+  }
+
+static FAutoConsoleCommand g_replay_record_cmd(
+  TEXT("Sk.ReplayRecord"),
+  TEXT("Records the next SkookumScript play session for replay in SkookumScriptBench. Args: C++ method bindings to record the results of - Class@method or Class@@method."),
+  FConsoleCommandWithArgsDelegate::CreateStatic(replay_record));
+
+static FAutoConsoleCommand g_replay_save_cmd(
+  TEXT("Sk.ReplaySave"),
+  TEXT("Ends the SkookumScript session recording and saves it. Args: file path - defaults to Saved/SkookumScript/Session.skreplay."),
+  FConsoleCommandWithArgsDelegate::CreateStatic(replay_save));
+
+#endif  // !UE_BUILD_SHIPPING
+
+
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
 // FAppInterface implementation
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
@@ -848,7 +932,7 @@ void FSkookumScriptRuntime::tick_game(float deltaTime)
   #endif
       {
       SCOPE_CYCLE_COUNTER(STAT_SkookumScriptTime);
-      m_runtime.update(deltaTime);
+      m_runtime.tick(deltaTime);
       }
   }
 
@@ -897,6 +981,12 @@ void FSkookumScriptRuntime::tick_remote()
       // live somewhere other than a tick method such as its own thread.
       m_remote_client.process_incoming();
 
+      // Run any snippets queued by the IDE or other tools within a small time budget
+      m_remote_client.process_invoke_queue();
+
+      // Send allocation profile counts if the IDE is streaming them
+      m_remote_client.process_memory_stream();
+
       // Re-load compiled binaries?
       // If the game is currently running, delay until it's not
       if (m_remote_client.is_load_compiled_binaries_requested() 
@@ -387,6 +387,9 @@ class SkUEClassBindingStructPod : public SkUEClassBindingStruct<_BindingClass,_D
   {
   public:
 
+    typedef SkUEClassBindingStruct<_BindingClass, _DataType>     tBindingStruct;
+    typedef SkUEClassBindingStructPod<_BindingClass, _DataType>  tBindingStructPod;
+
   #ifdef __clang__
     #pragma clang diagnostic push
     #pragma clang diagnostic ignored "-Wdynamic-class-memaccess"
@@ -399,6 +402,22 @@ class SkUEClassBindingStructPod : public SkUEClassBindingStruct<_BindingClass,_D
   #ifdef __clang__
     #pragma clang diagnostic pop
   #endif
+
+  protected:
+
+    // Make method bindings known to SkookumScript
+    static void register_bindings()
+      {
+      tBindingStruct::register_bindings();
+
+      // Raw members of this type can be copied directly without going through the accessor
+      tBindingStruct::tBindingAbstract::ms_class_p->register_raw_pod_size(sizeof(_DataType));
+      }
+
+    // Convenience methods - initialize Sk class and bind methods
+    static void register_bindings(ASymbol class_name)        { tBindingStruct::tBindingAbstract::initialize_class(class_name); register_bindings(); }
+    static void register_bindings(const char * class_name_p) { tBindingStruct::tBindingAbstract::initialize_class(class_name_p); register_bindings(); }
+    static void register_bindings(uint32_t class_name_id)    { tBindingStruct::tBindingAbstract::initialize_class(class_name_id); register_bindings(); }
   };
 
 //---------------------------------------------------------------------------------------